@@ -0,0 +1,456 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_Batch.cpp
+ * @brief Benchmark column-oriented batch operations (throughput reported as rows/s, and bytes/s for parsing)
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/datetime/Batch.h>
+
+namespace nfx::time::benchmark
+{
+	//=====================================================================
+	// Batch benchmark suite
+	//=====================================================================
+
+	/** @brief Rows per benchmark batch */
+	static constexpr std::size_t BATCH_ROWS{ 1 << 20 };
+
+	/** @brief Timestamps spread across 1970-2100 at random times of day */
+	static std::vector<DateTime> timestampColumn()
+	{
+		std::vector<DateTime> values;
+		values.reserve( BATCH_ROWS );
+
+		const auto first{ DateTime{ 1970, 1, 1 }.ticks() };
+		const auto span{ static_cast<std::uint64_t>( DateTime{ 2100, 1, 1 }.ticks() - first ) };
+		std::uint64_t state{ 0x9E3779B97F4A7C15ULL };
+		for ( std::size_t i{ 0 }; i < BATCH_ROWS; ++i )
+		{
+			state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+			values.emplace_back( first + static_cast<std::int64_t>( state % span ) );
+		}
+
+		return values;
+	}
+
+	//----------------------------------------------
+	// Decomposition
+	//----------------------------------------------
+
+	static void BM_Batch_Decompose_PerRowAccessors( ::benchmark::State& state )
+	{
+		const auto values{ timestampColumn() };
+		batch::DecomposedColumns columns;
+		columns.resize( values.size() );
+
+		for ( auto _ : state )
+		{
+			for ( std::size_t i{ 0 }; i < values.size(); ++i )
+			{
+				columns.year[i] = values[i].year();
+				columns.month[i] = values[i].month();
+				columns.day[i] = values[i].day();
+				columns.hour[i] = values[i].hour();
+				columns.minute[i] = values[i].minute();
+				columns.second[i] = values[i].second();
+			}
+			::benchmark::DoNotOptimize( columns.year.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * values.size() ) );
+	}
+
+	static void BM_Batch_Decompose( ::benchmark::State& state )
+	{
+		const auto requested{ static_cast<batch::SimdLevel>( state.range( 0 ) ) };
+		if ( batch::setSimdLevel( requested ) != requested )
+		{
+			state.SkipWithError( "SIMD level not supported on this host" );
+			batch::setSimdLevel( batch::supportedSimdLevel() );
+
+			return;
+		}
+
+		const auto values{ timestampColumn() };
+		batch::DecomposedColumns columns;
+
+		for ( auto _ : state )
+		{
+			batch::decompose( values, columns );
+			::benchmark::DoNotOptimize( columns.year.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * values.size() ) );
+		batch::setSimdLevel( batch::supportedSimdLevel() );
+	}
+
+	//----------------------------------------------
+	// Composition
+	//----------------------------------------------
+
+	static void BM_Batch_Compose_PerRowConstructor( ::benchmark::State& state )
+	{
+		batch::DecomposedColumns columns;
+		batch::decompose( timestampColumn(), columns );
+		std::vector<DateTime> out( columns.size() );
+
+		for ( auto _ : state )
+		{
+			for ( std::size_t i{ 0 }; i < out.size(); ++i )
+			{
+				out[i] = DateTime{ columns.year[i], columns.month[i], columns.day[i], columns.hour[i], columns.minute[i], columns.second[i] };
+			}
+			::benchmark::DoNotOptimize( out.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * out.size() ) );
+	}
+
+	static void BM_Batch_Compose( ::benchmark::State& state )
+	{
+		const auto requested{ static_cast<batch::SimdLevel>( state.range( 0 ) ) };
+		if ( batch::setSimdLevel( requested ) != requested )
+		{
+			state.SkipWithError( "SIMD level not supported on this host" );
+			batch::setSimdLevel( batch::supportedSimdLevel() );
+
+			return;
+		}
+
+		batch::DecomposedColumns columns;
+		batch::decompose( timestampColumn(), columns );
+		const batch::ComponentColumns input{ columns.year, columns.month, columns.day, columns.hour, columns.minute, columns.second, {} };
+		std::vector<DateTime> out( columns.size() );
+		batch::ErrorBitmap invalid;
+
+		for ( auto _ : state )
+		{
+			auto invalidCount{ batch::compose( input, out, invalid ) };
+			::benchmark::DoNotOptimize( invalidCount );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * out.size() ) );
+		batch::setSimdLevel( batch::supportedSimdLevel() );
+	}
+
+	//----------------------------------------------
+	// Parsing
+	//----------------------------------------------
+
+	/** @brief ISO 8601 strings of the timestamp column, a quarter with fractions and a quarter with offsets */
+	static std::vector<std::string> stringColumn()
+	{
+		const auto values{ timestampColumn() };
+		std::vector<std::string> strings;
+		strings.reserve( values.size() );
+		for ( std::size_t i{ 0 }; i < values.size(); ++i )
+		{
+			auto text{ values[i].toString( DateTime::Format::Iso8601Basic ) };
+			text.pop_back();
+			switch ( i & 3 )
+			{
+				case 1:
+				{
+					text += ".1234567";
+
+					break;
+				}
+				case 2:
+				{
+					text += "+05:30";
+
+					break;
+				}
+				default:
+				{
+					text += 'Z';
+
+					break;
+				}
+			}
+			strings.push_back( std::move( text ) );
+		}
+
+		return strings;
+	}
+
+	/** @brief Total characters in a string column */
+	static std::int64_t totalBytes( const std::vector<std::string>& strings )
+	{
+		std::int64_t bytes{ 0 };
+		for ( const auto& s : strings )
+		{
+			bytes += static_cast<std::int64_t>( s.size() );
+		}
+
+		return bytes;
+	}
+
+	static void BM_Batch_Parse_PerRowFromString( ::benchmark::State& state )
+	{
+		const auto strings{ stringColumn() };
+		std::vector<DateTime> out( strings.size() );
+
+		for ( auto _ : state )
+		{
+			std::size_t invalidCount{ 0 };
+			for ( std::size_t i{ 0 }; i < strings.size(); ++i )
+			{
+				invalidCount += !DateTime::fromString( strings[i], out[i] );
+			}
+			::benchmark::DoNotOptimize( invalidCount );
+			::benchmark::DoNotOptimize( out.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * strings.size() ) );
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * totalBytes( strings ) );
+	}
+
+	static void BM_Batch_Parse( ::benchmark::State& state )
+	{
+		const auto requested{ static_cast<batch::SimdLevel>( state.range( 0 ) ) };
+		if ( batch::setSimdLevel( requested ) != requested )
+		{
+			state.SkipWithError( "SIMD level not supported on this host" );
+			batch::setSimdLevel( batch::supportedSimdLevel() );
+
+			return;
+		}
+
+		const auto strings{ stringColumn() };
+		const std::vector<std::string_view> views( strings.begin(), strings.end() );
+		std::vector<DateTime> out( strings.size() );
+		batch::ErrorBitmap invalid;
+
+		for ( auto _ : state )
+		{
+			auto invalidCount{ batch::parse( views, out, invalid ) };
+			::benchmark::DoNotOptimize( invalidCount );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * strings.size() ) );
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * totalBytes( strings ) );
+		batch::setSimdLevel( batch::supportedSimdLevel() );
+	}
+
+	static void BM_Batch_Parse_StringColumn( ::benchmark::State& state )
+	{
+		const auto strings{ stringColumn() };
+		std::vector<std::int32_t> offsets{ 0 };
+		std::string data;
+		for ( const auto& s : strings )
+		{
+			data += s;
+			offsets.push_back( static_cast<std::int32_t>( data.size() ) );
+		}
+		const batch::StringColumn column{ offsets, data };
+		std::vector<DateTime> out( strings.size() );
+		batch::ErrorBitmap invalid;
+
+		for ( auto _ : state )
+		{
+			auto invalidCount{ batch::parse( column, out, invalid ) };
+			::benchmark::DoNotOptimize( invalidCount );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * strings.size() ) );
+		state.SetBytesProcessed( static_cast<std::int64_t>( data.size() ) * static_cast<std::int64_t>( state.iterations() ) );
+	}
+
+	static void BM_Batch_Parse_DateTimeOffset( ::benchmark::State& state )
+	{
+		const auto strings{ stringColumn() };
+		const std::vector<std::string_view> views( strings.begin(), strings.end() );
+		std::vector<DateTimeOffset> out( strings.size() );
+		batch::ErrorBitmap invalid;
+
+		for ( auto _ : state )
+		{
+			auto invalidCount{ batch::parse( views, out, invalid ) };
+			::benchmark::DoNotOptimize( invalidCount );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * strings.size() ) );
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * totalBytes( strings ) );
+	}
+
+	//----------------------------------------------
+	// Formatting
+	//----------------------------------------------
+
+	static void BM_Batch_Format_PerRowToString( ::benchmark::State& state )
+	{
+		const auto values{ timestampColumn() };
+		std::vector<std::string> out( values.size() );
+
+		for ( auto _ : state )
+		{
+			for ( std::size_t i{ 0 }; i < values.size(); ++i )
+			{
+				out[i] = values[i].toString();
+			}
+			::benchmark::DoNotOptimize( out.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * values.size() ) );
+	}
+
+	static void BM_Batch_Format( ::benchmark::State& state )
+	{
+		const auto requested{ static_cast<batch::SimdLevel>( state.range( 0 ) ) };
+		if ( batch::setSimdLevel( requested ) != requested )
+		{
+			state.SkipWithError( "SIMD level not supported on this host" );
+			batch::setSimdLevel( batch::supportedSimdLevel() );
+
+			return;
+		}
+
+		const auto values{ timestampColumn() };
+		batch::OutputBuffer out;
+
+		for ( auto _ : state )
+		{
+			out.clear();
+			batch::format( values, DateTime::Format::Iso8601Basic, out );
+			::benchmark::DoNotOptimize( out.data().data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * values.size() ) );
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( out.data().size() ) );
+		batch::setSimdLevel( batch::supportedSimdLevel() );
+	}
+
+	static void BM_Batch_Format_Extended( ::benchmark::State& state )
+	{
+		const auto values{ timestampColumn() };
+		batch::OutputBuffer out;
+
+		for ( auto _ : state )
+		{
+			out.clear();
+			batch::format( values, DateTime::Format::Iso8601Extended, out );
+			::benchmark::DoNotOptimize( out.data().data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * values.size() ) );
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( out.data().size() ) );
+	}
+
+	static void BM_Batch_Format_Arena( ::benchmark::State& state )
+	{
+		const auto values{ timestampColumn() };
+
+		for ( auto _ : state )
+		{
+			// Fresh arena per export, released in one step
+			std::pmr::monotonic_buffer_resource arena;
+			batch::OutputBuffer out{ &arena };
+			out.reserve( values.size(), values.size() * 20 );
+			batch::format( values, DateTime::Format::Iso8601Basic, out );
+			::benchmark::DoNotOptimize( out.data().data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * values.size() ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------------------------
+	// Decomposition
+	//----------------------------------------------
+
+	BENCHMARK( BM_Batch_Decompose_PerRowAccessors )->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_Batch_Decompose )
+		->ArgName( "simd" )
+		->Arg( static_cast<std::int64_t>( batch::SimdLevel::Scalar ) )
+		->Arg( static_cast<std::int64_t>( batch::SimdLevel::Avx2 ) )
+		->Arg( static_cast<std::int64_t>( batch::SimdLevel::Avx512 ) )
+		->Unit( ::benchmark::kMillisecond );
+
+	//----------------------------------------------
+	// Composition
+	//----------------------------------------------
+
+	BENCHMARK( BM_Batch_Compose_PerRowConstructor )->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_Batch_Compose )
+		->ArgName( "simd" )
+		->Arg( static_cast<std::int64_t>( batch::SimdLevel::Scalar ) )
+		->Arg( static_cast<std::int64_t>( batch::SimdLevel::Avx2 ) )
+		->Arg( static_cast<std::int64_t>( batch::SimdLevel::Avx512 ) )
+		->Unit( ::benchmark::kMillisecond );
+
+	//----------------------------------------------
+	// Parsing
+	//----------------------------------------------
+
+	BENCHMARK( BM_Batch_Parse_PerRowFromString )->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_Batch_Parse )
+		->ArgName( "simd" )
+		->Arg( static_cast<std::int64_t>( batch::SimdLevel::Scalar ) )
+		->Arg( static_cast<std::int64_t>( batch::SimdLevel::Avx2 ) )
+		->Arg( static_cast<std::int64_t>( batch::SimdLevel::Avx512 ) )
+		->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_Batch_Parse_StringColumn )->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_Batch_Parse_DateTimeOffset )->Unit( ::benchmark::kMillisecond );
+
+	//----------------------------------------------
+	// Formatting
+	//----------------------------------------------
+
+	BENCHMARK( BM_Batch_Format_PerRowToString )->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_Batch_Format )
+		->ArgName( "simd" )
+		->Arg( static_cast<std::int64_t>( batch::SimdLevel::Scalar ) )
+		->Arg( static_cast<std::int64_t>( batch::SimdLevel::Avx2 ) )
+		->Arg( static_cast<std::int64_t>( batch::SimdLevel::Avx512 ) )
+		->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_Batch_Format_Extended )->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_Batch_Format_Arena )->Unit( ::benchmark::kMillisecond );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,134 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_CachedClock.cpp
+ * @brief Benchmark bulk event stamping through CachedClock against DateTime::utcNow()
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <nfx/datetime/CachedClock.h>
+
+namespace nfx::time::benchmark
+{
+	//=====================================================================
+	// CachedClock benchmark suite
+	//=====================================================================
+
+	/** @brief Events stamped per benchmark iteration */
+	static constexpr std::size_t EVENT_COUNT{ 65536 };
+
+	/** @brief Shared clock, started once for every benchmark and thread */
+	static CachedClock& runningClock()
+	{
+		static CachedClock clock{ TimeSpan::fromMicroseconds( 100.0 ) };
+		clock.start();
+
+		return clock;
+	}
+
+	//----------------------------------------------
+	// Single reads
+	//----------------------------------------------
+
+	static void BM_CachedClock_UtcNow( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			auto dt{ DateTime::utcNow() };
+			::benchmark::DoNotOptimize( dt );
+		}
+	}
+
+	static void BM_CachedClock_Now( ::benchmark::State& state )
+	{
+		const CachedClock& clock{ runningClock() };
+		for ( auto _ : state )
+		{
+			auto dt{ clock.now() };
+			::benchmark::DoNotOptimize( dt );
+		}
+	}
+
+	//----------------------------------------------
+	// Bulk stamping
+	//----------------------------------------------
+
+	static void BM_CachedClock_StampEvents_UtcNow( ::benchmark::State& state )
+	{
+		std::vector<DateTime> stamps( EVENT_COUNT );
+		for ( auto _ : state )
+		{
+			for ( auto& stamp : stamps )
+			{
+				stamp = DateTime::utcNow();
+			}
+			::benchmark::DoNotOptimize( stamps.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * EVENT_COUNT ) );
+	}
+
+	static void BM_CachedClock_StampEvents_Cached( ::benchmark::State& state )
+	{
+		const CachedClock& clock{ runningClock() };
+		std::vector<DateTime> stamps( EVENT_COUNT );
+		for ( auto _ : state )
+		{
+			for ( auto& stamp : stamps )
+			{
+				stamp = clock.now();
+			}
+			::benchmark::DoNotOptimize( stamps.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * EVENT_COUNT ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------------------------
+	// Single reads
+	//----------------------------------------------
+
+	BENCHMARK( BM_CachedClock_UtcNow )->ThreadRange( 1, 4 );
+	BENCHMARK( BM_CachedClock_Now )->ThreadRange( 1, 4 );
+
+	//----------------------------------------------
+	// Bulk stamping
+	//----------------------------------------------
+
+	BENCHMARK( BM_CachedClock_StampEvents_UtcNow )->ThreadRange( 1, 4 );
+	BENCHMARK( BM_CachedClock_StampEvents_Cached )->ThreadRange( 1, 4 );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
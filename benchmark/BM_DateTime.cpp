@@ -29,6 +29,13 @@
 
 #include <benchmark/benchmark.h>
 
+#include <array>
+#include <format>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include <nfx/datetime/DateTime.h>
 
 namespace nfx::time::benchmark
@@ -77,6 +84,17 @@ namespace nfx::time::benchmark
 		}
 	}
 
+	static void BM_DateTime_UtcNowCoarse( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			auto dt{ DateTime::utcNowCoarse() };
+			::benchmark::DoNotOptimize( dt );
+		}
+
+		state.counters["resolution_us"] = DateTime::coarseClockResolution().microseconds();
+	}
+
 	//----------------------------------------------
 	// Parsing
 	//----------------------------------------------
@@ -103,6 +121,104 @@ namespace nfx::time::benchmark
 		}
 	}
 
+	/** @brief General ISO 8601 parser alone, i.e. fromString() before the canonical-layout fast path */
+	static void BM_DateTime_Parse_GeneralParser( ::benchmark::State& state )
+	{
+		const std::string iso{ "2024-10-23T15:30:45Z" };
+
+		for ( auto _ : state )
+		{
+			std::string_view input{ iso };
+			::benchmark::DoNotOptimize( input );
+			std::int64_t ticks{ 0 };
+			auto parsed{ internal::parseDateTime( input, ticks ) };
+			::benchmark::DoNotOptimize( parsed );
+			::benchmark::DoNotOptimize( ticks );
+		}
+	}
+
+	static void BM_DateTime_ParseExtended_GeneralParser( ::benchmark::State& state )
+	{
+		const std::string iso{ "2024-10-23T15:30:45.1234567Z" };
+
+		for ( auto _ : state )
+		{
+			std::string_view input{ iso };
+			::benchmark::DoNotOptimize( input );
+			std::int64_t ticks{ 0 };
+			auto parsed{ internal::parseDateTime( input, ticks ) };
+			::benchmark::DoNotOptimize( parsed );
+			::benchmark::DoNotOptimize( ticks );
+		}
+	}
+
+	/** @brief Offset suffix: fails the canonical shape check and takes the general parser */
+	static void BM_DateTime_Parse_NonCanonical( ::benchmark::State& state )
+	{
+		const std::string iso{ "2024-10-23T15:30:45+02:00" };
+
+		for ( auto _ : state )
+		{
+			auto dt{ DateTime{ iso } };
+			::benchmark::DoNotOptimize( dt );
+		}
+	}
+
+	/** @brief Compile-time pattern on the same input as BM_DateTime_Parse */
+	static void BM_DateTime_ParsePattern( ::benchmark::State& state )
+	{
+		const std::string iso{ "2024-10-23T15:30:45Z" };
+
+		for ( auto _ : state )
+		{
+			DateTime dt;
+			auto parsed{ DateTime::parse<"%FT%TZ">( iso, dt ) };
+			::benchmark::DoNotOptimize( parsed );
+			::benchmark::DoNotOptimize( dt );
+		}
+	}
+
+	static void BM_DateTime_ParsePatternExtended( ::benchmark::State& state )
+	{
+		const std::string iso{ "2024-10-23T15:30:45.1234567Z" };
+
+		for ( auto _ : state )
+		{
+			DateTime dt;
+			auto parsed{ DateTime::parse<"%FT%T.%fZ">( iso, dt ) };
+			::benchmark::DoNotOptimize( parsed );
+			::benchmark::DoNotOptimize( dt );
+		}
+	}
+
+	/** @brief Same input as BM_DateTime_Parse_NonCanonical */
+	static void BM_DateTime_ParsePattern_Offset( ::benchmark::State& state )
+	{
+		const std::string iso{ "2024-10-23T15:30:45+02:00" };
+
+		for ( auto _ : state )
+		{
+			DateTime dt;
+			auto parsed{ DateTime::parse<"%FT%T%z">( iso, dt ) };
+			::benchmark::DoNotOptimize( parsed );
+			::benchmark::DoNotOptimize( dt );
+		}
+	}
+
+	/** @brief Apache common log timestamp, a layout fromString() cannot read */
+	static void BM_DateTime_ParsePattern_CommonLog( ::benchmark::State& state )
+	{
+		const std::string log{ "23/Oct/2024:15:30:45 +0200" };
+
+		for ( auto _ : state )
+		{
+			DateTime dt;
+			auto parsed{ DateTime::parse<"%d/%b/%Y:%H:%M:%S %z">( log, dt ) };
+			::benchmark::DoNotOptimize( parsed );
+			::benchmark::DoNotOptimize( dt );
+		}
+	}
+
 	//----------------------------------------------
 	// Formatting
 	//----------------------------------------------
@@ -129,6 +245,85 @@ namespace nfx::time::benchmark
 		}
 	}
 
+	static void BM_DateTime_ToChars_ISO8601( ::benchmark::State& state )
+	{
+		auto dt{ DateTime::utcNow() };
+		char buffer[constants::MAX_ISO8601_LENGTH];
+
+		for ( auto _ : state )
+		{
+			auto result{ dt.toChars( buffer, buffer + sizeof( buffer ) ) };
+			::benchmark::DoNotOptimize( result );
+			::benchmark::ClobberMemory();
+		}
+	}
+
+	static void BM_DateTime_ToChars_Iso8601Extended( ::benchmark::State& state )
+	{
+		auto dt{ DateTime::utcNow() };
+		char buffer[constants::MAX_ISO8601_LENGTH];
+
+		for ( auto _ : state )
+		{
+			auto result{ dt.toChars( buffer, buffer + sizeof( buffer ), DateTime::Format::Iso8601Extended ) };
+			::benchmark::DoNotOptimize( result );
+			::benchmark::ClobberMemory();
+		}
+	}
+
+	static void BM_DateTime_ToFixedString_Iso8601Extended( ::benchmark::State& state )
+	{
+		auto dt{ DateTime::utcNow() };
+
+		for ( auto _ : state )
+		{
+			auto text{ dt.toFixedString( DateTime::Format::Iso8601Extended ) };
+			::benchmark::DoNotOptimize( text );
+		}
+	}
+
+	static void BM_DateTime_FormatTo_Default( ::benchmark::State& state )
+	{
+		auto dt{ DateTime::utcNow() };
+		std::string line;
+		line.reserve( 64 );
+
+		for ( auto _ : state )
+		{
+			line.clear();
+			std::format_to( std::back_inserter( line ), "{}", dt );
+			::benchmark::DoNotOptimize( line.data() );
+		}
+	}
+
+	static void BM_DateTime_FormatTo_Extended( ::benchmark::State& state )
+	{
+		auto dt{ DateTime::utcNow() };
+		std::string line;
+		line.reserve( 64 );
+
+		for ( auto _ : state )
+		{
+			line.clear();
+			std::format_to( std::back_inserter( line ), "{:ext}", dt );
+			::benchmark::DoNotOptimize( line.data() );
+		}
+	}
+
+	static void BM_DateTime_FormatTo_Pattern( ::benchmark::State& state )
+	{
+		auto dt{ DateTime::utcNow() };
+		std::string line;
+		line.reserve( 64 );
+
+		for ( auto _ : state )
+		{
+			line.clear();
+			std::format_to( std::back_inserter( line ), "{:%Y-%m-%d %H:%M:%S}", dt );
+			::benchmark::DoNotOptimize( line.data() );
+		}
+	}
+
 	//----------------------------------------------
 	// Arithmetic
 	//----------------------------------------------
@@ -220,6 +415,132 @@ namespace nfx::time::benchmark
 		}
 	}
 
+	static void BM_DateTime_GetComponents_SinglePass( ::benchmark::State& state )
+	{
+		auto dt{ DateTime::utcNow() };
+
+		for ( auto _ : state )
+		{
+			auto c{ dt.components() };
+			::benchmark::DoNotOptimize( c );
+		}
+	}
+
+	/** @brief Spread of dates across the full 0001-9999 range to defeat branch prediction */
+	static std::vector<DateTime> spreadDates()
+	{
+		std::vector<DateTime> dates;
+		dates.reserve( 4096 );
+
+		const auto maxDays{ constants::MAX_DATETIME_TICKS / constants::TICKS_PER_DAY };
+		std::uint64_t state{ 0x9E3779B97F4A7C15ULL };
+		for ( std::size_t i{ 0 }; i < 4096; ++i )
+		{
+			state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+			const auto days{ static_cast<std::int64_t>( ( state >> 33 ) % static_cast<std::uint64_t>( maxDays + 1 ) ) };
+			dates.emplace_back( days * constants::TICKS_PER_DAY );
+		}
+
+		return dates;
+	}
+
+	/** @brief 4096 random dates within [firstYear, lastYear] */
+	static std::vector<DateTime> windowDates( std::int32_t firstYear, std::int32_t lastYear )
+	{
+		std::vector<DateTime> dates;
+		dates.reserve( 4096 );
+
+		const auto firstTicks{ DateTime{ firstYear, 1, 1 }.ticks() };
+		const auto dayCount{ ( DateTime{ lastYear, 12, 31 }.ticks() - firstTicks ) / constants::TICKS_PER_DAY + 1 };
+		std::uint64_t state{ 0x9E3779B97F4A7C15ULL };
+		for ( std::size_t i{ 0 }; i < 4096; ++i )
+		{
+			state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+			const auto days{ static_cast<std::int64_t>( ( state >> 33 ) % static_cast<std::uint64_t>( dayCount ) ) };
+			dates.emplace_back( firstTicks + days * constants::TICKS_PER_DAY );
+		}
+
+		return dates;
+	}
+
+	/** @brief Decompose year/month/day for each date in turn */
+	static void decomposeDates( ::benchmark::State& state, const std::vector<DateTime>& dates )
+	{
+		std::size_t i{ 0 };
+
+		for ( auto _ : state )
+		{
+			auto c{ dates[i++ & 4095].components() };
+			::benchmark::DoNotOptimize( c );
+		}
+	}
+
+	static void BM_DateTime_DecomposeDate_TableHot( ::benchmark::State& state )
+	{
+		// Dates within a single year: the touched table entries stay in L1
+		decomposeDates( state, windowDates( 2024, 2024 ) );
+	}
+
+	static void BM_DateTime_DecomposeDate_TableCold( ::benchmark::State& state )
+	{
+		// Dates across the whole default table window: table reads miss L1/L2
+		decomposeDates( state, windowDates( 1970, 2199 ) );
+	}
+
+	static void BM_DateTime_DecomposeDate_OutsideTable( ::benchmark::State& state )
+	{
+		// Dates outside the default table window: arithmetic fallback
+		decomposeDates( state, windowDates( 2300, 9999 ) );
+	}
+
+	static void BM_DateTime_DecomposeDate( ::benchmark::State& state )
+	{
+		const auto dates{ spreadDates() };
+		std::size_t i{ 0 };
+
+		for ( auto _ : state )
+		{
+			const auto& dt{ dates[i++ & 4095] };
+			auto y{ dt.year() };
+			auto m{ dt.month() };
+			auto d{ dt.day() };
+			::benchmark::DoNotOptimize( y );
+			::benchmark::DoNotOptimize( m );
+			::benchmark::DoNotOptimize( d );
+		}
+	}
+
+	static void BM_DateTime_DayOfYear( ::benchmark::State& state )
+	{
+		const auto dates{ spreadDates() };
+		std::size_t i{ 0 };
+
+		for ( auto _ : state )
+		{
+			auto doy{ dates[i++ & 4095].dayOfYear() };
+			::benchmark::DoNotOptimize( doy );
+		}
+	}
+
+	static void BM_DateTime_Construct_YMD_Spread( ::benchmark::State& state )
+	{
+		const auto dates{ spreadDates() };
+		std::vector<std::array<std::int32_t, 3>> ymd;
+		ymd.reserve( dates.size() );
+		for ( const auto& dt : dates )
+		{
+			ymd.push_back( { dt.year(), dt.month(), dt.day() } );
+		}
+		std::size_t i{ 0 };
+
+		for ( auto _ : state )
+		{
+			const auto& c{ ymd[i++ & 4095] };
+			auto dt{ DateTime{ c[0], c[1], c[2] } };
+			::benchmark::DoNotOptimize( dt );
+		}
+	}
+
 	//----------------------------------------------
 	// Comparison
 	//----------------------------------------------
@@ -248,6 +569,7 @@ namespace nfx::time::benchmark
 	BENCHMARK( BM_DateTime_Construct_YMDHMS );
 	BENCHMARK( BM_DateTime_Now );
 	BENCHMARK( BM_DateTime_UtcNow );
+	BENCHMARK( BM_DateTime_UtcNowCoarse );
 
 	//----------------------------------------------
 	// Parsing
@@ -255,6 +577,13 @@ namespace nfx::time::benchmark
 
 	BENCHMARK( BM_DateTime_Parse );
 	BENCHMARK( BM_DateTime_ParseExtended );
+	BENCHMARK( BM_DateTime_Parse_GeneralParser );
+	BENCHMARK( BM_DateTime_ParseExtended_GeneralParser );
+	BENCHMARK( BM_DateTime_Parse_NonCanonical );
+	BENCHMARK( BM_DateTime_ParsePattern );
+	BENCHMARK( BM_DateTime_ParsePatternExtended );
+	BENCHMARK( BM_DateTime_ParsePattern_Offset );
+	BENCHMARK( BM_DateTime_ParsePattern_CommonLog );
 
 	//----------------------------------------------
 	// Formatting
@@ -262,6 +591,12 @@ namespace nfx::time::benchmark
 
 	BENCHMARK( BM_DateTime_ToString_ISO8601 );
 	BENCHMARK( BM_DateTime_toIso8601Extended );
+	BENCHMARK( BM_DateTime_ToChars_ISO8601 );
+	BENCHMARK( BM_DateTime_ToChars_Iso8601Extended );
+	BENCHMARK( BM_DateTime_ToFixedString_Iso8601Extended );
+	BENCHMARK( BM_DateTime_FormatTo_Default );
+	BENCHMARK( BM_DateTime_FormatTo_Extended );
+	BENCHMARK( BM_DateTime_FormatTo_Pattern );
 
 	//----------------------------------------------
 	// Arithmetic
@@ -283,6 +618,13 @@ namespace nfx::time::benchmark
 	//----------------------------------------------
 
 	BENCHMARK( BM_DateTime_GetComponents );
+	BENCHMARK( BM_DateTime_GetComponents_SinglePass );
+	BENCHMARK( BM_DateTime_DecomposeDate );
+	BENCHMARK( BM_DateTime_DecomposeDate_TableHot );
+	BENCHMARK( BM_DateTime_DecomposeDate_TableCold );
+	BENCHMARK( BM_DateTime_DecomposeDate_OutsideTable );
+	BENCHMARK( BM_DateTime_DayOfYear );
+	BENCHMARK( BM_DateTime_Construct_YMD_Spread );
 
 	//----------------------------------------------
 	// Comparison
@@ -61,6 +61,24 @@ namespace nfx::time::benchmark
 		}
 	}
 
+	static void BM_DateTimeOffset_UtcNow( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			auto dto{ DateTimeOffset::utcNow() };
+			::benchmark::DoNotOptimize( dto );
+		}
+	}
+
+	static void BM_DateTimeOffset_UtcNowCoarse( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			auto dto{ DateTimeOffset::utcNowCoarse() };
+			::benchmark::DoNotOptimize( dto );
+		}
+	}
+
 	//----------------------------------------------
 	// Parsing
 	//----------------------------------------------
@@ -87,6 +105,17 @@ namespace nfx::time::benchmark
 		}
 	}
 
+	static void BM_DateTimeOffset_ParseCompactOffset( ::benchmark::State& state )
+	{
+		const std::string iso{ "2024-10-23T15:30:45.123-0800" };
+
+		for ( auto _ : state )
+		{
+			auto dto{ DateTimeOffset{ iso } };
+			::benchmark::DoNotOptimize( dto );
+		}
+	}
+
 	//----------------------------------------------
 	// Conversion
 	//----------------------------------------------
@@ -140,6 +169,41 @@ namespace nfx::time::benchmark
 		}
 	}
 
+	static void BM_DateTimeOffset_ToChars( ::benchmark::State& state )
+	{
+		auto dto{ DateTimeOffset::now() };
+		char buffer[constants::MAX_ISO8601_LENGTH];
+
+		for ( auto _ : state )
+		{
+			auto result{ dto.toChars( buffer, buffer + sizeof( buffer ), DateTime::Format::Iso8601Extended ) };
+			::benchmark::DoNotOptimize( result );
+			::benchmark::ClobberMemory();
+		}
+	}
+
+	static void BM_DateTimeOffset_ToString_Iso8601Extended( ::benchmark::State& state )
+	{
+		auto dto{ DateTimeOffset::now() };
+
+		for ( auto _ : state )
+		{
+			auto str{ dto.toString( DateTime::Format::Iso8601Extended ) };
+			::benchmark::DoNotOptimize( str );
+		}
+	}
+
+	static void BM_DateTimeOffset_ToFixedString_Iso8601Extended( ::benchmark::State& state )
+	{
+		auto dto{ DateTimeOffset::now() };
+
+		for ( auto _ : state )
+		{
+			auto text{ dto.toFixedString( DateTime::Format::Iso8601Extended ) };
+			::benchmark::DoNotOptimize( text );
+		}
+	}
+
 	//----------------------------------------------
 	// Arithmetic
 	//----------------------------------------------
@@ -194,6 +258,8 @@ namespace nfx::time::benchmark
 
 	BENCHMARK( BM_DateTimeOffset_Construct );
 	BENCHMARK( BM_DateTimeOffset_Now );
+	BENCHMARK( BM_DateTimeOffset_UtcNow );
+	BENCHMARK( BM_DateTimeOffset_UtcNowCoarse );
 
 	//----------------------------------------------
 	// Parsing
@@ -201,6 +267,7 @@ namespace nfx::time::benchmark
 
 	BENCHMARK( BM_DateTimeOffset_Parse );
 	BENCHMARK( BM_DateTimeOffset_ParseZ );
+	BENCHMARK( BM_DateTimeOffset_ParseCompactOffset );
 
 	//----------------------------------------------
 	// Conversion
@@ -215,6 +282,9 @@ namespace nfx::time::benchmark
 	//----------------------------------------------
 
 	BENCHMARK( BM_DateTimeOffset_ToString );
+	BENCHMARK( BM_DateTimeOffset_ToChars );
+	BENCHMARK( BM_DateTimeOffset_ToString_Iso8601Extended );
+	BENCHMARK( BM_DateTimeOffset_ToFixedString_Iso8601Extended );
 
 	//----------------------------------------------
 	// Arithmetic
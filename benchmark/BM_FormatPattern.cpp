@@ -0,0 +1,192 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_FormatPattern.cpp
+ * @brief Benchmark FormatPattern output against the toString() paths on the same values
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <iterator>
+#include <string>
+
+#include <nfx/datetime/FormatPattern.h>
+
+namespace nfx::time::benchmark
+{
+	//=====================================================================
+	// FormatPattern benchmark suite
+	//=====================================================================
+
+	/** @brief Value with a full seven-digit fraction, so %f matches Iso8601Extended */
+	static DateTime sampleDateTime()
+	{
+		return DateTime{ 2024, 10, 23, 15, 30, 45 } + TimeSpan{ 1234567 };
+	}
+
+	//----------------------------------------------
+	// DateTime
+	//----------------------------------------------
+
+	static void BM_FormatPattern_DateTime_Iso8601( ::benchmark::State& state )
+	{
+		static constexpr FormatPattern pattern{ "%FT%TZ" };
+		const auto dt{ sampleDateTime() };
+		char buffer[64];
+
+		for ( auto _ : state )
+		{
+			auto result{ pattern.format( dt, buffer, buffer + sizeof( buffer ) ) };
+			::benchmark::DoNotOptimize( result );
+			::benchmark::ClobberMemory();
+		}
+	}
+
+	static void BM_FormatPattern_DateTime_Iso8601_ToString( ::benchmark::State& state )
+	{
+		const auto dt{ sampleDateTime() };
+
+		for ( auto _ : state )
+		{
+			auto str{ dt.toString() };
+			::benchmark::DoNotOptimize( str );
+		}
+	}
+
+	static void BM_FormatPattern_DateTime_Extended( ::benchmark::State& state )
+	{
+		const FormatPattern pattern{ "%FT%T.%fZ" };
+		const auto dt{ sampleDateTime() };
+		char buffer[64];
+
+		for ( auto _ : state )
+		{
+			auto result{ pattern.format( dt, buffer, buffer + sizeof( buffer ) ) };
+			::benchmark::DoNotOptimize( result );
+			::benchmark::ClobberMemory();
+		}
+	}
+
+	static void BM_FormatPattern_DateTime_Extended_ToString( ::benchmark::State& state )
+	{
+		const auto dt{ sampleDateTime() };
+
+		for ( auto _ : state )
+		{
+			auto str{ dt.toIso8601Extended() };
+			::benchmark::DoNotOptimize( str );
+		}
+	}
+
+	/** @brief Output iterator into a reused string, the allocation-free std::string path */
+	static void BM_FormatPattern_DateTime_Extended_BackInserter( ::benchmark::State& state )
+	{
+		const FormatPattern pattern{ "%FT%T.%fZ" };
+		const auto dt{ sampleDateTime() };
+		std::string line;
+		line.reserve( pattern.maxLength() );
+
+		for ( auto _ : state )
+		{
+			line.clear();
+			pattern.format( dt, std::back_inserter( line ) );
+			::benchmark::DoNotOptimize( line );
+		}
+	}
+
+	//----------------------------------------------
+	// DateTimeOffset
+	//----------------------------------------------
+
+	static void BM_FormatPattern_DateTimeOffset( ::benchmark::State& state )
+	{
+		const FormatPattern pattern{ "%FT%T%z" };
+		const DateTimeOffset dto{ sampleDateTime(), TimeSpan::fromHours( 2 ) };
+		char buffer[64];
+
+		for ( auto _ : state )
+		{
+			auto result{ pattern.format( dto, buffer, buffer + sizeof( buffer ) ) };
+			::benchmark::DoNotOptimize( result );
+			::benchmark::ClobberMemory();
+		}
+	}
+
+	static void BM_FormatPattern_DateTimeOffset_ToString( ::benchmark::State& state )
+	{
+		const DateTimeOffset dto{ sampleDateTime(), TimeSpan::fromHours( 2 ) };
+
+		for ( auto _ : state )
+		{
+			auto str{ dto.toString() };
+			::benchmark::DoNotOptimize( str );
+		}
+	}
+
+	//----------------------------------------------
+	// TimeSpan
+	//----------------------------------------------
+
+	static void BM_FormatPattern_TimeSpan( ::benchmark::State& state )
+	{
+		const FormatPattern pattern{ "%d.%H:%M:%S.%f" };
+		const auto ts{ TimeSpan::fromHours( 50 ) + TimeSpan{ 1234567 } };
+		char buffer[64];
+
+		for ( auto _ : state )
+		{
+			auto result{ pattern.format( ts, buffer, buffer + sizeof( buffer ) ) };
+			::benchmark::DoNotOptimize( result );
+			::benchmark::ClobberMemory();
+		}
+	}
+
+	static void BM_FormatPattern_TimeSpan_ToString( ::benchmark::State& state )
+	{
+		const auto ts{ TimeSpan::fromHours( 50 ) + TimeSpan{ 1234567 } };
+
+		for ( auto _ : state )
+		{
+			auto str{ ts.toString() };
+			::benchmark::DoNotOptimize( str );
+		}
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	BENCHMARK( BM_FormatPattern_DateTime_Iso8601 );
+	BENCHMARK( BM_FormatPattern_DateTime_Iso8601_ToString );
+	BENCHMARK( BM_FormatPattern_DateTime_Extended );
+	BENCHMARK( BM_FormatPattern_DateTime_Extended_ToString );
+	BENCHMARK( BM_FormatPattern_DateTime_Extended_BackInserter );
+	BENCHMARK( BM_FormatPattern_DateTimeOffset );
+	BENCHMARK( BM_FormatPattern_DateTimeOffset_ToString );
+	BENCHMARK( BM_FormatPattern_TimeSpan );
+	BENCHMARK( BM_FormatPattern_TimeSpan_ToString );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,214 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_IncrementalTimestampParser.cpp
+ * @brief Benchmark the prefix-reusing IncrementalTimestampParser on sorted log timestamps
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <nfx/datetime/IncrementalTimestampParser.h>
+#include <nfx/datetime/TimestampParser.h>
+
+namespace nfx::time::benchmark
+{
+	//=====================================================================
+	// IncrementalTimestampParser benchmark suite
+	//=====================================================================
+
+	/** @brief Lines per benchmark iteration */
+	static constexpr std::size_t LOG_SIZE{ 65536 };
+
+	/**
+	 * @brief Sorted millisecond timestamps of a service log, e.g. "2024-06-15T23:59:58.123Z"
+	 * @details Lines arrive in bursts: most gaps are a few milliseconds, some are seconds and
+	 *          a few are minutes, so the log crosses minute, hour and day boundaries.
+	 */
+	static std::vector<std::string> sortedLog( std::string_view suffix )
+	{
+		std::vector<std::string> lines;
+		auto time{ DateTime{ 2024, 6, 15, 22, 30, 0 } };
+		std::uint32_t state{ 12345 };
+		for ( std::size_t i{ 0 }; i < LOG_SIZE; ++i )
+		{
+			state = state * 1664525u + 1013904223u;
+			const std::uint32_t roll{ state >> 24 };
+			const std::int64_t gapMilliseconds{ roll < 230 ? roll % 40 : roll < 254 ? 1000 + roll * 20 : 90000 };
+			time = time + TimeSpan::fromMilliseconds( static_cast<double>( gapMilliseconds ) );
+
+			auto text{ time.toString( DateTime::Format::Iso8601Extended ) };
+			text.resize( 23 );
+			text += suffix;
+			lines.push_back( std::move( text ) );
+		}
+
+		return lines;
+	}
+
+	//----------------------------------------------
+	// DateTime
+	//----------------------------------------------
+
+	static void BM_IncrementalTimestampParser_FromString_Utc( ::benchmark::State& state )
+	{
+		const auto lines{ sortedLog( "Z" ) };
+		DateTime value;
+
+		for ( auto _ : state )
+		{
+			for ( const auto& text : lines )
+			{
+				auto parsed{ DateTime::fromString( text, value ) };
+				::benchmark::DoNotOptimize( parsed );
+				::benchmark::DoNotOptimize( value );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * lines.size() ) );
+	}
+
+	static void BM_IncrementalTimestampParser_TimestampParser_Utc( ::benchmark::State& state )
+	{
+		const auto lines{ sortedLog( "Z" ) };
+		TimestampParser parser;
+		DateTime value;
+
+		for ( auto _ : state )
+		{
+			for ( const auto& text : lines )
+			{
+				parser.parse( text, value );
+				::benchmark::DoNotOptimize( value );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * lines.size() ) );
+	}
+
+	static void BM_IncrementalTimestampParser_Utc( ::benchmark::State& state )
+	{
+		const auto lines{ sortedLog( "Z" ) };
+		IncrementalTimestampParser parser;
+		DateTime value;
+
+		for ( auto _ : state )
+		{
+			for ( const auto& text : lines )
+			{
+				parser.parse( text, value );
+				::benchmark::DoNotOptimize( value );
+			}
+		}
+
+		const auto total{ static_cast<double>( parser.minuteHits() + parser.dayHits() + parser.misses() ) };
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * lines.size() ) );
+		state.counters["minute_hits"] = static_cast<double>( parser.minuteHits() ) / total;
+		state.counters["day_hits"] = static_cast<double>( parser.dayHits() ) / total;
+	}
+
+	//----------------------------------------------
+	// DateTimeOffset
+	//----------------------------------------------
+
+	static void BM_IncrementalTimestampParser_FromString_Offset( ::benchmark::State& state )
+	{
+		const auto lines{ sortedLog( "+02:00" ) };
+		DateTimeOffset value;
+
+		for ( auto _ : state )
+		{
+			for ( const auto& text : lines )
+			{
+				auto parsed{ DateTimeOffset::fromString( text, value ) };
+				::benchmark::DoNotOptimize( parsed );
+				::benchmark::DoNotOptimize( value );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * lines.size() ) );
+	}
+
+	static void BM_IncrementalTimestampParser_TimestampParser_Offset( ::benchmark::State& state )
+	{
+		const auto lines{ sortedLog( "+02:00" ) };
+		TimestampParser parser;
+		DateTimeOffset value;
+
+		for ( auto _ : state )
+		{
+			for ( const auto& text : lines )
+			{
+				parser.parse( text, value );
+				::benchmark::DoNotOptimize( value );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * lines.size() ) );
+	}
+
+	static void BM_IncrementalTimestampParser_Offset( ::benchmark::State& state )
+	{
+		const auto lines{ sortedLog( "+02:00" ) };
+		IncrementalTimestampParser parser;
+		DateTimeOffset value;
+
+		for ( auto _ : state )
+		{
+			for ( const auto& text : lines )
+			{
+				parser.parse( text, value );
+				::benchmark::DoNotOptimize( value );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * lines.size() ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------------------------
+	// DateTime
+	//----------------------------------------------
+
+	BENCHMARK( BM_IncrementalTimestampParser_FromString_Utc );
+	BENCHMARK( BM_IncrementalTimestampParser_TimestampParser_Utc );
+	BENCHMARK( BM_IncrementalTimestampParser_Utc );
+
+	//----------------------------------------------
+	// DateTimeOffset
+	//----------------------------------------------
+
+	BENCHMARK( BM_IncrementalTimestampParser_FromString_Offset );
+	BENCHMARK( BM_IncrementalTimestampParser_TimestampParser_Offset );
+	BENCHMARK( BM_IncrementalTimestampParser_Offset );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
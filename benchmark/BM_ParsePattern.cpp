@@ -0,0 +1,128 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_ParsePattern.cpp
+ * @brief Benchmark run-time compiled ParsePattern against compile-time patterns and fromString()
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <nfx/datetime/ParsePattern.h>
+
+namespace nfx::time::benchmark
+{
+	//=====================================================================
+	// ParsePattern benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// ISO 8601 layout
+	//----------------------------------------------
+
+	static void BM_ParsePattern_Iso8601( ::benchmark::State& state )
+	{
+		const ParsePattern pattern{ "%FT%T.%f%z" };
+		const std::string input{ "2024-10-23T15:30:45.1234567+02:00" };
+
+		for ( auto _ : state )
+		{
+			DateTimeOffset value;
+			auto parsed{ pattern.parse( input, value ) };
+			::benchmark::DoNotOptimize( parsed );
+			::benchmark::DoNotOptimize( value );
+		}
+	}
+
+	static void BM_ParsePattern_Iso8601_CompileTime( ::benchmark::State& state )
+	{
+		const std::string input{ "2024-10-23T15:30:45.1234567+02:00" };
+
+		for ( auto _ : state )
+		{
+			DateTimeOffset value;
+			auto parsed{ DateTimeOffset::parse<"%FT%T.%f%z">( input, value ) };
+			::benchmark::DoNotOptimize( parsed );
+			::benchmark::DoNotOptimize( value );
+		}
+	}
+
+	static void BM_ParsePattern_Iso8601_FromString( ::benchmark::State& state )
+	{
+		const std::string input{ "2024-10-23T15:30:45.1234567+02:00" };
+
+		for ( auto _ : state )
+		{
+			DateTimeOffset value;
+			auto parsed{ DateTimeOffset::fromString( input, value ) };
+			::benchmark::DoNotOptimize( parsed );
+			::benchmark::DoNotOptimize( value );
+		}
+	}
+
+	//----------------------------------------------
+	// Apache common log layout
+	//----------------------------------------------
+
+	static void BM_ParsePattern_CommonLog( ::benchmark::State& state )
+	{
+		const ParsePattern pattern{ "%d/%b/%Y:%H:%M:%S %z" };
+		const std::string input{ "23/Oct/2024:15:30:45 +0200" };
+
+		for ( auto _ : state )
+		{
+			DateTimeOffset value;
+			auto parsed{ pattern.parse( input, value ) };
+			::benchmark::DoNotOptimize( parsed );
+			::benchmark::DoNotOptimize( value );
+		}
+	}
+
+	static void BM_ParsePattern_CommonLog_CompileTime( ::benchmark::State& state )
+	{
+		const std::string input{ "23/Oct/2024:15:30:45 +0200" };
+
+		for ( auto _ : state )
+		{
+			DateTimeOffset value;
+			auto parsed{ DateTimeOffset::parse<"%d/%b/%Y:%H:%M:%S %z">( input, value ) };
+			::benchmark::DoNotOptimize( parsed );
+			::benchmark::DoNotOptimize( value );
+		}
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	BENCHMARK( BM_ParsePattern_Iso8601 );
+	BENCHMARK( BM_ParsePattern_Iso8601_CompileTime );
+	BENCHMARK( BM_ParsePattern_Iso8601_FromString );
+	BENCHMARK( BM_ParsePattern_CommonLog );
+	BENCHMARK( BM_ParsePattern_CommonLog_CompileTime );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
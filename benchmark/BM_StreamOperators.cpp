@@ -0,0 +1,266 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_StreamOperators.cpp
+ * @brief Benchmark the stream operators of DateTime, DateTimeOffset and TimeSpan through std::stringstream
+ * @details Every benchmark streams STREAM_VALUE_COUNT values per iteration and reports the heap
+ *          allocations per value, counted by replacing the global operator new in this
+ *          executable. The *_ViaString variants reproduce the previous operators, which went
+ *          through toString() and `is >> std::string`.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <nfx/datetime/DateTimeOffset.h>
+
+//=====================================================================
+// Allocation counting
+//=====================================================================
+
+namespace
+{
+	/** @brief Calls to the global operator new since program start */
+	std::size_t g_allocationCount{ 0 };
+} // namespace
+
+// The replacement operators below are a matching malloc/free pair, but once operator delete is
+// inlined GCC only sees free() applied to the result of operator new
+#if defined( __GNUC__ ) && !defined( __clang__ ) && __GNUC__ >= 11
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new( std::size_t size )
+{
+	++g_allocationCount;
+	if ( void* p{ std::malloc( size == 0 ? 1 : size ) } )
+	{
+		return p;
+	}
+
+	throw std::bad_alloc{};
+}
+
+void operator delete( void* p ) noexcept
+{
+	std::free( p );
+}
+
+void operator delete( void* p, std::size_t ) noexcept
+{
+	std::free( p );
+}
+
+#if defined( __GNUC__ ) && !defined( __clang__ ) && __GNUC__ >= 11
+#	pragma GCC diagnostic pop
+#endif
+
+namespace nfx::time::benchmark
+{
+	//=====================================================================
+	// Stream operators benchmark suite
+	//=====================================================================
+
+	/** @brief Values streamed per benchmark iteration */
+	static constexpr std::size_t STREAM_VALUE_COUNT{ 10'000'000 };
+
+	/** @brief Values written before the stream is read back and rewound */
+	static constexpr std::size_t STREAM_BATCH_SIZE{ 4096 };
+
+	/** @brief Distinct sample values, cycled through */
+	template <typename T>
+	static std::vector<T> samples();
+
+	template <>
+	std::vector<DateTime> samples<DateTime>()
+	{
+		std::vector<DateTime> values;
+		for ( std::size_t i{ 0 }; i < STREAM_BATCH_SIZE; ++i )
+		{
+			values.push_back( DateTime{ 2024, 6, 15 } + TimeSpan{ static_cast<std::int64_t>( i ) * 7919 * constants::TICKS_PER_SECOND } );
+		}
+
+		return values;
+	}
+
+	template <>
+	std::vector<DateTimeOffset> samples<DateTimeOffset>()
+	{
+		std::vector<DateTimeOffset> values;
+		for ( const auto& dateTime : samples<DateTime>() )
+		{
+			values.push_back( DateTimeOffset{ dateTime, TimeSpan::fromMinutes( static_cast<double>( ( dateTime.second() % 29 - 14 ) * 30 ) ) } );
+		}
+
+		return values;
+	}
+
+	template <>
+	std::vector<TimeSpan> samples<TimeSpan>()
+	{
+		std::vector<TimeSpan> values;
+		for ( std::size_t i{ 0 }; i < STREAM_BATCH_SIZE; ++i )
+		{
+			values.push_back( TimeSpan{ static_cast<std::int64_t>( i ) * 104729 * constants::TICKS_PER_SECOND } );
+		}
+
+		return values;
+	}
+
+	/** @brief Previous operator<<: a temporary std::string per value */
+	template <typename T>
+	static void writeViaString( std::ostream& os, const T& value )
+	{
+		os << value.toString();
+	}
+
+	/** @brief Previous operator>>: `is >> std::string`, then fromString() */
+	template <typename T>
+	static void readViaString( std::istream& is, T& value )
+	{
+		std::string str;
+		is >> str;
+		if ( !T::fromString( str, value ) )
+		{
+			is.setstate( std::ios::failbit );
+		}
+	}
+
+	/**
+	 * @brief Write STREAM_VALUE_COUNT values to a stringstream and read them back, in batches
+	 * @param viaString Use the previous string-based operators
+	 */
+	template <typename T>
+	static void streamRoundTrip( ::benchmark::State& state, bool viaString )
+	{
+		const auto values{ samples<T>() };
+		std::stringstream stream;
+		T parsed;
+		std::size_t allocations{ 0 };
+
+		for ( auto _ : state )
+		{
+			const std::size_t allocationsBefore{ g_allocationCount };
+			for ( std::size_t done{ 0 }; done < STREAM_VALUE_COUNT; done += values.size() )
+			{
+				stream.clear();
+				stream.seekp( 0 );
+				stream.seekg( 0 );
+				for ( const auto& value : values )
+				{
+					if ( viaString )
+					{
+						writeViaString( stream, value );
+					}
+					else
+					{
+						stream << value;
+					}
+					stream << '\n';
+				}
+				for ( std::size_t i{ 0 }; i < values.size(); ++i )
+				{
+					if ( viaString )
+					{
+						readViaString( stream, parsed );
+					}
+					else
+					{
+						stream >> parsed;
+					}
+					::benchmark::DoNotOptimize( parsed );
+				}
+			}
+			allocations += g_allocationCount - allocationsBefore;
+		}
+
+		const auto valueCount{ static_cast<std::int64_t>( state.iterations() * STREAM_VALUE_COUNT ) };
+		state.SetItemsProcessed( valueCount );
+		state.counters["allocs_per_value"] = static_cast<double>( allocations ) / static_cast<double>( valueCount );
+	}
+
+	//----------------------------------------------
+	// DateTime
+	//----------------------------------------------
+
+	static void BM_StreamOperators_DateTime_ViaString( ::benchmark::State& state )
+	{
+		streamRoundTrip<DateTime>( state, true );
+	}
+
+	static void BM_StreamOperators_DateTime( ::benchmark::State& state )
+	{
+		streamRoundTrip<DateTime>( state, false );
+	}
+
+	//----------------------------------------------
+	// DateTimeOffset
+	//----------------------------------------------
+
+	static void BM_StreamOperators_DateTimeOffset_ViaString( ::benchmark::State& state )
+	{
+		streamRoundTrip<DateTimeOffset>( state, true );
+	}
+
+	static void BM_StreamOperators_DateTimeOffset( ::benchmark::State& state )
+	{
+		streamRoundTrip<DateTimeOffset>( state, false );
+	}
+
+	//----------------------------------------------
+	// TimeSpan
+	//----------------------------------------------
+
+	static void BM_StreamOperators_TimeSpan_ViaString( ::benchmark::State& state )
+	{
+		streamRoundTrip<TimeSpan>( state, true );
+	}
+
+	static void BM_StreamOperators_TimeSpan( ::benchmark::State& state )
+	{
+		streamRoundTrip<TimeSpan>( state, false );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	BENCHMARK( BM_StreamOperators_DateTime_ViaString )->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_StreamOperators_DateTime )->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_StreamOperators_DateTimeOffset_ViaString )->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_StreamOperators_DateTimeOffset )->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_StreamOperators_TimeSpan_ViaString )->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_StreamOperators_TimeSpan )->Unit( ::benchmark::kMillisecond );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
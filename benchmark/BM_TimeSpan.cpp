@@ -29,6 +29,9 @@
 
 #include <benchmark/benchmark.h>
 
+#include <string>
+#include <vector>
+
 #include <nfx/datetime/TimeSpan.h>
 
 namespace nfx::time::benchmark
@@ -103,6 +106,27 @@ namespace nfx::time::benchmark
 		}
 	}
 
+	static void BM_TimeSpan_ParseISOCorpus( ::benchmark::State& state )
+	{
+		// Mix of SLA, timeout and retention durations as found in service configuration
+		const std::vector<std::string> corpus{
+			"PT30S", "PT5M", "PT1H", "PT0.25S", "P1D", "PT15M30S", "P7D", "PT2H30M",
+			"PT0.0005S", "P30DT12H", "PT1.5H", "-PT10M", "P1DT0.5S", "PT99H59M59.9999999S",
+			"P365D", "PT0.250S", "PT3M20.125S", "P2DT3H4M5.6789S" };
+
+		std::size_t index{ 0 };
+		for ( auto _ : state )
+		{
+			TimeSpan ts;
+			auto parsed{ TimeSpan::fromString( corpus[index], ts ) };
+			::benchmark::DoNotOptimize( parsed );
+			::benchmark::DoNotOptimize( ts );
+			index = index + 1 == corpus.size() ? 0 : index + 1;
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) );
+	}
+
 	static void BM_TimeSpan_Parse( ::benchmark::State& state )
 	{
 		const std::string duration{ "3600.5" };
@@ -129,6 +153,17 @@ namespace nfx::time::benchmark
 		}
 	}
 
+	static void BM_TimeSpan_ToFixedString_ISO8601( ::benchmark::State& state )
+	{
+		auto ts{ TimeSpan::fromHours( 25.5 ) };
+
+		for ( auto _ : state )
+		{
+			auto text{ ts.toFixedString() };
+			::benchmark::DoNotOptimize( text );
+		}
+	}
+
 	//----------------------------------------------
 	// Arithmetic
 	//----------------------------------------------
@@ -237,6 +272,7 @@ namespace nfx::time::benchmark
 
 	BENCHMARK( BM_TimeSpan_ParseISO );
 	BENCHMARK( BM_TimeSpan_ParseISOComplex );
+	BENCHMARK( BM_TimeSpan_ParseISOCorpus );
 	BENCHMARK( BM_TimeSpan_Parse );
 
 	//----------------------------------------------
@@ -244,6 +280,7 @@ namespace nfx::time::benchmark
 	//----------------------------------------------
 
 	BENCHMARK( BM_TimeSpan_ToString_ISO8601 );
+	BENCHMARK( BM_TimeSpan_ToFixedString_ISO8601 );
 
 	//----------------------------------------------
 	// Arithmetic
@@ -0,0 +1,201 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_TimestampParser.cpp
+ * @brief Benchmark the layout-learning TimestampParser against the stateless fromString() parsers
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <nfx/datetime/TimestampParser.h>
+
+namespace nfx::time::benchmark
+{
+	//=====================================================================
+	// TimestampParser benchmark suite
+	//=====================================================================
+
+	/** @brief Strings per benchmark iteration */
+	static constexpr std::size_t FEED_SIZE{ 4096 };
+
+	/** @brief Feed of consecutive timestamps sharing one layout, e.g. "2024-06-15T13:45:30.123+05:30" */
+	static std::vector<std::string> feed( std::string_view suffix )
+	{
+		std::vector<std::string> strings;
+		auto time{ DateTime{ 2024, 6, 15 } };
+		for ( std::size_t i{ 0 }; i < FEED_SIZE; ++i )
+		{
+			time = time + TimeSpan{ 7654321 };
+			auto text{ time.toString( DateTime::Format::Iso8601Extended ) };
+			text.resize( 23 );
+			text += suffix;
+			strings.push_back( std::move( text ) );
+		}
+
+		return strings;
+	}
+
+	//----------------------------------------------
+	// DateTimeOffset
+	//----------------------------------------------
+
+	static void BM_TimestampParser_FromString_Offset( ::benchmark::State& state )
+	{
+		const auto strings{ feed( "+05:30" ) };
+		DateTimeOffset value;
+
+		for ( auto _ : state )
+		{
+			for ( const auto& text : strings )
+			{
+				auto parsed{ DateTimeOffset::fromString( text, value ) };
+				::benchmark::DoNotOptimize( parsed );
+				::benchmark::DoNotOptimize( value );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * strings.size() ) );
+	}
+
+	static void BM_TimestampParser_Offset( ::benchmark::State& state )
+	{
+		const auto strings{ feed( "+05:30" ) };
+		TimestampParser parser;
+		DateTimeOffset value;
+
+		for ( auto _ : state )
+		{
+			for ( const auto& text : strings )
+			{
+				parser.parse( text, value );
+				::benchmark::DoNotOptimize( value );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * strings.size() ) );
+		state.counters["hit_rate"] = static_cast<double>( parser.hits() ) / static_cast<double>( parser.hits() + parser.misses() );
+	}
+
+	static void BM_TimestampParser_FromString_CompactOffset( ::benchmark::State& state )
+	{
+		const auto strings{ feed( "-0800" ) };
+		DateTimeOffset value;
+
+		for ( auto _ : state )
+		{
+			for ( const auto& text : strings )
+			{
+				auto parsed{ DateTimeOffset::fromString( text, value ) };
+				::benchmark::DoNotOptimize( parsed );
+				::benchmark::DoNotOptimize( value );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * strings.size() ) );
+	}
+
+	static void BM_TimestampParser_CompactOffset( ::benchmark::State& state )
+	{
+		const auto strings{ feed( "-0800" ) };
+		TimestampParser parser;
+		DateTimeOffset value;
+
+		for ( auto _ : state )
+		{
+			for ( const auto& text : strings )
+			{
+				parser.parse( text, value );
+				::benchmark::DoNotOptimize( value );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * strings.size() ) );
+	}
+
+	//----------------------------------------------
+	// DateTime
+	//----------------------------------------------
+
+	static void BM_TimestampParser_FromString_Utc( ::benchmark::State& state )
+	{
+		const auto strings{ feed( "Z" ) };
+		DateTime value;
+
+		for ( auto _ : state )
+		{
+			for ( const auto& text : strings )
+			{
+				auto parsed{ DateTime::fromString( text, value ) };
+				::benchmark::DoNotOptimize( parsed );
+				::benchmark::DoNotOptimize( value );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * strings.size() ) );
+	}
+
+	static void BM_TimestampParser_Utc( ::benchmark::State& state )
+	{
+		const auto strings{ feed( "Z" ) };
+		TimestampParser parser;
+		DateTime value;
+
+		for ( auto _ : state )
+		{
+			for ( const auto& text : strings )
+			{
+				parser.parse( text, value );
+				::benchmark::DoNotOptimize( value );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * strings.size() ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------------------------
+	// DateTimeOffset
+	//----------------------------------------------
+
+	BENCHMARK( BM_TimestampParser_FromString_Offset );
+	BENCHMARK( BM_TimestampParser_Offset );
+	BENCHMARK( BM_TimestampParser_FromString_CompactOffset );
+	BENCHMARK( BM_TimestampParser_CompactOffset );
+
+	//----------------------------------------------
+	// DateTime
+	//----------------------------------------------
+
+	BENCHMARK( BM_TimestampParser_FromString_Utc );
+	BENCHMARK( BM_TimestampParser_Utc );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
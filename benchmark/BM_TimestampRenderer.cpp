@@ -0,0 +1,172 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_TimestampRenderer.cpp
+ * @brief Benchmark the prefix-caching TimestampRenderer on log-style timestamp streams
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <nfx/datetime/TimestampRenderer.h>
+
+namespace nfx::time::benchmark
+{
+	//=====================================================================
+	// TimestampRenderer benchmark suite
+	//=====================================================================
+
+	/** @brief Stamps per benchmark iteration */
+	static constexpr std::size_t LOG_SIZE{ 65536 };
+
+	/**
+	 * @brief Sorted tick-precision stamps of a busy logger
+	 * @details Most gaps are a few microseconds to tens of milliseconds, some are seconds, so
+	 *          the stream crosses second and minute boundaries at a realistic rate.
+	 */
+	static std::vector<DateTime> sortedStamps()
+	{
+		std::vector<DateTime> stamps;
+		auto time{ DateTime{ 2024, 6, 15, 22, 30, 0 } };
+		std::uint32_t state{ 12345 };
+		for ( std::size_t i{ 0 }; i < LOG_SIZE; ++i )
+		{
+			state = state * 1664525u + 1013904223u;
+			const std::uint32_t roll{ state >> 24 };
+			const std::int64_t gapTicks{ roll < 250 ? ( state >> 8 ) % 400000 : 15000000 };
+			time = time + TimeSpan{ gapTicks };
+			stamps.push_back( time );
+		}
+
+		return stamps;
+	}
+
+	//----------------------------------------------
+	// Recorded stamps
+	//----------------------------------------------
+
+	static void BM_TimestampRenderer_ToIso8601Extended( ::benchmark::State& state )
+	{
+		const auto stamps{ sortedStamps() };
+
+		for ( auto _ : state )
+		{
+			for ( const auto& stamp : stamps )
+			{
+				auto text{ stamp.toIso8601Extended() };
+				::benchmark::DoNotOptimize( text );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * stamps.size() ) );
+	}
+
+	static void BM_TimestampRenderer_ToChars( ::benchmark::State& state )
+	{
+		const auto stamps{ sortedStamps() };
+		char buffer[TimestampRenderer::MAX_LENGTH];
+
+		for ( auto _ : state )
+		{
+			for ( const auto& stamp : stamps )
+			{
+				auto result{ stamp.toChars( buffer, buffer + sizeof( buffer ), DateTime::Format::Iso8601Extended ) };
+				::benchmark::DoNotOptimize( result );
+				::benchmark::ClobberMemory();
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * stamps.size() ) );
+	}
+
+	static void BM_TimestampRenderer_Render( ::benchmark::State& state )
+	{
+		const auto stamps{ sortedStamps() };
+		TimestampRenderer renderer{ static_cast<TimestampRenderer::Granularity>( state.range( 0 ) ) };
+		char buffer[TimestampRenderer::MAX_LENGTH];
+
+		for ( auto _ : state )
+		{
+			for ( const auto& stamp : stamps )
+			{
+				auto result{ renderer.render( stamp, buffer, buffer + sizeof( buffer ) ) };
+				::benchmark::DoNotOptimize( result );
+				::benchmark::ClobberMemory();
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * stamps.size() ) );
+		state.counters["hit_rate"] = static_cast<double>( renderer.hits() ) / static_cast<double>( renderer.hits() + renderer.misses() );
+	}
+
+	//----------------------------------------------
+	// Current time
+	//----------------------------------------------
+
+	static void BM_TimestampRenderer_UtcNowToIso8601Extended( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			auto text{ DateTime::utcNow().toIso8601Extended() };
+			::benchmark::DoNotOptimize( text );
+		}
+	}
+
+	static void BM_TimestampRenderer_RenderNow( ::benchmark::State& state )
+	{
+		TimestampRenderer renderer;
+		char buffer[TimestampRenderer::MAX_LENGTH];
+
+		for ( auto _ : state )
+		{
+			auto result{ renderer.renderNow( buffer, buffer + sizeof( buffer ) ) };
+			::benchmark::DoNotOptimize( result );
+			::benchmark::ClobberMemory();
+		}
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------------------------
+	// Recorded stamps
+	//----------------------------------------------
+
+	BENCHMARK( BM_TimestampRenderer_ToIso8601Extended );
+	BENCHMARK( BM_TimestampRenderer_ToChars );
+	BENCHMARK( BM_TimestampRenderer_Render )->ArgName( "granularity" )->Arg( 0 )->Arg( 1 );
+
+	//----------------------------------------------
+	// Current time
+	//----------------------------------------------
+
+	BENCHMARK( BM_TimestampRenderer_UtcNowToIso8601Extended );
+	BENCHMARK( BM_TimestampRenderer_RenderNow );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,230 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_TimestampScanner.cpp
+ * @brief Benchmark streaming timestamp extraction from CSV and NDJSON buffers (bytes/s and lines/s)
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/datetime/Batch.h>
+#include <nfx/datetime/TimestampScanner.h>
+
+namespace nfx::time::benchmark
+{
+	//=====================================================================
+	// TimestampScanner benchmark suite
+	//=====================================================================
+
+	/** @brief Lines per benchmark buffer */
+	static constexpr std::size_t SCANNER_LINES{ 1 << 18 };
+
+	/** @brief Chunk size for the incremental benchmarks */
+	static constexpr std::size_t SCANNER_CHUNK_BYTES{ 64 * 1024 };
+
+	/** @brief Log-like CSV: id, host, timestamp, latency, message */
+	static std::string csvBuffer()
+	{
+		std::string buffer;
+		auto time{ DateTime{ 2024, 6, 15 } };
+		for ( std::size_t i{ 0 }; i < SCANNER_LINES; ++i )
+		{
+			time = time + TimeSpan{ 12345671 };
+			buffer += std::to_string( i );
+			buffer += ",web-";
+			buffer += std::to_string( i % 17 );
+			buffer += ',';
+			buffer += time.toString( DateTime::Format::Iso8601Extended );
+			buffer += ',';
+			buffer += std::to_string( i % 997 );
+			buffer += ",GET /api/v1/items served\n";
+		}
+
+		return buffer;
+	}
+
+	/** @brief Log-like NDJSON with the timestamp in the middle of each object */
+	static std::string ndjsonBuffer()
+	{
+		std::string buffer;
+		auto time{ DateTime{ 2024, 6, 15 } };
+		for ( std::size_t i{ 0 }; i < SCANNER_LINES; ++i )
+		{
+			time = time + TimeSpan{ 12345671 };
+			buffer += R"({"level":"info","host":"web-)";
+			buffer += std::to_string( i % 17 );
+			buffer += R"(","time":")";
+			buffer += time.toString( DateTime::Format::Iso8601Extended );
+			buffer += R"(","latency_ms":)";
+			buffer += std::to_string( i % 997 );
+			buffer += R"(,"msg":"GET /api/v1/items served"})";
+			buffer += '\n';
+		}
+
+		return buffer;
+	}
+
+	static void setThroughput( ::benchmark::State& state, const std::string& buffer )
+	{
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * SCANNER_LINES ) );
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() * buffer.size() ) );
+	}
+
+	//----------------------------------------------
+	// CSV
+	//----------------------------------------------
+
+	/** @brief Baseline: split lines and fields by hand, then DateTime::fromString per line */
+	static void BM_TimestampScanner_Csv_ManualSplit( ::benchmark::State& state )
+	{
+		const auto buffer{ csvBuffer() };
+		std::vector<DateTime> values;
+		values.reserve( SCANNER_LINES );
+
+		for ( auto _ : state )
+		{
+			values.clear();
+			std::string_view rest{ buffer };
+			while ( !rest.empty() )
+			{
+				const auto newline{ rest.find( '\n' ) };
+				auto line{ rest.substr( 0, newline ) };
+				rest.remove_prefix( newline == std::string_view::npos ? rest.size() : newline + 1 );
+
+				for ( int column{ 0 }; column < 2; ++column )
+				{
+					line.remove_prefix( std::min( line.find( ',' ), line.size() - 1 ) + 1 );
+				}
+				DateTime value;
+				if ( DateTime::fromString( line.substr( 0, line.find( ',' ) ), value ) )
+				{
+					values.push_back( value );
+				}
+			}
+			::benchmark::DoNotOptimize( values.data() );
+		}
+
+		setThroughput( state, buffer );
+	}
+
+	static void BM_TimestampScanner_Csv( ::benchmark::State& state )
+	{
+		const auto requested{ static_cast<batch::SimdLevel>( state.range( 0 ) ) };
+		if ( batch::setSimdLevel( requested ) != requested )
+		{
+			state.SkipWithError( "SIMD level not supported on this host" );
+			batch::setSimdLevel( batch::supportedSimdLevel() );
+
+			return;
+		}
+
+		const auto buffer{ csvBuffer() };
+		auto scanner{ TimestampScanner::csv( 2 ) };
+		std::vector<TimestampScanner::Record> records;
+		records.reserve( SCANNER_LINES );
+
+		for ( auto _ : state )
+		{
+			records.clear();
+			scanner.scan( buffer, records );
+			::benchmark::DoNotOptimize( records.data() );
+		}
+
+		setThroughput( state, buffer );
+		batch::setSimdLevel( batch::supportedSimdLevel() );
+	}
+
+	static void BM_TimestampScanner_Csv_Chunked( ::benchmark::State& state )
+	{
+		const auto buffer{ csvBuffer() };
+		const std::string_view input{ buffer };
+		auto scanner{ TimestampScanner::csv( 2 ) };
+		std::vector<TimestampScanner::Record> records;
+		records.reserve( SCANNER_LINES );
+
+		for ( auto _ : state )
+		{
+			records.clear();
+			for ( std::size_t offset{ 0 }; offset < input.size(); offset += SCANNER_CHUNK_BYTES )
+			{
+				scanner.feed( input.substr( offset, SCANNER_CHUNK_BYTES ), records );
+			}
+			scanner.finish( records );
+			::benchmark::DoNotOptimize( records.data() );
+		}
+
+		setThroughput( state, buffer );
+	}
+
+	//----------------------------------------------
+	// NDJSON
+	//----------------------------------------------
+
+	static void BM_TimestampScanner_Ndjson( ::benchmark::State& state )
+	{
+		const auto buffer{ ndjsonBuffer() };
+		auto scanner{ TimestampScanner::ndjson( "time" ) };
+		std::vector<TimestampScanner::Record> records;
+		records.reserve( SCANNER_LINES );
+
+		for ( auto _ : state )
+		{
+			records.clear();
+			scanner.scan( buffer, records );
+			::benchmark::DoNotOptimize( records.data() );
+		}
+
+		setThroughput( state, buffer );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------------------------
+	// CSV
+	//----------------------------------------------
+
+	BENCHMARK( BM_TimestampScanner_Csv_ManualSplit )->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_TimestampScanner_Csv )
+		->ArgName( "simd" )
+		->Arg( static_cast<std::int64_t>( batch::SimdLevel::Scalar ) )
+		->Arg( static_cast<std::int64_t>( batch::SimdLevel::Avx2 ) )
+		->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_TimestampScanner_Csv_Chunked )->Unit( ::benchmark::kMillisecond );
+
+	//----------------------------------------------
+	// NDJSON
+	//----------------------------------------------
+
+	BENCHMARK( BM_TimestampScanner_Ndjson )->Unit( ::benchmark::kMillisecond );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
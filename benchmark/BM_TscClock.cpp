@@ -0,0 +1,129 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_TscClock.cpp
+ * @brief Benchmark the TSC-calibrated clock against the system clock sources
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include <nfx/datetime/TscClock.h>
+
+namespace nfx::time::benchmark
+{
+	//=====================================================================
+	// TscClock benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Clock reads
+	//----------------------------------------------
+
+	static void BM_TscClock_NowTicks( ::benchmark::State& state )
+	{
+		TscClock& clock{ TscClock::shared() };
+		for ( auto _ : state )
+		{
+			auto ticks{ clock.nowTicks() };
+			::benchmark::DoNotOptimize( ticks );
+		}
+
+		state.counters["tsc"] = clock.isTscBacked() ? 1.0 : 0.0;
+		state.counters["frequency_mhz"] = clock.frequency() / 1e6;
+	}
+
+	static void BM_TscClock_Now( ::benchmark::State& state )
+	{
+		TscClock& clock{ TscClock::shared() };
+		for ( auto _ : state )
+		{
+			auto dt{ clock.now() };
+			::benchmark::DoNotOptimize( dt );
+		}
+	}
+
+	static void BM_TscClock_UtcNow( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			auto dt{ DateTime::utcNow() };
+			::benchmark::DoNotOptimize( dt );
+		}
+	}
+
+	static void BM_TscClock_UtcNowCoarse( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			auto dt{ DateTime::utcNowCoarse() };
+			::benchmark::DoNotOptimize( dt );
+		}
+	}
+
+	//----------------------------------------------
+	// Accuracy
+	//----------------------------------------------
+
+	/** @brief Read both clocks back to back and report their mean disagreement */
+	static void BM_TscClock_ErrorVsUtcNow( ::benchmark::State& state )
+	{
+		TscClock& clock{ TscClock::shared() };
+		std::int64_t sum{ 0 };
+		std::int64_t count{ 0 };
+		for ( auto _ : state )
+		{
+			const std::int64_t reading{ clock.nowTicks() };
+			const std::int64_t reference{ DateTime::utcNow().ticks() };
+			const std::int64_t error{ reading > reference ? reading - reference : reference - reading };
+			sum += error;
+			++count;
+		}
+
+		state.counters["mean_error_ns"] = count > 0 ? static_cast<double>( sum ) / static_cast<double>( count ) * constants::NANOSECONDS_PER_TICK : 0.0;
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------------------------
+	// Clock reads
+	//----------------------------------------------
+
+	BENCHMARK( BM_TscClock_NowTicks );
+	BENCHMARK( BM_TscClock_Now );
+	BENCHMARK( BM_TscClock_UtcNow );
+	BENCHMARK( BM_TscClock_UtcNowCoarse );
+
+	//----------------------------------------------
+	// Accuracy
+	//----------------------------------------------
+
+	BENCHMARK( BM_TscClock_ErrorVsUtcNow );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
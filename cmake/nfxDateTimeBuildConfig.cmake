@@ -30,6 +30,24 @@ if(NOT NFX_DATETIME_BUILD_STATIC AND NOT NFX_DATETIME_BUILD_SHARED)
 	endif()
 endif()
 
+# --- Validate day lookup table window ---
+if(NFX_DATETIME_ENABLE_DAY_TABLE)
+	if(NOT NFX_DATETIME_DAY_TABLE_FIRST_YEAR MATCHES "^[0-9]+$" OR NOT NFX_DATETIME_DAY_TABLE_LAST_YEAR MATCHES "^[0-9]+$")
+		message(FATAL_ERROR "NFX_DATETIME_DAY_TABLE_FIRST_YEAR and NFX_DATETIME_DAY_TABLE_LAST_YEAR must be integer years")
+	endif()
+	if(NFX_DATETIME_DAY_TABLE_FIRST_YEAR LESS 1 OR NFX_DATETIME_DAY_TABLE_LAST_YEAR GREATER 9999)
+		message(FATAL_ERROR "Day lookup table window must lie within years 1..9999")
+	endif()
+	if(NFX_DATETIME_DAY_TABLE_LAST_YEAR LESS NFX_DATETIME_DAY_TABLE_FIRST_YEAR)
+		message(FATAL_ERROR "NFX_DATETIME_DAY_TABLE_LAST_YEAR must not precede NFX_DATETIME_DAY_TABLE_FIRST_YEAR")
+	endif()
+	math(EXPR _nfx_day_table_span "${NFX_DATETIME_DAY_TABLE_LAST_YEAR} - ${NFX_DATETIME_DAY_TABLE_FIRST_YEAR} + 1")
+	if(_nfx_day_table_span GREATER 256)
+		message(FATAL_ERROR "Day lookup table window is limited to 256 years (requested ${_nfx_day_table_span})")
+	endif()
+	message(STATUS "Day lookup table enabled for years ${NFX_DATETIME_DAY_TABLE_FIRST_YEAR}-${NFX_DATETIME_DAY_TABLE_LAST_YEAR}")
+endif()
+
 #----------------------------------------------
 # Multi-config generator setup
 #----------------------------------------------
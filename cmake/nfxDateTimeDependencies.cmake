@@ -14,6 +14,14 @@ set(CMAKE_REQUIRED_QUIET    ON         )
 set(CMAKE_MESSAGE_LOG_LEVEL VERBOSE    ) # [ERROR, WARNING, NOTICE, STATUS, VERBOSE, DEBUG]
 set(CMAKE_FIND_QUIETLY      ON         )
 
+#----------------------------------------------
+# System dependencies
+#----------------------------------------------
+
+# --- Threads (CachedClock update thread) ---
+set(THREADS_PREFER_PTHREAD_FLAG ON)
+find_package(Threads REQUIRED)
+
 #----------------------------------------------
 # FetchContent dependencies
 #----------------------------------------------
@@ -9,7 +9,16 @@
 set(private_sources)
 
 list(APPEND private_sources
+	${NFX_DATETIME_SOURCE_DIR}/Batch.cpp
+	${NFX_DATETIME_SOURCE_DIR}/CachedClock.cpp
 	${NFX_DATETIME_SOURCE_DIR}/DateTime.cpp
 	${NFX_DATETIME_SOURCE_DIR}/DateTimeOffset.cpp
+	${NFX_DATETIME_SOURCE_DIR}/DayTable.cpp
+	${NFX_DATETIME_SOURCE_DIR}/IncrementalTimestampParser.cpp
+	${NFX_DATETIME_SOURCE_DIR}/ParsePattern.cpp
 	${NFX_DATETIME_SOURCE_DIR}/TimeSpan.cpp
+	${NFX_DATETIME_SOURCE_DIR}/TimestampParser.cpp
+	${NFX_DATETIME_SOURCE_DIR}/TimestampRenderer.cpp
+	${NFX_DATETIME_SOURCE_DIR}/TimestampScanner.cpp
+	${NFX_DATETIME_SOURCE_DIR}/TscClock.cpp
 )
@@ -52,6 +52,29 @@ function(configure_target target_name)
 			${NFX_DATETIME_SOURCE_DIR}
 	)
 
+	# --- Link libraries ---
+	target_link_libraries(${target_name}
+		PUBLIC
+			Threads::Threads
+	)
+
+	# --- Compile definitions ---
+	if(NFX_DATETIME_ENABLE_DAY_TABLE)
+		target_compile_definitions(${target_name}
+			PRIVATE
+				NFX_DATETIME_DAY_TABLE=1
+				NFX_DATETIME_DAY_TABLE_FIRST_YEAR=${NFX_DATETIME_DAY_TABLE_FIRST_YEAR}
+				NFX_DATETIME_DAY_TABLE_LAST_YEAR=${NFX_DATETIME_DAY_TABLE_LAST_YEAR}
+		)
+	endif()
+
+	if(NFX_DATETIME_ENABLE_SIMD)
+		target_compile_definitions(${target_name}
+			PRIVATE
+				NFX_DATETIME_SIMD=1
+		)
+	endif()
+
 	# --- Properties ---
 	set_target_properties(${target_name} PROPERTIES
 		CXX_STANDARD 20
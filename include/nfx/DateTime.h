@@ -25,13 +25,24 @@
 /**
  * @file DateTime.h
  * @brief Main umbrella header for nfx-datetime library
- * @details Includes all temporal types: DateTime, DateTimeOffset, and TimeSpan.
+ * @details Includes all temporal types: DateTime, DateTimeOffset, and TimeSpan, plus the
+ *          column-oriented batch operations, the layout-learning TimestampParser, the
+ *          prefix-reusing IncrementalTimestampParser, run-time compiled ParsePattern formats,
+ *          FormatPattern output patterns and the streaming CSV/NDJSON timestamp scanner.
  *          This single header provides convenient access to the entire nfx::time namespace.
  *          For selective includes, use individual headers from nfx/datetime/ subdirectory.
  */
 
 #pragma once
 
+#include "datetime/Batch.h"
+#include "datetime/CachedClock.h"
 #include "datetime/DateTime.h"
 #include "datetime/DateTimeOffset.h"
+#include "datetime/FormatPattern.h"
+#include "datetime/IncrementalTimestampParser.h"
+#include "datetime/ParsePattern.h"
 #include "datetime/TimeSpan.h"
+#include "datetime/TimestampParser.h"
+#include "datetime/TimestampScanner.h"
+#include "datetime/TscClock.h"
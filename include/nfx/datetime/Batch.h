@@ -0,0 +1,484 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Batch.h
+ * @brief Column-oriented batch operations over arrays of DateTime values
+ * @details Converts whole columns of timestamps at once for analytics and ingestion
+ *          workloads. Kernels are selected at runtime from the host CPU (AVX-512, AVX2,
+ *          or a portable scalar fallback) and produce results identical to the
+ *          corresponding per-value DateTime accessors.
+ *
+ * @par Structure-of-arrays layout:
+ * @code
+ * ┌──────────────────────────────────────────────────────────────┐
+ * │  std::span<const DateTime>     DecomposedColumns             │
+ * ├──────────────────────────────────────────────────────────────┤
+ * │  [ t0, t1, t2, ... ]   ──►     year          [ y0, y1, ... ] │
+ * │                                month         [ m0, m1, ... ] │
+ * │                                day           [ d0, d1, ... ] │
+ * │                                hour          [ h0, h1, ... ] │
+ * │                                minute        [ .. ]          │
+ * │                                second        [ .. ]          │
+ * │                                fractionTicks [ .. ]          │
+ * └──────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @par Formatting output:
+ * format() appends rows to an OutputBuffer in the offsets-plus-data layout of Apache Arrow
+ * large_utf8 columns, drawing memory from any std::pmr::memory_resource:
+ * @code
+ * std::pmr::monotonic_buffer_resource arena;
+ * batch::OutputBuffer csv{ &arena };
+ * batch::format( column, DateTime::Format::Iso8601Basic, csv );
+ * // csv[i] == column[i].toString(); csv.data() holds every row back to back
+ * @endcode
+ *
+ * @par Error reporting:
+ * Operations that can reject individual rows (compose(), parse()) never throw for bad
+ * data. They mark the offending rows in an ErrorBitmap, one bit per row, and still
+ * produce an output value (DateTime::min(), or a default DateTimeOffset) for every
+ * rejected row.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "DateTime.h"
+#include "DateTimeOffset.h"
+
+namespace nfx::time::batch
+{
+	//=====================================================================
+	// SIMD dispatch
+	//=====================================================================
+
+	/**
+	 * @brief Instruction set used by the batch kernels
+	 * @details The best level supported by the host CPU is selected automatically.
+	 */
+	enum class SimdLevel : std::uint8_t
+	{
+		/** @brief Portable scalar implementation */
+		Scalar = 0,
+
+		/** @brief 8 lanes of 32-bit integers (x86-64 AVX2) */
+		Avx2,
+
+		/** @brief 16 lanes of 32-bit integers (x86-64 AVX-512F) */
+		Avx512
+	};
+
+	/**
+	 * @brief Get the best SIMD level supported by the host CPU and build
+	 * @return Highest available SimdLevel
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] SimdLevel supportedSimdLevel() noexcept;
+
+	/**
+	 * @brief Get the SIMD level currently used by the batch kernels
+	 * @return Active SimdLevel
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] SimdLevel simdLevel() noexcept;
+
+	/**
+	 * @brief Restrict the batch kernels to a SIMD level
+	 * @param level Requested level; clamped to supportedSimdLevel()
+	 * @return Level actually in effect
+	 * @details Intended for testing and benchmarking individual kernels.
+	 */
+	SimdLevel setSimdLevel( SimdLevel level ) noexcept;
+
+	//=====================================================================
+	// ErrorBitmap class
+	//=====================================================================
+
+	/**
+	 * @brief One bit per row marking rows rejected by a batch operation
+	 * @details Bit i of word i / 64 (least significant bit first) corresponds to row i.
+	 */
+	class ErrorBitmap final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Default constructor (empty bitmap) */
+		ErrorBitmap() = default;
+
+		//----------------------------------------------
+		// Modifiers
+		//----------------------------------------------
+
+		/**
+		 * @brief Resize to the given number of rows and clear every bit
+		 * @param rows Number of rows
+		 */
+		inline void reset( std::size_t rows );
+
+		/**
+		 * @brief Mark a row as rejected
+		 * @param row Row index (must be < size())
+		 */
+		inline void set( std::size_t row ) noexcept;
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of rows covered
+		 * @return Number of rows
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+		/**
+		 * @brief Check whether a row was rejected
+		 * @param row Row index (must be < size())
+		 * @return true if the row is marked
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool test( std::size_t row ) const noexcept;
+
+		/**
+		 * @brief Count rejected rows
+		 * @return Number of marked rows
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t count() const noexcept;
+
+		/**
+		 * @brief Check whether any row was rejected
+		 * @return true if at least one row is marked
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool any() const noexcept;
+
+		/**
+		 * @brief Get the underlying 64-bit words
+		 * @return Read-only view of ( size() + 63 ) / 64 words
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::span<const std::uint64_t> words() const noexcept;
+
+		/**
+		 * @brief Get the underlying 64-bit words for bulk updates by batch kernels
+		 * @return Mutable view of ( size() + 63 ) / 64 words
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::span<std::uint64_t> words() noexcept;
+
+	private:
+		/** @brief Packed row bits */
+		std::vector<std::uint64_t> m_words;
+
+		/** @brief Number of rows covered */
+		std::size_t m_size{ 0 };
+	};
+
+	//=====================================================================
+	// Decomposition
+	//=====================================================================
+
+	/**
+	 * @brief Calendar and clock fields of a column of DateTime values, one vector per field
+	 * @details All vectors have the same length; element i of every vector describes input i.
+	 */
+	struct DecomposedColumns
+	{
+		/** @brief Years (1-9999) */
+		std::vector<std::int32_t> year;
+
+		/** @brief Months (1-12) */
+		std::vector<std::int32_t> month;
+
+		/** @brief Days of month (1-31) */
+		std::vector<std::int32_t> day;
+
+		/** @brief Hours (0-23) */
+		std::vector<std::int32_t> hour;
+
+		/** @brief Minutes (0-59) */
+		std::vector<std::int32_t> minute;
+
+		/** @brief Seconds (0-59) */
+		std::vector<std::int32_t> second;
+
+		/** @brief Sub-second ticks (0-9999999, 100-nanosecond units) */
+		std::vector<std::int32_t> fractionTicks;
+
+		/**
+		 * @brief Resize every column to the given number of rows
+		 * @param rows Number of rows
+		 */
+		void resize( std::size_t rows );
+
+		/**
+		 * @brief Get the number of rows
+		 * @return Length of the columns
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] std::size_t size() const noexcept;
+	};
+
+	/**
+	 * @brief Decompose a column of DateTime values into per-field columns
+	 * @param values Input values
+	 * @param columns Output columns, resized to values.size()
+	 * @details Uses the same Gregorian arithmetic as DateTime::components(); row i of the
+	 *          output equals values[i].components() for every field present.
+	 */
+	void decompose( std::span<const DateTime> values, DecomposedColumns& columns );
+
+	//=====================================================================
+	// Composition
+	//=====================================================================
+
+	/**
+	 * @brief Read-only views over component columns to compose into DateTime values
+	 * @details year, month and day are required. Empty time columns are treated as zero,
+	 *          so date-only input needs no padding columns.
+	 */
+	struct ComponentColumns
+	{
+		/** @brief Years (valid range 1-9999) */
+		std::span<const std::int32_t> year;
+
+		/** @brief Months (valid range 1-12) */
+		std::span<const std::int32_t> month;
+
+		/** @brief Days of month (valid range 1 to days in month) */
+		std::span<const std::int32_t> day;
+
+		/** @brief Hours (valid range 0-23), or empty for midnight */
+		std::span<const std::int32_t> hour;
+
+		/** @brief Minutes (valid range 0-59), or empty for zero */
+		std::span<const std::int32_t> minute;
+
+		/** @brief Seconds (valid range 0-59), or empty for zero */
+		std::span<const std::int32_t> second;
+
+		/** @brief Sub-second ticks (valid range 0-9999999), or empty for zero */
+		std::span<const std::int32_t> fractionTicks;
+	};
+
+	/**
+	 * @brief Validate component columns and compose them into DateTime values
+	 * @param columns Input columns; every non-empty column must have out.size() rows
+	 * @param out Output values, one per row
+	 * @param invalidRows Reset to out.size() rows; bit i is set when row i is invalid
+	 * @return Number of invalid rows
+	 * @throws std::invalid_argument if a non-empty column length differs from out.size()
+	 * @details Valid rows produce exactly the value of the matching DateTime constructor.
+	 *          Invalid rows produce DateTime::min() and are reported in invalidRows rather
+	 *          than being indistinguishable from a genuine 0001-01-01T00:00:00 value.
+	 */
+	std::size_t compose( const ComponentColumns& columns, std::span<DateTime> out, ErrorBitmap& invalidRows );
+
+	//=====================================================================
+	// Parsing
+	//=====================================================================
+
+	/**
+	 * @brief Read-only view over an offsets-plus-data string column (Apache Arrow utf8 layout)
+	 * @details Row i is data[offsets[i], offsets[i + 1]), so offsets holds one more entry than
+	 *          there are rows. Rows whose offsets are decreasing or exceed data are rejected.
+	 */
+	struct StringColumn
+	{
+		/** @brief Row boundaries into data (rows + 1 entries) */
+		std::span<const std::int32_t> offsets;
+
+		/** @brief Concatenated row bytes */
+		std::span<const char> data;
+
+		/**
+		 * @brief Get the number of rows
+		 * @return offsets.size() - 1, or zero for an empty column
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+	};
+
+	/**
+	 * @brief Parse a column of ISO 8601 strings into DateTime values
+	 * @param strings Input strings
+	 * @param out Output values, one per row
+	 * @param invalidRows Reset to out.size() rows; bit i is set when row i does not parse
+	 * @return Number of invalid rows
+	 * @throws std::invalid_argument if strings.size() differs from out.size()
+	 * @details Accepts exactly what DateTime::fromString() accepts and produces the same value.
+	 *          Canonical YYYY-MM-DDTHH:MM:SS[.fffffff][Z|±HH:MM] rows are shape-checked with SIMD
+	 *          several strings at a time and composed with the compose() kernels; other rows take
+	 *          the general parser. Invalid rows produce DateTime::min().
+	 */
+	std::size_t parse( std::span<const std::string_view> strings, std::span<DateTime> out, ErrorBitmap& invalidRows );
+
+	/**
+	 * @brief Parse an offsets-plus-data column of ISO 8601 strings into DateTime values
+	 * @param strings Input column with out.size() rows
+	 * @param out Output values, one per row
+	 * @param invalidRows Reset to out.size() rows; bit i is set when row i does not parse
+	 * @return Number of invalid rows
+	 * @throws std::invalid_argument if strings.size() differs from out.size()
+	 */
+	std::size_t parse( const StringColumn& strings, std::span<DateTime> out, ErrorBitmap& invalidRows );
+
+	/**
+	 * @brief Parse a column of ISO 8601 strings into DateTimeOffset values
+	 * @param strings Input strings
+	 * @param out Output values, one per row
+	 * @param invalidRows Reset to out.size() rows; bit i is set when row i does not parse
+	 * @return Number of invalid rows
+	 * @throws std::invalid_argument if strings.size() differs from out.size()
+	 * @details Accepts exactly what DateTimeOffset::fromString() accepts and produces the same
+	 *          value. Invalid rows produce a default-constructed DateTimeOffset.
+	 */
+	std::size_t parse( std::span<const std::string_view> strings, std::span<DateTimeOffset> out, ErrorBitmap& invalidRows );
+
+	/**
+	 * @brief Parse an offsets-plus-data column of ISO 8601 strings into DateTimeOffset values
+	 * @param strings Input column with out.size() rows
+	 * @param out Output values, one per row
+	 * @param invalidRows Reset to out.size() rows; bit i is set when row i does not parse
+	 * @return Number of invalid rows
+	 * @throws std::invalid_argument if strings.size() differs from out.size()
+	 */
+	std::size_t parse( const StringColumn& strings, std::span<DateTimeOffset> out, ErrorBitmap& invalidRows );
+
+	//=====================================================================
+	// Formatting
+	//=====================================================================
+
+	/**
+	 * @brief Growable offsets-plus-data string column receiving format() output
+	 * @details Row i is data()[offsets()[i], offsets()[i + 1]), so offsets() holds one more
+	 *          entry than there are rows. Offsets are 64-bit (Apache Arrow large_utf8), since
+	 *          a column of tens of millions of timestamps passes the 2 GiB reach of 32-bit
+	 *          offsets. Rows of the Iso8601Basic, Iso8601WithOffset, DateOnly and TimeOnly
+	 *          formats all have the same length (20, 25, 10 and 8 bytes), so data() is then
+	 *          also a fixed-width column. Storage is allocated from the memory resource given
+	 *          at construction, for example an arena that is released after the export.
+	 */
+	class OutputBuffer final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Construct an empty buffer
+		 * @param resource Memory resource for the offsets and data
+		 */
+		explicit inline OutputBuffer( std::pmr::memory_resource* resource = std::pmr::get_default_resource() );
+
+		//----------------------------------------------
+		// Modifiers
+		//----------------------------------------------
+
+		/** @brief Remove every row, keeping the allocated capacity */
+		inline void clear() noexcept;
+
+		/**
+		 * @brief Reserve capacity for further rows
+		 * @param rows Number of rows to be appended
+		 * @param bytes Number of data bytes to be appended
+		 */
+		inline void reserve( std::size_t rows, std::size_t bytes );
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of rows
+		 * @return Number of rows formatted since construction or clear()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+		/**
+		 * @brief Check whether the buffer holds no rows
+		 * @return true if size() is zero
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool empty() const noexcept;
+
+		/**
+		 * @brief Get one row
+		 * @param row Row index (must be < size())
+		 * @return View of the row's bytes, valid until the buffer is modified
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::string_view operator[]( std::size_t row ) const noexcept;
+
+		/**
+		 * @brief Get the row boundaries
+		 * @return size() + 1 offsets into data(), starting at zero
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::span<const std::int64_t> offsets() const noexcept;
+
+		/**
+		 * @brief Get the concatenated row bytes
+		 * @return Every row back to back, without separators or terminators
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::span<const char> data() const noexcept;
+
+	private:
+		friend void format( std::span<const DateTime> values, DateTime::Format format, OutputBuffer& out );
+
+		/** @brief Row boundaries; always starts with 0 */
+		std::pmr::vector<std::int64_t> m_offsets;
+
+		/** @brief Concatenated row bytes */
+		std::pmr::vector<char> m_data;
+	};
+
+	/**
+	 * @brief Format a column of DateTime values, appending one row per value
+	 * @param values Input values
+	 * @param format Output format, as for DateTime::toString( Format )
+	 * @param out Buffer receiving the rows; existing rows are kept
+	 * @details Row i equals values[i].toString( format ). Values are decomposed a chunk at a
+	 *          time with the decompose() kernels and written with digit-pair tables straight
+	 *          into the buffer, with no per-value allocation.
+	 */
+	void format( std::span<const DateTime> values, DateTime::Format format, OutputBuffer& out );
+} // namespace nfx::time::batch
+
+#include "nfx/detail/datetime/Batch.inl"
@@ -0,0 +1,203 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CachedClock.h
+ * @brief Opt-in clock service publishing the current UTC time from a background thread
+ * @details Stamping millions of events per second with DateTime::utcNow() spends most of
+ *          the time in the system clock call. A started CachedClock runs one thread that
+ *          stores DateTime::utcNow().ticks() into a cache-line-aligned atomic once per
+ *          update period; readers get the time with a single relaxed load and never touch
+ *          the system clock. The update period is the staleness bound: a reading lags the
+ *          true time by at most the period plus the update thread's wake-up latency.
+ *
+ * @par Example:
+ * @code
+ * CachedClock clock{ TimeSpan::fromMicroseconds( 100.0 ) };
+ * clock.start();
+ * for ( Event& event : events )
+ * {
+ *     event.time = clock.now(); // no system call
+ * }
+ * clock.stop(); // also done by the destructor
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "DateTime.h"
+#include "TimeSpan.h"
+
+namespace nfx::time
+{
+	//=====================================================================
+	// CachedClock class
+	//=====================================================================
+
+	/**
+	 * @brief Current UTC time published periodically by a background thread
+	 * @details Reading is thread-safe and wait-free. While the clock is stopped, readers fall
+	 *          back to DateTime::utcNow(), so code stamping through a CachedClock works
+	 *          whether or not the service was started. start() and stop() may be called
+	 *          from any thread.
+	 */
+	class CachedClock final
+	{
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Alignment of the published value, keeping it off the lines written by start() and stop() */
+		static constexpr std::size_t CACHE_LINE_SIZE{ 64 };
+
+		/** @brief Shortest accepted update period */
+		static constexpr std::int64_t MIN_PERIOD_TICKS{ 10 * constants::TICKS_PER_MICROSECOND };
+
+		/** @brief Update period used when none (or a non-positive one) is given */
+		static constexpr std::int64_t DEFAULT_PERIOD_TICKS{ constants::TICKS_PER_MILLISECOND };
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Create a stopped clock
+		 * @param period Update period, i.e. the staleness bound of readings; non-positive values
+		 *        select DEFAULT_PERIOD_TICKS and shorter ones are raised to MIN_PERIOD_TICKS
+		 */
+		explicit CachedClock( TimeSpan period = TimeSpan{ DEFAULT_PERIOD_TICKS } ) noexcept;
+
+		/** @brief Destructor, stopping the update thread */
+		~CachedClock();
+
+		/** @brief Copy constructor (deleted; the update thread refers to this instance) */
+		CachedClock( const CachedClock& ) = delete;
+
+		/** @brief Copy assignment (deleted; the update thread refers to this instance) */
+		CachedClock& operator=( const CachedClock& ) = delete;
+
+		//----------------------------------------------
+		// Lifecycle
+		//----------------------------------------------
+
+		/**
+		 * @brief Publish the current time and start the update thread
+		 * @details Does nothing if the clock is already running.
+		 * @throws std::system_error if the thread cannot be created
+		 */
+		void start();
+
+		/**
+		 * @brief Stop the update thread and wait for it to exit
+		 * @details Does nothing if the clock is not running. Readers fall back to
+		 *          DateTime::utcNow() afterwards.
+		 */
+		void stop() noexcept;
+
+		/**
+		 * @brief Check whether the update thread is publishing
+		 * @return true between start() and stop()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool isRunning() const noexcept;
+
+		//----------------------------------------------
+		// Reading
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the most recently published UTC time in ticks
+		 * @return 100-nanosecond ticks since 0001-01-01, at most period() plus the update
+		 *         thread's wake-up latency behind DateTime::utcNow(); DateTime::utcNow() itself
+		 *         while stopped
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::int64_t nowTicks() const noexcept;
+
+		/**
+		 * @brief Get the most recently published UTC time
+		 * @return DateTime holding nowTicks()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline DateTime now() const noexcept;
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the update period
+		 * @return Time between two publications, the staleness bound of readings
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline TimeSpan period() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Implementation
+		//----------------------------------------------
+
+		/** @brief Update thread body: publish, then sleep until the next period or a stop request */
+		void run() noexcept;
+
+		//----------------------------------------------
+		// Published time
+		//----------------------------------------------
+
+		/** @brief Current time in ticks; zero while stopped (no real time maps to tick 0) */
+		alignas( CACHE_LINE_SIZE ) std::atomic<std::int64_t> m_ticks{ 0 };
+
+		//----------------------------------------------
+		// Update thread
+		//----------------------------------------------
+
+		/** @brief Update period in ticks */
+		alignas( CACHE_LINE_SIZE ) std::int64_t m_periodTicks;
+
+		/** @brief Serialises start() and stop() */
+		std::mutex m_lifecycle;
+
+		/** @brief Guards m_stopRequested */
+		std::mutex m_mutex;
+
+		/** @brief Wakes the update thread early on stop() */
+		std::condition_variable m_wakeup;
+
+		/** @brief Set by stop(), cleared by start() */
+		bool m_stopRequested{ false };
+
+		/** @brief Update thread; joinable while running */
+		std::thread m_thread;
+	};
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/CachedClock.inl"
@@ -195,6 +195,7 @@
 
 #pragma once
 
+#include <charconv>
 #include <chrono>
 #include <compare>
 #include <cstdint>
@@ -204,6 +205,7 @@
 #include <string_view>
 
 #include "TimeSpan.h"
+#include "nfx/detail/datetime/Pattern.h"
 
 namespace nfx::time
 {
@@ -255,6 +257,45 @@ namespace nfx::time
 			UnixMilliseconds,
 		};
 
+		//----------------------------------------------
+		// Component structure
+		//----------------------------------------------
+
+		/**
+		 * @brief Calendar and clock fields of a DateTime
+		 * @details Filled by a single decomposition in components(), so callers that need
+		 *          several fields avoid re-running the calendar math once per accessor.
+		 */
+		struct Components
+		{
+			/** @brief Year (1-9999) */
+			std::int32_t year;
+
+			/** @brief Month (1-12) */
+			std::int32_t month;
+
+			/** @brief Day of month (1-31) */
+			std::int32_t day;
+
+			/** @brief Hour (0-23) */
+			std::int32_t hour;
+
+			/** @brief Minute (0-59) */
+			std::int32_t minute;
+
+			/** @brief Second (0-59) */
+			std::int32_t second;
+
+			/** @brief Sub-second fraction in 100-nanosecond ticks (0-9999999) */
+			std::int32_t fractionTicks;
+
+			/** @brief Day of week (0=Sunday, 6=Saturday) */
+			std::int32_t dayOfWeek;
+
+			/** @brief Day of year (1-366) */
+			std::int32_t dayOfYear;
+		};
+
 		//----------------------------------------------
 		// Construction
 		//----------------------------------------------
@@ -489,6 +530,13 @@ namespace nfx::time
 		 */
 		[[nodiscard]] std::int32_t dayOfYear() const noexcept;
 
+		/**
+		 * @brief Get all calendar and clock fields in a single decomposition
+		 * @return Components holding year, month, day, hour, minute, second, fraction ticks, day of week and day of year
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] Components components() const noexcept;
+
 		//----------------------------------------------
 		// Conversion methods
 		//----------------------------------------------
@@ -567,6 +615,28 @@ namespace nfx::time
 		 */
 		[[nodiscard]] static DateTime utcNow() noexcept;
 
+		/**
+		 * @brief Get current UTC time from the cheaper, coarse system clock
+		 * @return DateTime representing the current UTC date and time, truncated to the
+		 *         granularity reported by coarseClockResolution()
+		 * @details On Linux this reads CLOCK_REALTIME_COARSE, the time of the last kernel timer
+		 *          tick, which costs a few nanoseconds instead of a hardware counter read. Its
+		 *          resolution is one tick: 1 ms at CONFIG_HZ=1000, 4 ms at 250. Values never
+		 *          run ahead of utcNow() but may lag it by up to one tick. On other platforms
+		 *          it is the same as utcNow().
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static DateTime utcNowCoarse() noexcept;
+
+		/**
+		 * @brief Get the resolution of utcNowCoarse()
+		 * @return Interval between distinct utcNowCoarse() values as reported by the system
+		 *         (clock_getres() on Linux), or the resolution of std::chrono::system_clock
+		 *         where utcNowCoarse() falls back to it; at least one tick
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static TimeSpan coarseClockResolution() noexcept;
+
 		/**
 		 * @brief Get current local date (time set to 00:00:00)
 		 * @return DateTime representing the current local date with time set to 00:00:00
@@ -612,6 +682,30 @@ namespace nfx::time
 		 */
 		[[nodiscard]] static std::optional<DateTime> fromString( std::string_view iso8601String ) noexcept;
 
+		/**
+		 * @brief Parse a string laid out by a compile-time strftime-style pattern
+		 * @tparam Pattern Pattern literal, e.g. parse<"%d/%b/%Y:%H:%M:%S">(); see Pattern.h for the specifiers
+		 * @param text The string to parse, which the pattern must match entirely
+		 * @param result Reference to store the parsed DateTime if successful
+		 * @return true if parsing succeeded, false otherwise
+		 * @details The pattern is compiled while the program is built, so a malformed pattern
+		 *          does not compile. A %z offset is validated but not applied: the result is the
+		 *          local clock time, as with fromString().
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <internal::PatternLiteral Pattern>
+		[[nodiscard]] inline static constexpr bool parse( std::string_view text, DateTime& result ) noexcept;
+
+		/**
+		 * @brief Parse a string laid out by a compile-time pattern and return optional DateTime
+		 * @tparam Pattern Pattern literal; see Pattern.h for the specifiers
+		 * @param text The string to parse, which the pattern must match entirely
+		 * @return std::optional<DateTime> containing the parsed value if successful, std::nullopt otherwise
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <internal::PatternLiteral Pattern>
+		[[nodiscard]] inline static constexpr std::optional<DateTime> parse( std::string_view text ) noexcept;
+
 		/**
 		 * @brief Create from Epoch timestamp (seconds since epoch)
 		 * @param seconds The number of seconds since Unix epoch (January 1, 1970 00:00:00 UTC)
@@ -632,6 +726,18 @@ namespace nfx::time
 		// String formatting
 		//----------------------------------------------
 
+		/**
+		 * @brief Write the string form into a caller-provided buffer without allocating
+		 * @param first Start of the buffer
+		 * @param last End of the buffer
+		 * @param format The format to write, as for toString( Format )
+		 * @return { end of output, std::errc{} } on success, or { last, std::errc::value_too_large }
+		 *         if the output does not fit, in which case the buffer contents are unspecified
+		 * @details A buffer of constants::MAX_ISO8601_LENGTH chars holds every format. The output
+		 *          is not null-terminated.
+		 */
+		std::to_chars_result toChars( char* first, char* last, Format format = Format::Iso8601Basic ) const noexcept;
+
 		/**
 		 * @brief Convert to ISO 8601 string (basic format)
 		 * @return String representation in ISO 8601 basic format (e.g., "2024-01-01T12:00:00Z")
@@ -647,6 +753,14 @@ namespace nfx::time
 		 */
 		[[nodiscard]] std::string toString( Format format ) const;
 
+		/**
+		 * @brief Convert to string stored inline, without allocating
+		 * @param format The format to use for string conversion
+		 * @return Same text as toString( format ); converts implicitly to std::string_view
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline FixedString<constants::MAX_ISO8601_LENGTH> toFixedString( Format format = Format::Iso8601Basic ) const noexcept;
+
 		/**
 		 * @brief Convert to ISO 8601 extended format with full precision
 		 * @return String representation in ISO 8601 extended format with fractional seconds (e.g., "2024-01-01T12:00:00.1234567Z")
@@ -133,6 +133,7 @@
 
 #pragma once
 
+#include <charconv>
 #include <compare>
 #include <cstdint>
 #include <string>
@@ -467,6 +468,13 @@ namespace nfx::time
 		 */
 		[[nodiscard]] inline std::int32_t totalOffsetMinutes() const noexcept;
 
+		/**
+		 * @brief Get all local calendar and clock fields in a single decomposition
+		 * @return DateTime::Components of the local date and time (offset not applied)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline DateTime::Components components() const noexcept;
+
 		//----------------------------------------------
 		// Conversion methods
 		//----------------------------------------------
@@ -626,6 +634,18 @@ namespace nfx::time
 		// String formatting
 		//----------------------------------------------
 
+		/**
+		 * @brief Write the string form into a caller-provided buffer without allocating
+		 * @param first Start of the buffer
+		 * @param last End of the buffer
+		 * @param format The format to write, as for toString( DateTime::Format )
+		 * @return { end of output, std::errc{} } on success, or { last, std::errc::value_too_large }
+		 *         if the output does not fit, in which case the buffer contents are unspecified
+		 * @details A buffer of constants::MAX_ISO8601_LENGTH chars holds every format for offsets
+		 *          within ±14:00. The output is not null-terminated.
+		 */
+		std::to_chars_result toChars( char* first, char* last, DateTime::Format format = DateTime::Format::Iso8601Basic ) const noexcept;
+
 		/**
 		 * @brief Convert to ISO 8601 string with offset
 		 * @return String representation in ISO 8601 format with timezone offset (e.g., "2024-01-01T12:00:00+02:00")
@@ -641,6 +661,15 @@ namespace nfx::time
 		 */
 		[[nodiscard]] std::string toString( DateTime::Format format ) const;
 
+		/**
+		 * @brief Convert to string stored inline, without allocating
+		 * @param format The format to use for string conversion
+		 * @return Same text as toString( format ); converts implicitly to std::string_view
+		 * @details Offsets within ±14:00 always fit; anything longer yields an empty string.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline FixedString<constants::MAX_ISO8601_LENGTH> toFixedString( DateTime::Format format = DateTime::Format::Iso8601Basic ) const noexcept;
+
 		/**
 		 * @brief Convert to ISO 8601 extended format with full precision and offset
 		 * @return String representation in ISO 8601 extended format with fractional seconds and offset (e.g., "2024-01-01T12:00:00.1234567+02:00")
@@ -697,6 +726,13 @@ namespace nfx::time
 		 */
 		[[nodiscard]] static DateTimeOffset utcNow() noexcept;
 
+		/**
+		 * @brief Get current UTC time (offset = 00:00:00) from the coarse system clock
+		 * @return DateTimeOffset of DateTime::utcNowCoarse(), with the same resolution
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static DateTimeOffset utcNowCoarse() noexcept;
+
 		/**
 		 * @brief Get current local date (time set to 00:00:00)
 		 * @return DateTimeOffset representing the current local date with time set to 00:00:00
@@ -742,6 +778,29 @@ namespace nfx::time
 		 */
 		[[nodiscard]] static std::optional<DateTimeOffset> fromString( std::string_view iso8601String ) noexcept;
 
+		/**
+		 * @brief Parse a string laid out by a compile-time strftime-style pattern
+		 * @tparam Pattern Pattern literal, e.g. parse<"%d/%b/%Y:%H:%M:%S %z">(); see Pattern.h for the specifiers
+		 * @param text The string to parse, which the pattern must match entirely
+		 * @param result Reference to store the parsed DateTimeOffset if successful
+		 * @return true if parsing succeeded, false otherwise
+		 * @details The pattern is compiled while the program is built, so a malformed pattern
+		 *          does not compile. Without %z the offset is zero.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <internal::PatternLiteral Pattern>
+		[[nodiscard]] inline static constexpr bool parse( std::string_view text, DateTimeOffset& result ) noexcept;
+
+		/**
+		 * @brief Parse a string laid out by a compile-time pattern and return optional DateTimeOffset
+		 * @tparam Pattern Pattern literal; see Pattern.h for the specifiers
+		 * @param text The string to parse, which the pattern must match entirely
+		 * @return std::optional<DateTimeOffset> containing the parsed value if successful, std::nullopt otherwise
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <internal::PatternLiteral Pattern>
+		[[nodiscard]] inline static constexpr std::optional<DateTimeOffset> parse( std::string_view text ) noexcept;
+
 		/**
 		 * @brief Create from Epoch timestamp seconds with UTC offset
 		 * @param seconds The number of seconds since Unix epoch (January 1, 1970 00:00:00 UTC)
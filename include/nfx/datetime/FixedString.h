@@ -0,0 +1,196 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FixedString.h
+ * @brief Fixed-capacity string stored inline, returned by the toFixedString() methods
+ * @details std::string keeps at most 15 characters inline with libstdc++, so most ISO 8601
+ *          strings returned by toString() cost a heap allocation. FixedString<N> holds up to
+ *          N characters plus a null terminator in the object itself and converts implicitly
+ *          to std::string_view, so it can be passed wherever a view is accepted without
+ *          allocating.
+ *
+ * @par Example:
+ * @code
+ * const auto text{ DateTime::utcNow().toFixedString( DateTime::Format::Iso8601Extended ) };
+ * std::string_view view{ text };      // no allocation
+ * std::puts( text.c_str() );          // null-terminated
+ * std::string owned{ text.str() };    // explicit copy when ownership is needed
+ * @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace nfx::time
+{
+	//=====================================================================
+	// FixedString class
+	//=====================================================================
+
+	/**
+	 * @brief Null-terminated string of at most N characters stored inline
+	 * @tparam N Capacity in characters, excluding the null terminator
+	 */
+	template <std::size_t N>
+	class FixedString final
+	{
+		static_assert( N <= 255, "FixedString stores its length in one byte" );
+
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Default constructor (empty string) */
+		constexpr FixedString() noexcept = default;
+
+		/**
+		 * @brief Construct from a string view
+		 * @param text Characters to copy; anything past the first N is dropped
+		 */
+		explicit constexpr inline FixedString( std::string_view text ) noexcept;
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the characters
+		 * @return Pointer to size() characters followed by a null terminator
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] constexpr inline const char* data() const noexcept;
+
+		/**
+		 * @brief Get the characters for writing
+		 * @return Pointer to a buffer of capacity() characters; call resize() after writing
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] constexpr inline char* data() noexcept;
+
+		/**
+		 * @brief Get the null-terminated characters
+		 * @return Same pointer as data()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] constexpr inline const char* c_str() const noexcept;
+
+		/**
+		 * @brief Get the number of characters
+		 * @return Length excluding the null terminator
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] constexpr inline std::size_t size() const noexcept;
+
+		/**
+		 * @brief Check whether the string is empty
+		 * @return true if size() is zero
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] constexpr inline bool empty() const noexcept;
+
+		/**
+		 * @brief Get the capacity
+		 * @return N
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static constexpr inline std::size_t capacity() noexcept;
+
+		/** @brief Iterator to the first character */
+		[[nodiscard]] constexpr inline const char* begin() const noexcept;
+
+		/** @brief Iterator past the last character */
+		[[nodiscard]] constexpr inline const char* end() const noexcept;
+
+		/**
+		 * @brief Set the length after writing through data()
+		 * @param count New length; values above N are clamped to N
+		 */
+		constexpr inline void resize( std::size_t count ) noexcept;
+
+		//----------------------------------------------
+		// Conversion
+		//----------------------------------------------
+
+		/**
+		 * @brief Get a view of the characters
+		 * @return View valid as long as this object is alive and unchanged
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] constexpr inline std::string_view view() const noexcept;
+
+		/** @brief Implicit conversion to std::string_view, see view() */
+		constexpr inline operator std::string_view() const noexcept;
+
+		/**
+		 * @brief Copy into a std::string
+		 * @return Owning copy of the characters
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::string str() const;
+
+		//----------------------------------------------
+		// Comparison
+		//----------------------------------------------
+
+		/** @brief Compare the characters with a string view */
+		[[nodiscard]] friend constexpr bool operator==( const FixedString& lhs, std::string_view rhs ) noexcept
+		{
+			return lhs.view() == rhs;
+		}
+
+	private:
+		//----------------------------------------------
+		// State
+		//----------------------------------------------
+
+		/** @brief Characters followed by a null terminator */
+		char m_data[N + 1]{};
+
+		/** @brief Number of characters */
+		std::uint8_t m_size{ 0 };
+	};
+
+	//=====================================================================
+	// Stream operators
+	//=====================================================================
+
+	/**
+	 * @brief Write the characters to an output stream
+	 * @param os Output stream
+	 * @param text String to write
+	 * @return Reference to the output stream
+	 */
+	template <std::size_t N>
+	inline std::ostream& operator<<( std::ostream& os, const FixedString<N>& text );
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/FixedString.inl"
@@ -0,0 +1,202 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FormatPattern.h
+ * @brief strftime-style output pattern compiled once and written straight into caller buffers
+ * @details The pattern is compiled into a small fixed-capacity array of steps, so a
+ *          FormatPattern can be a constexpr constant (a malformed pattern is then a compile
+ *          error) or be built at run time from configuration without allocating. Formatting
+ *          decomposes the value once and writes each field with digit-pair table lookups into
+ *          a char buffer or any output iterator. See Pattern.h for the specifiers.
+ *
+ * @par Example:
+ * @code
+ * static constexpr FormatPattern LOG_TIME{ "%F %T.%f" };
+ * char buffer[64];
+ * auto [end, ec] = LOG_TIME.format( DateTime::utcNow(), buffer, buffer + sizeof( buffer ) );
+ *
+ * const FormatPattern configured{ settings.outputFormat };
+ * configured.format( value, std::back_inserter( line ) );
+ * @endcode
+ */
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "DateTime.h"
+#include "DateTimeOffset.h"
+#include "TimeSpan.h"
+
+namespace nfx::time
+{
+	//=====================================================================
+	// FormatPattern class
+	//=====================================================================
+
+	/**
+	 * @brief Reusable output pattern for DateTime, DateTimeOffset and TimeSpan
+	 * @details A DateTime is written as its own clock time, with %z as +00:00. A TimeSpan is
+	 *          written as whole days (%d) and the time within the day (%H %M %S %f), with a
+	 *          leading '-' when negative; its patterns may not use the other specifiers.
+	 *          Formatting does not modify the pattern, so one instance can be shared by any
+	 *          number of threads.
+	 */
+	class FormatPattern final
+	{
+	public:
+		//----------------------------------------------
+		// Capacity
+		//----------------------------------------------
+
+		/** @brief Maximum number of steps (fields plus literal runs) */
+		static constexpr std::size_t MAX_STEPS{ 32 };
+
+		/** @brief Maximum number of literal bytes */
+		static constexpr std::size_t MAX_LITERALS{ 64 };
+
+		/** @brief Longest output of any pattern */
+		static constexpr std::size_t MAX_OUTPUT_LENGTH{ 1 + MAX_LITERALS + MAX_STEPS * internal::MAX_SPAN_DAY_DIGITS };
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Compile a pattern
+		 * @param pattern strftime-style pattern, e.g. "%Y-%m-%dT%H:%M:%S.%f%z"
+		 * @throws std::invalid_argument if the pattern has an unknown specifier or exceeds
+		 *         MAX_STEPS or MAX_LITERALS; in a constant expression this is a compile error
+		 */
+		explicit inline constexpr FormatPattern( std::string_view pattern );
+
+		//----------------------------------------------
+		// Formatting
+		//----------------------------------------------
+
+		/**
+		 * @brief Write a DateTime
+		 * @param value Value to write
+		 * @param out Output iterator with room for the output (at most maxLength() chars)
+		 * @return Iterator past the last char written
+		 */
+		template <typename OutputIt>
+		inline OutputIt format( const DateTime& value, OutputIt out ) const;
+
+		/**
+		 * @brief Write a DateTimeOffset (its local clock time and offset)
+		 * @param value Value to write
+		 * @param out Output iterator with room for the output (at most maxLength() chars)
+		 * @return Iterator past the last char written
+		 */
+		template <typename OutputIt>
+		inline OutputIt format( const DateTimeOffset& value, OutputIt out ) const;
+
+		/**
+		 * @brief Write a TimeSpan
+		 * @param value Value to write
+		 * @param out Output iterator with room for the output (at most maxLength() chars)
+		 * @return Iterator past the last char written
+		 * @throws std::invalid_argument if the pattern uses %Y, %m, %b, %j, %a or %z
+		 */
+		template <typename OutputIt>
+		inline OutputIt format( const TimeSpan& value, OutputIt out ) const;
+
+		/**
+		 * @brief Write a DateTime into a bounded buffer
+		 * @param value Value to write
+		 * @param first Start of the buffer
+		 * @param last End of the buffer
+		 * @return { end of output, std::errc{} } on success, or { last, std::errc::value_too_large }
+		 *         if the output does not fit, in which case the buffer contents are unspecified
+		 */
+		inline std::to_chars_result format( const DateTime& value, char* first, char* last ) const noexcept;
+
+		/**
+		 * @brief Write a DateTimeOffset into a bounded buffer
+		 * @param value Value to write
+		 * @param first Start of the buffer
+		 * @param last End of the buffer
+		 * @return { end of output, std::errc{} } on success, or { last, std::errc::value_too_large }
+		 *         if the output does not fit
+		 */
+		inline std::to_chars_result format( const DateTimeOffset& value, char* first, char* last ) const noexcept;
+
+		/**
+		 * @brief Write a TimeSpan into a bounded buffer
+		 * @param value Value to write
+		 * @param first Start of the buffer
+		 * @param last End of the buffer
+		 * @return { end of output, std::errc{} } on success, { last, std::errc::value_too_large }
+		 *         if the output does not fit, or { first, std::errc::invalid_argument } if the
+		 *         pattern uses a specifier a TimeSpan does not have
+		 */
+		inline std::to_chars_result format( const TimeSpan& value, char* first, char* last ) const noexcept;
+
+		//----------------------------------------------
+		// Property accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get an upper bound of the output length
+		 * @return Most chars any value can produce with this pattern
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::size_t maxLength() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Implementation
+		//----------------------------------------------
+
+		/** @brief Write prepared fields into a bounded buffer */
+		inline std::to_chars_result write( const internal::FormatFields& fields, char* first, char* last ) const noexcept;
+
+		//----------------------------------------------
+		// State
+		//----------------------------------------------
+
+		/** @brief Compiled steps */
+		std::array<internal::FormatStep, MAX_STEPS> m_steps{};
+
+		/** @brief Literal bytes referenced by the literal steps */
+		std::array<char, MAX_LITERALS> m_literals{};
+
+		/** @brief Number of steps in use */
+		std::size_t m_stepCount{ 0 };
+
+		/** @brief Upper bound of the output length */
+		std::size_t m_maxLength{ 0 };
+
+		/** @brief Pattern uses a specifier a TimeSpan does not have */
+		bool m_hasDateFields{ false };
+	};
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/FormatPattern.inl"
@@ -0,0 +1,179 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file IncrementalTimestampParser.h
+ * @brief Stateful ISO 8601 parser reusing the decoded prefix of the previous timestamp
+ * @details Consecutive log lines are sorted by time and usually share the same day, and
+ *          often the same minute. IncrementalTimestampParser keeps the YYYY-MM-DDTHH:MM bytes
+ *          of the last canonical timestamp together with their decoded ticks. A new string
+ *          whose first 16 bytes are identical only needs its seconds and fraction decoded;
+ *          one with the same date re-decodes hour and minute. Neither case touches the
+ *          calendar arithmetic. Everything else goes through the general parser, which also
+ *          refreshes the cache.
+ *
+ * @par Reuse levels:
+ * @code
+ * cached   2024-06-15T13:45:30.120Z
+ * minute   2024-06-15T13:45:31.004Z    seconds and fraction decoded
+ * day      2024-06-15T13:46:02.917Z    hour, minute, seconds and fraction decoded
+ * miss     2024-06-16T00:00:00.001Z    general parser, cache refreshed
+ * @endcode
+ *
+ * @par Example:
+ * @code
+ * IncrementalTimestampParser parser;
+ * DateTime value;
+ * for ( std::string_view line : log )
+ * {
+ *     if ( parser.parse( line.substr( 0, 24 ), value ) ) { ... }
+ * }
+ * @endcode
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "DateTime.h"
+#include "DateTimeOffset.h"
+
+namespace nfx::time
+{
+	//=====================================================================
+	// IncrementalTimestampParser class
+	//=====================================================================
+
+	/**
+	 * @brief ISO 8601 parser decoding only what changed since the previous timestamp
+	 * @details Accepts exactly what DateTime::fromString() and DateTimeOffset::fromString()
+	 *          accept and produces the same values; the text after the seconds and fraction
+	 *          goes through the same checks as in those parsers. Input order only affects
+	 *          speed, never results. Instances hold mutable state, so use one per thread or
+	 *          per feed.
+	 */
+	class IncrementalTimestampParser final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Default constructor (empty cache) */
+		IncrementalTimestampParser() = default;
+
+		//----------------------------------------------
+		// Parsing
+		//----------------------------------------------
+
+		/**
+		 * @brief Parse an ISO 8601 string into a DateTime
+		 * @param iso8601String Input string
+		 * @param result Receives the parsed value on success
+		 * @return true on success, with the same result as DateTime::fromString()
+		 */
+		bool parse( std::string_view iso8601String, DateTime& result ) noexcept;
+
+		/**
+		 * @brief Parse an ISO 8601 string into a DateTimeOffset
+		 * @param iso8601String Input string
+		 * @param result Receives the parsed value on success
+		 * @return true on success, with the same result as DateTimeOffset::fromString()
+		 */
+		bool parse( std::string_view iso8601String, DateTimeOffset& result ) noexcept;
+
+		//----------------------------------------------
+		// Statistics
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of strings sharing the cached date, hour and minute
+		 * @return Count since construction or resetStatistics()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::uint64_t minuteHits() const noexcept;
+
+		/**
+		 * @brief Get the number of strings sharing only the cached date
+		 * @return Count since construction or resetStatistics()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::uint64_t dayHits() const noexcept;
+
+		/**
+		 * @brief Get the number of strings that needed the general parser
+		 * @return Count since construction or resetStatistics(), including invalid input
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::uint64_t misses() const noexcept;
+
+		/** @brief Zero the counters, keeping the cached prefix */
+		inline void resetStatistics() noexcept;
+
+		/** @brief Drop the cached prefix and zero the counters */
+		inline void reset() noexcept;
+
+	private:
+		//----------------------------------------------
+		// Implementation
+		//----------------------------------------------
+
+		/**
+		 * @brief Forward pass over the date-time fields, from the cache when the prefix matches
+		 * @return true if the fields are valid; the remainder is left to the caller
+		 */
+		bool scan( std::string_view iso8601String, internal::DateTimeScan& result ) noexcept;
+
+		//----------------------------------------------
+		// State
+		//----------------------------------------------
+
+		/** @brief Bytes 0-7 of the cached prefix ("YYYY-MM-") */
+		std::uint64_t m_dateWord{ 0 };
+
+		/** @brief Bytes 8-15 of the cached prefix ("DDTHH:MM") */
+		std::uint64_t m_minuteWord{ 0 };
+
+		/** @brief Ticks at midnight of the cached date */
+		std::int64_t m_dayTicks{ 0 };
+
+		/** @brief Ticks at the start of the cached minute */
+		std::int64_t m_minuteTicks{ 0 };
+
+		/** @brief Whether the fields above hold a prefix */
+		bool m_cached{ false };
+
+		/** @brief Strings that reused date, hour and minute */
+		std::uint64_t m_minuteHits{ 0 };
+
+		/** @brief Strings that reused the date only */
+		std::uint64_t m_dayHits{ 0 };
+
+		/** @brief Strings served by the general parser */
+		std::uint64_t m_misses{ 0 };
+	};
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/IncrementalTimestampParser.inl"
@@ -0,0 +1,158 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ParsePattern.h
+ * @brief strftime-style parse pattern compiled at run time, for formats read from configuration
+ * @details The pattern is compiled once, on construction, into the same flat step array that
+ *          DateTime::parse<"...">() builds at compile time: fixed-width numeric fields, month
+ *          names, fractions, offsets and merged runs of literal bytes. Parsing walks that array
+ *          and never allocates. See Pattern.h for the specifiers.
+ *
+ * @par Example:
+ * @code
+ * const ParsePattern pattern{ config.timestampFormat }; // e.g. "%d/%b/%Y:%H:%M:%S %z"
+ * DateTimeOffset value;
+ * for ( std::string_view field : column )
+ * {
+ *     if ( pattern.parse( field, value ) ) { ... }
+ * }
+ * @endcode
+ */
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "DateTime.h"
+#include "DateTimeOffset.h"
+
+namespace nfx::time
+{
+	//=====================================================================
+	// ParsePattern class
+	//=====================================================================
+
+	/**
+	 * @brief Reusable parse pattern compiled from a string at run time
+	 * @details Accepts exactly what DateTime::parse<"...">() with the same pattern accepts and
+	 *          produces the same values. Parsing does not modify the pattern, so one instance
+	 *          can be shared by any number of threads.
+	 */
+	class ParsePattern final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Compile a pattern
+		 * @param pattern strftime-style pattern, e.g. "%Y-%m-%dT%H:%M:%S.%f%z"
+		 * @throws std::invalid_argument if the pattern has an unknown specifier, repeats a field,
+		 *         lacks a year, month or day, or cannot be parsed unambiguously
+		 */
+		explicit ParsePattern( std::string_view pattern );
+
+		//----------------------------------------------
+		// Parsing
+		//----------------------------------------------
+
+		/**
+		 * @brief Parse a string laid out by the pattern into a DateTime
+		 * @param text The string to parse, which the pattern must match entirely
+		 * @param result Reference to store the parsed DateTime if successful
+		 * @return true if parsing succeeded, false otherwise
+		 * @details A %z offset is validated but not applied: the result is the local clock time.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] bool parse( std::string_view text, DateTime& result ) const noexcept;
+
+		/**
+		 * @brief Parse a string laid out by the pattern into a DateTimeOffset
+		 * @param text The string to parse, which the pattern must match entirely
+		 * @param result Reference to store the parsed DateTimeOffset if successful
+		 * @return true if parsing succeeded, false otherwise
+		 * @details Without %z in the pattern the offset is zero.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] bool parse( std::string_view text, DateTimeOffset& result ) const noexcept;
+
+		/**
+		 * @brief Parse a string laid out by the pattern and return optional DateTime
+		 * @param text The string to parse, which the pattern must match entirely
+		 * @return std::optional<DateTime> containing the parsed value if successful, std::nullopt otherwise
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::optional<DateTime> parseDateTime( std::string_view text ) const noexcept;
+
+		/**
+		 * @brief Parse a string laid out by the pattern and return optional DateTimeOffset
+		 * @param text The string to parse, which the pattern must match entirely
+		 * @return std::optional<DateTimeOffset> containing the parsed value if successful, std::nullopt otherwise
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::optional<DateTimeOffset> parseDateTimeOffset( std::string_view text ) const noexcept;
+
+		//----------------------------------------------
+		// Property accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the pattern text
+		 * @return Pattern as given to the constructor
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::string_view pattern() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Implementation
+		//----------------------------------------------
+
+		/**
+		 * @brief Run the steps and resolve the collected fields
+		 * @return true if the input matched and holds a valid date and time
+		 */
+		bool parseTicks( std::string_view text, std::int64_t& ticks, std::int32_t& offsetMinutes ) const noexcept;
+
+		//----------------------------------------------
+		// State
+		//----------------------------------------------
+
+		/** @brief Pattern text */
+		std::string m_pattern;
+
+		/** @brief Compiled steps */
+		std::vector<internal::ParseStep> m_steps;
+
+		/** @brief Literal bytes referenced by the literal steps */
+		std::string m_literals;
+	};
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/ParsePattern.inl"
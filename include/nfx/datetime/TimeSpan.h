@@ -99,6 +99,7 @@
 
 #pragma once
 
+#include <charconv>
 #include <chrono>
 #include <compare>
 #include <cstdint>
@@ -107,6 +108,9 @@
 #include <string>
 #include <string_view>
 
+#include "FixedString.h"
+#include "nfx/detail/datetime/Constants.h"
+
 namespace nfx::time
 {
 	//=====================================================================
@@ -338,6 +342,17 @@ namespace nfx::time
 		// String formatting
 		//----------------------------------------------
 
+		/**
+		 * @brief Write the ISO 8601 duration string into a caller-provided buffer without allocating
+		 * @param first Start of the buffer
+		 * @param last End of the buffer
+		 * @return { end of output, std::errc{} } on success, or { last, std::errc::value_too_large }
+		 *         if the output does not fit, in which case the buffer contents are unspecified
+		 * @details Writes the same text as toString(); constants::MAX_DURATION_LENGTH chars hold any
+		 *          value. The output is not null-terminated.
+		 */
+		std::to_chars_result toChars( char* first, char* last ) const noexcept;
+
 		/**
 		 * @brief Convert to ISO 8601 duration string
 		 * @return String representation in ISO 8601 duration format (e.g., "PT1H30M45S")
@@ -345,6 +360,13 @@ namespace nfx::time
 		 */
 		[[nodiscard]] std::string toString() const;
 
+		/**
+		 * @brief Convert to ISO 8601 duration string stored inline, without allocating
+		 * @return Same text as toString()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline FixedString<constants::MAX_DURATION_LENGTH> toFixedString() const noexcept;
+
 		//----------------------------------------------
 		// String parsing
 		//----------------------------------------------
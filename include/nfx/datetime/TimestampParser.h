@@ -0,0 +1,225 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimestampParser.h
+ * @brief Stateful ISO 8601 parser that learns the layout of a feed and specialises for it
+ * @details Strings from one source nearly always share a layout: the same fraction length,
+ *          the same offset style and the same separators. TimestampParser fingerprints the
+ *          first string it parses and checks later strings against that fingerprint with
+ *          a handful of fixed-position word compares, skipping the general parser's search
+ *          for the fraction and offset. A string that does not match is parsed by the
+ *          general parser and, if valid, becomes the new fingerprint.
+ *
+ * @par Learnable layouts:
+ * @code
+ * YYYY-MM-DDTHH:MM:SS[.f{1,7}][ Z | ±HH:MM | ±HHMM | ±HH ]
+ * @endcode
+ * Other accepted shapes (date only, single-digit fields, ...) are still parsed, always by
+ * the general parser.
+ *
+ * @par Example:
+ * @code
+ * TimestampParser parser;
+ * DateTimeOffset value;
+ * for ( std::string_view line : feed )
+ * {
+ *     if ( parser.parse( line, value ) ) { ... }
+ * }
+ * // parser.hits() counts strings served by the learned layout
+ * @endcode
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#include "DateTime.h"
+#include "DateTimeOffset.h"
+
+namespace nfx::time
+{
+	//=====================================================================
+	// TimestampParser class
+	//=====================================================================
+
+	/**
+	 * @brief ISO 8601 parser specialising itself for the layout of the strings it sees
+	 * @details Accepts exactly what DateTime::fromString() and DateTimeOffset::fromString()
+	 *          accept and produces the same values. Instances are cheap to create but hold
+	 *          mutable state, so use one per thread or per feed.
+	 */
+	class TimestampParser final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Default constructor (no layout learned yet) */
+		TimestampParser() = default;
+
+		//----------------------------------------------
+		// Parsing
+		//----------------------------------------------
+
+		/**
+		 * @brief Parse an ISO 8601 string into a DateTime
+		 * @param iso8601String Input string
+		 * @param result Receives the parsed value on success
+		 * @return true on success, with the same result as DateTime::fromString()
+		 */
+		bool parse( std::string_view iso8601String, DateTime& result ) noexcept;
+
+		/**
+		 * @brief Parse an ISO 8601 string into a DateTimeOffset
+		 * @param iso8601String Input string
+		 * @param result Receives the parsed value on success
+		 * @return true on success, with the same result as DateTimeOffset::fromString()
+		 */
+		bool parse( std::string_view iso8601String, DateTimeOffset& result ) noexcept;
+
+		//----------------------------------------------
+		// Statistics
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of strings parsed by the learned layout
+		 * @return Hit count since construction or resetStatistics()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::uint64_t hits() const noexcept;
+
+		/**
+		 * @brief Get the number of strings that needed the general parser
+		 * @return Miss count since construction or resetStatistics(), including invalid input
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::uint64_t misses() const noexcept;
+
+		/**
+		 * @brief Check whether a layout has been learned
+		 * @return true if later strings with the same layout take the specialised path
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool hasLayout() const noexcept;
+
+		/** @brief Zero the hit and miss counters, keeping the learned layout */
+		inline void resetStatistics() noexcept;
+
+		/** @brief Forget the learned layout and zero the counters */
+		inline void reset() noexcept;
+
+	private:
+		//----------------------------------------------
+		// Layout fingerprint
+		//----------------------------------------------
+
+		/** @brief Longest learnable layout: 19 + ".fffffff" + "+HH:MM" */
+		static constexpr std::size_t MAX_LAYOUT_LENGTH{ 33 };
+
+		/** @brief 8-byte words covering the longest suffix after the 19-byte prefix (the last one may overlap) */
+		static constexpr std::size_t MAX_LAYOUT_WORDS{ 2 };
+
+		/** @brief Offset suffix of a learned layout */
+		enum class OffsetStyle : std::uint8_t
+		{
+			/** @brief No suffix */
+			None,
+
+			/** @brief "Z" */
+			Utc,
+
+			/** @brief "±HH:MM" */
+			HoursColonMinutes,
+
+			/** @brief "±HHMM" */
+			HoursMinutes,
+
+			/** @brief "±HH" */
+			Hours
+		};
+
+		/** @brief Fixed byte positions and word masks of a learned layout */
+		struct Layout
+		{
+			/** @brief Exact string length; zero when nothing is learned */
+			std::uint8_t length{ 0 };
+
+			/** @brief Number of fraction digits (0-7) */
+			std::uint8_t fractionDigits{ 0 };
+
+			/** @brief Offset suffix */
+			OffsetStyle offsetStyle{ OffsetStyle::None };
+
+			/** @brief Position of the offset sign or 'Z' */
+			std::uint8_t offsetPosition{ 0 };
+
+			/** @brief Number of words checked */
+			std::uint8_t wordCount{ 0 };
+
+			/** @brief Byte offset of each checked word */
+			std::array<std::uint8_t, MAX_LAYOUT_WORDS> wordOffsets{};
+
+			/** @brief 0xFF in lanes that must hold a digit */
+			std::array<std::uint64_t, MAX_LAYOUT_WORDS> digitLanes{};
+
+			/** @brief 0xFF in every checked lane (digits and literals, not the prefix or offset sign) */
+			std::array<std::uint64_t, MAX_LAYOUT_WORDS> checkedLanes{};
+
+			/** @brief Expected bytes in the literal lanes, zero elsewhere */
+			std::array<std::uint64_t, MAX_LAYOUT_WORDS> literals{};
+		};
+
+		//----------------------------------------------
+		// Implementation
+		//----------------------------------------------
+
+		/**
+		 * @brief Parse with the learned layout
+		 * @return true if the string has the layout and valid components
+		 */
+		bool parseLearned( std::string_view iso8601String, std::int64_t& ticks, std::int64_t& offsetTicks ) const noexcept;
+
+		/** @brief Fingerprint a string the general parser accepted; clears the layout if it is not learnable */
+		void learn( std::string_view iso8601String ) noexcept;
+
+		//----------------------------------------------
+		// State
+		//----------------------------------------------
+
+		/** @brief Learned layout */
+		Layout m_layout;
+
+		/** @brief Strings served by the learned layout */
+		std::uint64_t m_hits{ 0 };
+
+		/** @brief Strings served by the general parser */
+		std::uint64_t m_misses{ 0 };
+	};
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/TimestampParser.inl"
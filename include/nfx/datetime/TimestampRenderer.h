@@ -0,0 +1,185 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimestampRenderer.h
+ * @brief Allocation-free ISO 8601 extended rendering that reuses the prefix of the current second
+ * @details Log lines are stamped with the current time, so consecutive stamps nearly always
+ *          fall in the same second and differ only in their fraction digits. TimestampRenderer
+ *          keeps the rendered "YYYY-MM-DDTHH:MM:SS" prefix of the last period it saw. A value
+ *          in the same period is written as a 19-byte copy followed by the fraction and 'Z';
+ *          only a value in a new period goes through the calendar decomposition. With minute
+ *          granularity the cached prefix covers "YYYY-MM-DDTHH:MM" and the seconds digits are
+ *          patched in as well.
+ *
+ * @par Example:
+ * @code
+ * thread_local TimestampRenderer renderer;
+ * char stamp[TimestampRenderer::MAX_LENGTH];
+ * const auto result{ renderer.renderNow( stamp, stamp + sizeof( stamp ) ) };
+ * // std::string_view{ stamp, result.ptr } == DateTime::utcNow().toIso8601Extended() at that instant
+ * @endcode
+ */
+
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+
+#include "DateTime.h"
+
+namespace nfx::time
+{
+	//=====================================================================
+	// TimestampRenderer class
+	//=====================================================================
+
+	/**
+	 * @brief ISO 8601 extended renderer caching the prefix of the current second or minute
+	 * @details Output is byte for byte that of DateTime::toChars( ..., DateTime::Format::Iso8601Extended ),
+	 *          for any input order. Instances hold mutable state and never allocate, so use one
+	 *          per thread.
+	 */
+	class TimestampRenderer final
+	{
+	public:
+		//----------------------------------------------
+		// Cache granularity
+		//----------------------------------------------
+
+		/** @brief Span of time covered by the cached prefix */
+		enum class Granularity : std::uint8_t
+		{
+			/** @brief "YYYY-MM-DDTHH:MM:SS" is reused; only the fraction is written */
+			Second,
+
+			/** @brief "YYYY-MM-DDTHH:MM" is reused; seconds and fraction are written */
+			Minute
+		};
+
+		/** @brief Longest output: "YYYY-MM-DDTHH:MM:SS.fffffffZ" */
+		static constexpr std::size_t MAX_LENGTH{ 28 };
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Construct with an empty cache
+		 * @param granularity Span of time covered by the cached prefix
+		 */
+		explicit inline TimestampRenderer( Granularity granularity = Granularity::Second ) noexcept;
+
+		//----------------------------------------------
+		// Rendering
+		//----------------------------------------------
+
+		/**
+		 * @brief Write a value in ISO 8601 extended format into a caller-provided buffer
+		 * @param value Value to render
+		 * @param first Start of the buffer
+		 * @param last End of the buffer
+		 * @return { end of output, std::errc{} } on success, or { last, std::errc::value_too_large }
+		 *         if the output does not fit, exactly as DateTime::toChars()
+		 * @details A buffer of MAX_LENGTH chars holds every value. The output is not null-terminated.
+		 */
+		std::to_chars_result render( const DateTime& value, char* first, char* last ) noexcept;
+
+		/**
+		 * @brief Write the current UTC time in ISO 8601 extended format
+		 * @param first Start of the buffer
+		 * @param last End of the buffer
+		 * @return As render()
+		 */
+		inline std::to_chars_result renderNow( char* first, char* last ) noexcept;
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the cache granularity
+		 * @return Granularity given at construction
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline Granularity granularity() const noexcept;
+
+		//----------------------------------------------
+		// Statistics
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of values served from the cached prefix
+		 * @return Count since construction or resetStatistics()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::uint64_t hits() const noexcept;
+
+		/**
+		 * @brief Get the number of values that needed a new prefix
+		 * @return Count since construction or resetStatistics()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::uint64_t misses() const noexcept;
+
+		/** @brief Zero the counters, keeping the cached prefix */
+		inline void resetStatistics() noexcept;
+
+		/** @brief Drop the cached prefix and zero the counters */
+		inline void reset() noexcept;
+
+	private:
+		//----------------------------------------------
+		// Implementation
+		//----------------------------------------------
+
+		/** @brief Render the prefix of the period containing ticks and make it the cached one */
+		void refresh( std::int64_t ticks ) noexcept;
+
+		//----------------------------------------------
+		// State
+		//----------------------------------------------
+
+		/** @brief Ticks per cached period (one second or one minute) */
+		std::int64_t m_periodTicks;
+
+		/** @brief Ticks at the start of the cached period */
+		std::int64_t m_periodStart{ 0 };
+
+		/** @brief Whether the fields above and m_prefix hold a period */
+		bool m_cached{ false };
+
+		/** @brief "YYYY-MM-DDTHH:MM:SS" of the cached period (seconds of its first second for minute granularity) */
+		char m_prefix[19]{};
+
+		/** @brief Values served from the cached prefix */
+		std::uint64_t m_hits{ 0 };
+
+		/** @brief Values that needed a new prefix */
+		std::uint64_t m_misses{ 0 };
+	};
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/TimestampRenderer.inl"
@@ -0,0 +1,213 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimestampScanner.h
+ * @brief Streaming extraction of one ISO 8601 timestamp field per line from CSV or NDJSON
+ * @details Scans raw byte buffers for line boundaries and field separators with the same
+ *          runtime-dispatched SIMD levels as the batch kernels (see batch::setSimdLevel()),
+ *          then parses the selected field of every line in place. Input may be handed over
+ *          as one buffer or as arbitrary chunks; only a line split across two chunks is
+ *          copied, everything else is parsed straight from the caller's memory.
+ *
+ * @par Stream layout:
+ * @code
+ * ┌───────────────── chunk 1 ─────────────────┬──────────── chunk 2 ────────────┐
+ * │ a,2024-06-15T13:45:30Z,x\n b,2024-06-1    │ 5T13:45:31Z,y\n c,...\n         │
+ * └───────────────────────────────────────────┴─────────────────────────────────┘
+ *     └─ Record{ offset 2 } ─┘   └─ carried over, parsed when chunk 2 arrives ─┘
+ * @endcode
+ *
+ * @par Supported input:
+ * - Lines end with '\n'; a trailing '\r' before it is ignored. Empty lines are skipped.
+ * - CSV: the field is selected by zero-based column index. A field enclosed in double
+ *   quotes is unquoted, but quoted fields before it must not contain the delimiter.
+ * - NDJSON: the field is the string value of the first occurrence of the key on the line,
+ *   at any nesting depth. Escape sequences inside that value are not decoded.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "DateTime.h"
+#include "DateTimeOffset.h"
+
+namespace nfx::time
+{
+	//=====================================================================
+	// TimestampScanner class
+	//=====================================================================
+
+	/**
+	 * @brief Incremental scanner extracting one timestamp field per line of CSV or NDJSON input
+	 * @details Byte offsets are absolute positions in the stream, counted from the first byte
+	 *          fed since construction or the last reset().
+	 */
+	class TimestampScanner final
+	{
+	public:
+		//----------------------------------------------
+		// Record structure
+		//----------------------------------------------
+
+		/** @brief Timestamp field extracted from one non-empty line */
+		struct Record
+		{
+			/** @brief Parsed value; default-constructed when valid is false */
+			DateTimeOffset value;
+
+			/** @brief Stream offset of the first byte of the field (of the line when the field is missing) */
+			std::uint64_t offset;
+
+			/** @brief Length of the field in bytes, excluding quotes */
+			std::uint32_t length;
+
+			/** @brief Zero-based line number in the stream */
+			std::uint64_t line;
+
+			/** @brief true if the field was found and parsed as an ISO 8601 timestamp */
+			bool valid;
+
+			/**
+			 * @brief Get the value as a DateTime
+			 * @return Local clock time of the field, as DateTime::fromString() would parse it
+			 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+			 */
+			[[nodiscard]] inline DateTime dateTime() const noexcept;
+		};
+
+		//----------------------------------------------
+		// Factory methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Create a scanner for delimiter-separated lines
+		 * @param column Zero-based index of the timestamp column
+		 * @param delimiter Field separator (',' for CSV, '\t' for TSV)
+		 * @param hasHeader Skip the first line of the stream
+		 * @return Scanner ready for feed()
+		 * @throws std::invalid_argument if delimiter is '\n', '\r' or '"'
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static TimestampScanner csv( std::size_t column, char delimiter = ',', bool hasHeader = false );
+
+		/**
+		 * @brief Create a scanner for newline-delimited JSON objects
+		 * @param key Name of the member holding the timestamp string
+		 * @return Scanner ready for feed()
+		 * @throws std::invalid_argument if key is empty or contains '"', '\\' or '\n'
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static TimestampScanner ndjson( std::string_view key );
+
+		//----------------------------------------------
+		// Scanning
+		//----------------------------------------------
+
+		/**
+		 * @brief Scan the next chunk of the stream
+		 * @param chunk Bytes following the previously fed chunk
+		 * @param records Receives one record per complete non-empty line (appended)
+		 * @return Number of records appended
+		 * @details A line left incomplete at the end of the chunk is kept until its newline
+		 *          arrives in a later chunk or finish() is called.
+		 */
+		std::size_t feed( std::span<const char> chunk, std::vector<Record>& records );
+
+		/**
+		 * @brief Flush the final line if the stream does not end with a newline
+		 * @param records Receives the record of that line, if any (appended)
+		 * @return Number of records appended (0 or 1)
+		 * @details The scanner is reset afterwards and can be reused for a new stream.
+		 */
+		std::size_t finish( std::vector<Record>& records );
+
+		/**
+		 * @brief Scan a complete buffer as a stream of its own
+		 * @param buffer Entire input
+		 * @param records Receives one record per non-empty line (appended)
+		 * @return Number of records appended
+		 * @details Equivalent to reset(), feed( buffer ) and finish().
+		 */
+		std::size_t scan( std::span<const char> buffer, std::vector<Record>& records );
+
+		/** @brief Discard any carried-over partial line and restart offsets and line numbers at zero */
+		void reset() noexcept;
+
+	private:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Scanner configured by one of the factory methods */
+		TimestampScanner() = default;
+
+		//----------------------------------------------
+		// Implementation
+		//----------------------------------------------
+
+		/** @brief Extract the field of one complete line (without its '\n') and append its record */
+		std::size_t processLine( std::string_view line, std::uint64_t lineOffset, std::vector<Record>& records );
+
+		//----------------------------------------------
+		// Configuration
+		//----------------------------------------------
+
+		/** @brief Whether lines are JSON objects rather than delimited fields */
+		bool m_json{ false };
+
+		/** @brief CSV column index */
+		std::size_t m_column{ 0 };
+
+		/** @brief CSV field separator */
+		char m_delimiter{ ',' };
+
+		/** @brief Skip line 0 of the stream */
+		bool m_hasHeader{ false };
+
+		/** @brief JSON key including its quotes, e.g. "\"ts\"" */
+		std::string m_quotedKey;
+
+		//----------------------------------------------
+		// Stream state
+		//----------------------------------------------
+
+		/** @brief Partial line carried over from the previous chunk */
+		std::string m_carry;
+
+		/** @brief Stream offset of the next byte to be fed */
+		std::uint64_t m_position{ 0 };
+
+		/** @brief Number of the next line */
+		std::uint64_t m_line{ 0 };
+	};
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/TimestampScanner.inl"
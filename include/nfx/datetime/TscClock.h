@@ -0,0 +1,232 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TscClock.h
+ * @brief High-frequency UTC wall clock driven by the CPU time-stamp counter
+ * @details Reading the system clock costs a vDSO call and a hardware counter read per
+ *          timestamp. TscClock reads the time-stamp counter directly and converts cycles to
+ *          DateTime ticks with a fixed-point multiply against an anchor taken from the
+ *          system clock. The counter frequency is measured once at construction and refined
+ *          every time the clock re-anchors, so the error between two anchors stays bounded
+ *          by the re-anchor interval times the residual frequency error.
+ *
+ * @par Conversion:
+ * @code
+ * ticks = anchorTicks + ( ( tsc - anchorTsc ) * multiplier ) >> 32
+ *
+ * ──●────────── re-anchor interval ──────────●──────────────────●──▶ tsc
+ *   anchor: ( tsc, system clock )            anchor             anchor
+ * @endcode
+ *
+ * The time-stamp counter is only used when CPUID reports it invariant (constant rate in
+ * every power state). On other processors and architectures every read falls back to the
+ * system clock (clock_gettime( CLOCK_REALTIME ) on Linux).
+ *
+ * @par Example:
+ * @code
+ * TscClock& clock{ TscClock::shared() }; // calibrated on first use
+ * const DateTime start{ clock.now() };
+ * ...
+ * const TimeSpan elapsed{ clock.now() - start };
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "DateTime.h"
+#include "TimeSpan.h"
+
+namespace nfx::time
+{
+	//=====================================================================
+	// TscClock class
+	//=====================================================================
+
+	/**
+	 * @brief Calibrated time-stamp counter clock returning DateTime ticks
+	 * @details All member functions are thread-safe. Readers never block: a reader that finds
+	 *          the anchor older than the re-anchor interval refreshes it, and concurrent
+	 *          readers keep using the previous calibration meanwhile. Readings are not
+	 *          guaranteed monotonic across a re-anchor, which may move the clock by the drift
+	 *          accumulated since the previous anchor (or by a system clock step).
+	 */
+	class TscClock final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Calibrate a clock against the system clock
+		 * @param reanchorInterval Maximum age of the anchor before a reader refreshes it;
+		 *        non-positive values select the default of one second
+		 * @details Blocks for the calibration window (a few milliseconds) when the
+		 *          time-stamp counter is usable, returns immediately otherwise.
+		 */
+		explicit TscClock( TimeSpan reanchorInterval = TimeSpan::fromSeconds( 1.0 ) ) noexcept;
+
+		/** @brief Copy constructor (deleted; readers share one calibration) */
+		TscClock( const TscClock& ) = delete;
+
+		/** @brief Copy assignment (deleted; readers share one calibration) */
+		TscClock& operator=( const TscClock& ) = delete;
+
+		/**
+		 * @brief Get the process-wide clock
+		 * @return Clock with the default re-anchor interval, calibrated on first use
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static TscClock& shared() noexcept;
+
+		//----------------------------------------------
+		// Reading
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the current UTC time in ticks
+		 * @return 100-nanosecond ticks since 0001-01-01, as DateTime::utcNow().ticks()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] std::int64_t nowTicks() noexcept;
+
+		/**
+		 * @brief Get the current UTC time
+		 * @return DateTime holding nowTicks()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline DateTime now() noexcept;
+
+		/** @brief Take a new anchor from the system clock and refine the frequency estimate */
+		void reanchor() noexcept;
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Check whether readings come from the time-stamp counter
+		 * @return false when every reading falls back to the system clock
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool isTscBacked() const noexcept;
+
+		/**
+		 * @brief Get the current estimate of the counter frequency
+		 * @return Cycles per second, or 0 when the clock is not TSC-backed
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] double frequency() const noexcept;
+
+		/**
+		 * @brief Get the re-anchor interval
+		 * @return Maximum age of the anchor before a reader refreshes it
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline TimeSpan reanchorInterval() const noexcept;
+
+		/**
+		 * @brief Check whether the processor has an invariant time-stamp counter
+		 * @return true on x86-64 processors whose counter runs at a constant rate in every
+		 *         power state
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static bool isInvariantTscSupported() noexcept;
+
+	private:
+		//----------------------------------------------
+		// Calibration
+		//----------------------------------------------
+
+		/** @brief Counter reading paired with the system clock reading taken at the same moment */
+		struct Sample
+		{
+			/** @brief Time-stamp counter */
+			std::int64_t tsc;
+
+			/** @brief System clock in ticks */
+			std::int64_t ticks;
+		};
+
+		/** @brief Pair a counter reading with the system clock, keeping the tightest of a few attempts */
+		static Sample sample() noexcept;
+
+		/** @brief Publish an anchor and the current frequency estimate to readers */
+		void publish( const Sample& anchor ) noexcept;
+
+		/**
+		 * @brief Slow path of nowTicks() once the anchor is older than the re-anchor interval
+		 * @return Current time from the system clock
+		 */
+		std::int64_t refresh() noexcept;
+
+		//----------------------------------------------
+		// Configuration
+		//----------------------------------------------
+
+		/** @brief Re-anchor interval in ticks */
+		std::int64_t m_reanchorTicks;
+
+		/** @brief Whether the counter is used at all */
+		bool m_tscBacked{ false };
+
+		//----------------------------------------------
+		// Published calibration (seqlock)
+		//----------------------------------------------
+
+		/** @brief Even while the calibration below is stable, odd while it is being written */
+		std::atomic<std::uint64_t> m_sequence{ 0 };
+
+		/** @brief Counter value of the anchor */
+		std::atomic<std::int64_t> m_anchorTsc{ 0 };
+
+		/** @brief System clock ticks of the anchor */
+		std::atomic<std::int64_t> m_anchorTicks{ 0 };
+
+		/** @brief Ticks per cycle in 32.32 fixed point */
+		std::atomic<std::uint64_t> m_multiplier{ 0 };
+
+		/** @brief Counter delta after which the anchor is refreshed */
+		std::atomic<std::int64_t> m_reanchorCycles{ 0 };
+
+		//----------------------------------------------
+		// Frequency estimate (guarded by m_updating)
+		//----------------------------------------------
+
+		/** @brief Set while one thread re-anchors */
+		std::atomic<bool> m_updating{ false };
+
+		/** @brief Start of the baseline the frequency is measured over */
+		Sample m_baseline{ 0, 0 };
+
+		/** @brief Current estimate in ticks per cycle */
+		double m_ticksPerCycle{ 0.0 };
+	};
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/TscClock.inl"
@@ -0,0 +1,171 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Batch.inl
+ * @brief Inline implementations for batch operation helper types
+ */
+
+#include <bit>
+
+namespace nfx::time::batch
+{
+	//=====================================================================
+	// ErrorBitmap class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Modifiers
+	//----------------------------------------------
+
+	inline void ErrorBitmap::reset( std::size_t rows )
+	{
+		m_words.assign( ( rows + 63 ) / 64, 0 );
+		m_size = rows;
+	}
+
+	inline void ErrorBitmap::set( std::size_t row ) noexcept
+	{
+		m_words[row >> 6] |= std::uint64_t{ 1 } << ( row & 63 );
+	}
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	inline std::size_t ErrorBitmap::size() const noexcept
+	{
+		return m_size;
+	}
+
+	inline bool ErrorBitmap::test( std::size_t row ) const noexcept
+	{
+		return ( m_words[row >> 6] >> ( row & 63 ) ) & 1;
+	}
+
+	inline std::size_t ErrorBitmap::count() const noexcept
+	{
+		std::size_t total{ 0 };
+		for ( const auto word : m_words )
+		{
+			total += static_cast<std::size_t>( std::popcount( word ) );
+		}
+
+		return total;
+	}
+
+	inline bool ErrorBitmap::any() const noexcept
+	{
+		for ( const auto word : m_words )
+		{
+			if ( word != 0 )
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	inline std::span<const std::uint64_t> ErrorBitmap::words() const noexcept
+	{
+		return m_words;
+	}
+
+	inline std::span<std::uint64_t> ErrorBitmap::words() noexcept
+	{
+		return m_words;
+	}
+
+	//=====================================================================
+	// StringColumn struct
+	//=====================================================================
+
+	inline std::size_t StringColumn::size() const noexcept
+	{
+		return offsets.empty() ? 0 : offsets.size() - 1;
+	}
+
+	//=====================================================================
+	// OutputBuffer class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline OutputBuffer::OutputBuffer( std::pmr::memory_resource* resource )
+		: m_offsets{ resource },
+		  m_data{ resource }
+	{
+		m_offsets.push_back( 0 );
+	}
+
+	//----------------------------------------------
+	// Modifiers
+	//----------------------------------------------
+
+	inline void OutputBuffer::clear() noexcept
+	{
+		m_offsets.resize( 1 );
+		m_data.clear();
+	}
+
+	inline void OutputBuffer::reserve( std::size_t rows, std::size_t bytes )
+	{
+		m_offsets.reserve( m_offsets.size() + rows );
+		m_data.reserve( m_data.size() + bytes );
+	}
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	inline std::size_t OutputBuffer::size() const noexcept
+	{
+		return m_offsets.size() - 1;
+	}
+
+	inline bool OutputBuffer::empty() const noexcept
+	{
+		return m_offsets.size() == 1;
+	}
+
+	inline std::string_view OutputBuffer::operator[]( std::size_t row ) const noexcept
+	{
+		const auto begin{ static_cast<std::size_t>( m_offsets[row] ) };
+
+		return { m_data.data() + begin, static_cast<std::size_t>( m_offsets[row + 1] ) - begin };
+	}
+
+	inline std::span<const std::int64_t> OutputBuffer::offsets() const noexcept
+	{
+		return m_offsets;
+	}
+
+	inline std::span<const char> OutputBuffer::data() const noexcept
+	{
+		return m_data;
+	}
+} // namespace nfx::time::batch
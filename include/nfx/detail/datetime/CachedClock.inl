@@ -0,0 +1,73 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CachedClock.inl
+ * @brief Inline implementations for CachedClock reading and accessors
+ */
+
+namespace nfx::time
+{
+	//=====================================================================
+	// CachedClock class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Lifecycle
+	//----------------------------------------------
+
+	inline bool CachedClock::isRunning() const noexcept
+	{
+		return m_ticks.load( std::memory_order_relaxed ) != 0;
+	}
+
+	//----------------------------------------------
+	// Reading
+	//----------------------------------------------
+
+	inline std::int64_t CachedClock::nowTicks() const noexcept
+	{
+		const std::int64_t ticks{ m_ticks.load( std::memory_order_relaxed ) };
+		if ( ticks != 0 ) [[likely]]
+		{
+			return ticks;
+		}
+
+		return DateTime::utcNow().ticks();
+	}
+
+	inline DateTime CachedClock::now() const noexcept
+	{
+		return DateTime{ nowTicks() };
+	}
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	inline TimeSpan CachedClock::period() const noexcept
+	{
+		return TimeSpan{ m_periodTicks };
+	}
+} // namespace nfx::time
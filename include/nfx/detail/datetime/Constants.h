@@ -188,6 +188,12 @@ namespace nfx::time::constants
 	 */
 	inline constexpr std::size_t MIN_ISO8601_LENGTH{ 20 };
 
+	/**
+	 * @brief Maximum length of ISO 8601 duration string
+	 * @details "-P10675199DT2H48M5.4775808S" (TimeSpan minimum value)
+	 */
+	inline constexpr std::size_t MAX_DURATION_LENGTH{ 27 };
+
 	//----------------------------------------------
 	// Unix epoch format limits
 	//----------------------------------------------
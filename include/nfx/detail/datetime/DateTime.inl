@@ -30,9 +30,13 @@
  *          main header to improve compilation times while maintaining zero-cost abstractions.
  */
 
+#include <array>
 #include <stdexcept>
+#include <string_view>
 
 #include "Constants.h"
+#include "Formatter.h"
+#include "Iso8601.h"
 
 namespace nfx::time
 {
@@ -179,66 +183,13 @@ namespace nfx::time
 			return 0;
 		}
 
-		if ( month == 2 && isLeapYear( year ) )
+		if ( month == 2 )
 		{
-			return 29;
+			return isLeapYear( year ) ? 29 : 28;
 		}
 
-		switch ( month )
-		{
-			case 1:
-			{
-				return 31;
-			}
-			case 2:
-			{
-				return 28; // Non-leap year February
-			}
-			case 3:
-			{
-				return 31;
-			}
-			case 4:
-			{
-				return 30;
-			}
-			case 5:
-			{
-				return 31;
-			}
-			case 6:
-			{
-				return 30;
-			}
-			case 7:
-			{
-				return 31;
-			}
-			case 8:
-			{
-				return 31;
-			}
-			case 9:
-			{
-				return 30;
-			}
-			case 10:
-			{
-				return 31;
-			}
-			case 11:
-			{
-				return 30;
-			}
-			case 12:
-			{
-				return 31;
-			}
-			default:
-			{
-				return 0;
-			}
-		}
+		// 31-day months alternate parity across the July/August boundary
+		return 30 + ( ( month ^ ( month >> 3 ) ) & 1 );
 	}
 
 	//----------------------------------------------
@@ -274,6 +225,45 @@ namespace nfx::time
 		return DateTime{ ticks };
 	}
 
+	template <internal::PatternLiteral Pattern>
+	inline constexpr bool DateTime::parse( std::string_view text, DateTime& result ) noexcept
+	{
+		std::int64_t ticks{ 0 };
+		std::int32_t offsetMinutes{ 0 };
+		if ( !internal::parseWithPattern<Pattern>( text, ticks, offsetMinutes ) )
+		{
+			return false;
+		}
+
+		result = DateTime{ ticks };
+
+		return true;
+	}
+
+	template <internal::PatternLiteral Pattern>
+	inline constexpr std::optional<DateTime> DateTime::parse( std::string_view text ) noexcept
+	{
+		DateTime result;
+		if ( parse<Pattern>( text, result ) )
+		{
+			return result;
+		}
+		return std::nullopt;
+	}
+
+	//----------------------------------------------
+	// String formatting
+	//----------------------------------------------
+
+	inline FixedString<constants::MAX_ISO8601_LENGTH> DateTime::toFixedString( Format format ) const noexcept
+	{
+		FixedString<constants::MAX_ISO8601_LENGTH> result;
+		const auto written{ toChars( result.data(), result.data() + result.capacity(), format ) };
+		result.resize( written.ec == std::errc{} ? static_cast<std::size_t>( written.ptr - result.data() ) : 0 );
+
+		return result;
+	}
+
 	//=====================================================================
 	// Stream operators
 	//=====================================================================
@@ -281,25 +271,82 @@ namespace nfx::time
 	std::ostream& operator<<( std::ostream& os, const DateTime& dateTime );
 
 	std::istream& operator>>( std::istream& is, DateTime& dateTime );
+
+	//=====================================================================
+	// User-defined literals
+	//=====================================================================
+
+	namespace literals
+	{
+		consteval DateTime operator""_dt( const char* iso8601String, std::size_t length )
+		{
+			std::int64_t ticks{ 0 };
+			if ( !internal::parseDateTime( { iso8601String, length }, ticks ) )
+			{
+				throw std::invalid_argument{ "Invalid ISO 8601 DateTime literal" };
+			}
+
+			return DateTime{ ticks };
+		}
+	} // namespace literals
 } // namespace nfx::time
 
 //=====================================================================
 // std::formatter specialization
 //=====================================================================
 
+namespace nfx::time::internal
+{
+	/** @brief Format spec names accepted by the DateTime and DateTimeOffset formatters */
+	inline constexpr std::array<std::string_view, 7> DATETIME_FORMAT_NAMES{ "iso", "ext", "offset", "date", "time", "unix", "ms" };
+
+	/** @brief Format written for each name in DATETIME_FORMAT_NAMES */
+	inline constexpr std::array<DateTime::Format, 7> DATETIME_FORMATS{
+		DateTime::Format::Iso8601Basic,
+		DateTime::Format::Iso8601Extended,
+		DateTime::Format::Iso8601WithOffset,
+		DateTime::Format::DateOnly,
+		DateTime::Format::TimeOnly,
+		DateTime::Format::UnixSeconds,
+		DateTime::Format::UnixMilliseconds };
+} // namespace nfx::time::internal
+
 namespace std
 {
+	/**
+	 * @brief Formats a DateTime with an optional spec, e.g. std::format( "{:ext}", dt )
+	 * @details Specs: empty or "iso" (Iso8601Basic), "ext" (Iso8601Extended), "offset"
+	 *          (Iso8601WithOffset), "date" (DateOnly), "time" (TimeOnly), "unix" (UnixSeconds),
+	 *          "ms" (UnixMilliseconds), or a FormatPattern pattern such as "%Y-%m-%d %H:%M".
+	 *          Output goes straight to the format context without a temporary std::string.
+	 */
 	template <>
 	struct formatter<nfx::time::DateTime>
 	{
 		constexpr auto parse( std::format_parse_context& ctx )
 		{
-			return ctx.begin();
+			return nfx::time::internal::parseFormatSpec( ctx, nfx::time::internal::DATETIME_FORMAT_NAMES, false, m_spec );
 		}
 
-		auto format( const nfx::time::DateTime& dt, std::format_context& ctx ) const
+		template <typename FormatContext>
+		auto format( const nfx::time::DateTime& dt, FormatContext& ctx ) const
 		{
-			return format_to( ctx.out(), "{}", dt.toString() );
+			if ( m_spec.isPattern )
+			{
+				char buffer[nfx::time::internal::FormatSpec::MAX_OUTPUT_LENGTH];
+				const char* end{ nfx::time::internal::writeFormatSteps(
+					m_spec.steps.data(), m_spec.stepCount, m_spec.literals.data(), nfx::time::internal::calendarFormatFields( dt.components() ), buffer + 0 ) };
+
+				return nfx::time::internal::writeFormatted( ctx, buffer, end );
+			}
+
+			char buffer[nfx::time::internal::FORMAT_BUFFER_LENGTH];
+			const auto result{ dt.toChars( buffer, buffer + sizeof( buffer ), nfx::time::internal::DATETIME_FORMATS[m_spec.name] ) };
+
+			return nfx::time::internal::writeFormatted( ctx, buffer, result.ptr );
 		}
+
+	private:
+		nfx::time::internal::FormatSpec m_spec;
 	};
 } // namespace std
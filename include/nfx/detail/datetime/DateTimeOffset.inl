@@ -34,6 +34,8 @@
 #include <stdexcept>
 
 #include "Constants.h"
+#include "Formatter.h"
+#include "Iso8601.h"
 
 namespace nfx::time
 {
@@ -253,6 +255,11 @@ namespace nfx::time
 		return static_cast<std::int32_t>( m_offset.minutes() );
 	}
 
+	inline DateTime::Components DateTimeOffset::components() const noexcept
+	{
+		return m_dateTime.components();
+	}
+
 	//----------------------------------------------
 	// Conversion methods
 	//----------------------------------------------
@@ -306,6 +313,49 @@ namespace nfx::time
 		return m_dateTime == other.m_dateTime && m_offset == other.m_offset;
 	}
 
+	//----------------------------------------------
+	// Static factory methods
+	//----------------------------------------------
+
+	template <internal::PatternLiteral Pattern>
+	inline constexpr bool DateTimeOffset::parse( std::string_view text, DateTimeOffset& result ) noexcept
+	{
+		std::int64_t ticks{ 0 };
+		std::int32_t offsetMinutes{ 0 };
+		if ( !internal::parseWithPattern<Pattern>( text, ticks, offsetMinutes ) )
+		{
+			return false;
+		}
+
+		result = DateTimeOffset{ ticks, TimeSpan{ offsetMinutes * constants::TICKS_PER_MINUTE } };
+
+		return true;
+	}
+
+	template <internal::PatternLiteral Pattern>
+	inline constexpr std::optional<DateTimeOffset> DateTimeOffset::parse( std::string_view text ) noexcept
+	{
+		DateTimeOffset result;
+		if ( parse<Pattern>( text, result ) )
+		{
+			return result;
+		}
+		return std::nullopt;
+	}
+
+	//----------------------------------------------
+	// String formatting
+	//----------------------------------------------
+
+	inline FixedString<constants::MAX_ISO8601_LENGTH> DateTimeOffset::toFixedString( DateTime::Format format ) const noexcept
+	{
+		FixedString<constants::MAX_ISO8601_LENGTH> result;
+		const auto written{ toChars( result.data(), result.data() + result.capacity(), format ) };
+		result.resize( written.ec == std::errc{} ? static_cast<std::size_t>( written.ptr - result.data() ) : 0 );
+
+		return result;
+	}
+
 	//=====================================================================
 	// Stream operators
 	//=====================================================================
@@ -313,6 +363,25 @@ namespace nfx::time
 	std::ostream& operator<<( std::ostream& os, const DateTimeOffset& dateTimeOffset );
 
 	std::istream& operator>>( std::istream& is, DateTimeOffset& dateTimeOffset );
+
+	//=====================================================================
+	// User-defined literals
+	//=====================================================================
+
+	namespace literals
+	{
+		consteval DateTimeOffset operator""_dto( const char* iso8601String, std::size_t length )
+		{
+			std::int64_t ticks{ 0 };
+			std::int64_t offsetTicks{ 0 };
+			if ( !internal::parseDateTimeOffset( { iso8601String, length }, ticks, offsetTicks ) )
+			{
+				throw std::invalid_argument{ "Invalid ISO 8601 DateTimeOffset literal" };
+			}
+
+			return DateTimeOffset{ ticks, TimeSpan{ offsetTicks } };
+		}
+	} // namespace literals
 } // namespace nfx::time
 
 //=====================================================================
@@ -321,17 +390,41 @@ namespace nfx::time
 
 namespace std
 {
+	/**
+	 * @brief Formats a DateTimeOffset with an optional spec, e.g. std::format( "{:date}", dto )
+	 * @details Accepts the DateTime formatter specs; a pattern writes the local clock time and
+	 *          %z writes the offset. Output goes straight to the format context without a
+	 *          temporary std::string.
+	 */
 	template <>
 	struct formatter<nfx::time::DateTimeOffset>
 	{
 		constexpr auto parse( std::format_parse_context& ctx )
 		{
-			return ctx.begin();
+			return nfx::time::internal::parseFormatSpec( ctx, nfx::time::internal::DATETIME_FORMAT_NAMES, false, m_spec );
 		}
 
-		auto format( const nfx::time::DateTimeOffset& dto, std::format_context& ctx ) const
+		template <typename FormatContext>
+		auto format( const nfx::time::DateTimeOffset& dto, FormatContext& ctx ) const
 		{
-			return format_to( ctx.out(), "{}", dto.toString() );
+			if ( m_spec.isPattern )
+			{
+				auto fields{ nfx::time::internal::calendarFormatFields( dto.dateTime().components() ) };
+				fields.offsetMinutes = static_cast<std::int32_t>( dto.offset().ticks() / nfx::time::constants::TICKS_PER_MINUTE );
+
+				char buffer[nfx::time::internal::FormatSpec::MAX_OUTPUT_LENGTH];
+				const char* end{ nfx::time::internal::writeFormatSteps( m_spec.steps.data(), m_spec.stepCount, m_spec.literals.data(), fields, buffer + 0 ) };
+
+				return nfx::time::internal::writeFormatted( ctx, buffer, end );
+			}
+
+			char buffer[nfx::time::internal::FORMAT_BUFFER_LENGTH];
+			const auto result{ dto.toChars( buffer, buffer + sizeof( buffer ), nfx::time::internal::DATETIME_FORMATS[m_spec.name] ) };
+
+			return nfx::time::internal::writeFormatted( ctx, buffer, result.ptr );
 		}
+
+	private:
+		nfx::time::internal::FormatSpec m_spec;
 	};
 } // namespace std
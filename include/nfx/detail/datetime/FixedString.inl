@@ -0,0 +1,159 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FixedString.inl
+ * @brief Inline implementations for FixedString
+ */
+
+namespace nfx::time
+{
+	//=====================================================================
+	// FixedString class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <std::size_t N>
+	constexpr inline FixedString<N>::FixedString( std::string_view text ) noexcept
+	{
+		const std::size_t count{ text.size() < N ? text.size() : N };
+		for ( std::size_t i{ 0 }; i < count; ++i )
+		{
+			m_data[i] = text[i];
+		}
+		resize( count );
+	}
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	template <std::size_t N>
+	constexpr inline const char* FixedString<N>::data() const noexcept
+	{
+		return m_data;
+	}
+
+	template <std::size_t N>
+	constexpr inline char* FixedString<N>::data() noexcept
+	{
+		return m_data;
+	}
+
+	template <std::size_t N>
+	constexpr inline const char* FixedString<N>::c_str() const noexcept
+	{
+		return m_data;
+	}
+
+	template <std::size_t N>
+	constexpr inline std::size_t FixedString<N>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <std::size_t N>
+	constexpr inline bool FixedString<N>::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <std::size_t N>
+	constexpr inline std::size_t FixedString<N>::capacity() noexcept
+	{
+		return N;
+	}
+
+	template <std::size_t N>
+	constexpr inline const char* FixedString<N>::begin() const noexcept
+	{
+		return m_data;
+	}
+
+	template <std::size_t N>
+	constexpr inline const char* FixedString<N>::end() const noexcept
+	{
+		return m_data + m_size;
+	}
+
+	template <std::size_t N>
+	constexpr inline void FixedString<N>::resize( std::size_t count ) noexcept
+	{
+		m_size = static_cast<std::uint8_t>( count < N ? count : N );
+		m_data[m_size] = '\0';
+	}
+
+	//----------------------------------------------
+	// Conversion
+	//----------------------------------------------
+
+	template <std::size_t N>
+	constexpr inline std::string_view FixedString<N>::view() const noexcept
+	{
+		return { m_data, m_size };
+	}
+
+	template <std::size_t N>
+	constexpr inline FixedString<N>::operator std::string_view() const noexcept
+	{
+		return view();
+	}
+
+	template <std::size_t N>
+	inline std::string FixedString<N>::str() const
+	{
+		return std::string{ m_data, m_size };
+	}
+
+	//=====================================================================
+	// Stream operators
+	//=====================================================================
+
+	template <std::size_t N>
+	inline std::ostream& operator<<( std::ostream& os, const FixedString<N>& text )
+	{
+		return os << text.view();
+	}
+} // namespace nfx::time
+
+//=====================================================================
+// std::formatter specialization
+//=====================================================================
+
+namespace std
+{
+	/** @brief Formats a FixedString like a std::string_view, with the same spec */
+	template <std::size_t N>
+	struct formatter<nfx::time::FixedString<N>> : formatter<std::string_view>
+	{
+		template <typename FormatContext>
+		auto format( const nfx::time::FixedString<N>& text, FormatContext& ctx ) const
+		{
+			return formatter<std::string_view>::format( text.view(), ctx );
+		}
+	};
+} // namespace std
@@ -0,0 +1,143 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FormatPattern.inl
+ * @brief Inline implementations for FormatPattern compilation and output
+ */
+
+#include <stdexcept>
+
+#include "Constants.h"
+
+namespace nfx::time
+{
+	//=====================================================================
+	// FormatPattern class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline constexpr FormatPattern::FormatPattern( std::string_view pattern )
+	{
+		if ( const char* error{ internal::compileFormatPattern( pattern, m_steps.data(), MAX_STEPS, m_literals.data(), MAX_LITERALS, m_stepCount, m_maxLength ) } )
+		{
+			throw std::invalid_argument{ error };
+		}
+
+		m_hasDateFields = internal::usesDateFields( m_steps.data(), m_stepCount );
+	}
+
+	//----------------------------------------------
+	// Formatting
+	//----------------------------------------------
+
+	template <typename OutputIt>
+	inline OutputIt FormatPattern::format( const DateTime& value, OutputIt out ) const
+	{
+		return internal::writeFormatSteps( m_steps.data(), m_stepCount, m_literals.data(), internal::calendarFormatFields( value.components() ), out );
+	}
+
+	template <typename OutputIt>
+	inline OutputIt FormatPattern::format( const DateTimeOffset& value, OutputIt out ) const
+	{
+		auto fields{ internal::calendarFormatFields( value.dateTime().components() ) };
+		fields.offsetMinutes = static_cast<std::int32_t>( value.offset().ticks() / constants::TICKS_PER_MINUTE );
+
+		return internal::writeFormatSteps( m_steps.data(), m_stepCount, m_literals.data(), fields, out );
+	}
+
+	template <typename OutputIt>
+	inline OutputIt FormatPattern::format( const TimeSpan& value, OutputIt out ) const
+	{
+		if ( m_hasDateFields )
+		{
+			throw std::invalid_argument{ "Format pattern uses a field a TimeSpan does not have" };
+		}
+
+		return internal::writeFormatSteps( m_steps.data(), m_stepCount, m_literals.data(), internal::spanFormatFields( value.ticks() ), out );
+	}
+
+	inline std::to_chars_result FormatPattern::format( const DateTime& value, char* first, char* last ) const noexcept
+	{
+		return write( internal::calendarFormatFields( value.components() ), first, last );
+	}
+
+	inline std::to_chars_result FormatPattern::format( const DateTimeOffset& value, char* first, char* last ) const noexcept
+	{
+		auto fields{ internal::calendarFormatFields( value.dateTime().components() ) };
+		fields.offsetMinutes = static_cast<std::int32_t>( value.offset().ticks() / constants::TICKS_PER_MINUTE );
+
+		return write( fields, first, last );
+	}
+
+	inline std::to_chars_result FormatPattern::format( const TimeSpan& value, char* first, char* last ) const noexcept
+	{
+		if ( m_hasDateFields )
+		{
+			return { first, std::errc::invalid_argument };
+		}
+
+		return write( internal::spanFormatFields( value.ticks() ), first, last );
+	}
+
+	//----------------------------------------------
+	// Property accessors
+	//----------------------------------------------
+
+	inline constexpr std::size_t FormatPattern::maxLength() const noexcept
+	{
+		return m_maxLength;
+	}
+
+	//----------------------------------------------
+	// Implementation
+	//----------------------------------------------
+
+	inline std::to_chars_result FormatPattern::write( const internal::FormatFields& fields, char* first, char* last ) const noexcept
+	{
+		// Write in place when the worst case fits, otherwise stage and copy
+		if ( static_cast<std::size_t>( last - first ) >= m_maxLength )
+		{
+			return { internal::writeFormatSteps( m_steps.data(), m_stepCount, m_literals.data(), fields, first ), std::errc{} };
+		}
+
+		char buffer[MAX_OUTPUT_LENGTH];
+		const char* end{ internal::writeFormatSteps( m_steps.data(), m_stepCount, m_literals.data(), fields, buffer + 0 ) };
+		const auto length{ end - buffer };
+		if ( length > last - first )
+		{
+			return { last, std::errc::value_too_large };
+		}
+
+		for ( std::ptrdiff_t i{ 0 }; i < length; ++i )
+		{
+			first[i] = buffer[i];
+		}
+
+		return { first + length, std::errc{} };
+	}
+} // namespace nfx::time
@@ -0,0 +1,160 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Formatter.h
+ * @brief Format spec parsing shared by the std::formatter specializations
+ * @details A spec is either empty, a name from the formatter's table ("iso", "ext", ...) or
+ *          a strftime-style pattern, recognised by containing '%'. parse() is constexpr, so
+ *          a spec in a std::format string literal is checked and compiled while the program
+ *          is built and an unknown name or malformed pattern is a compile error there;
+ *          std::vformat reports it by throwing std::format_error.
+ *
+ * @par Example:
+ * @code
+ * std::format( "{}", dt );                  // 2024-06-15T13:45:30Z
+ * std::format( "{:ext}", dt );              // 2024-06-15T13:45:30.1234567Z
+ * std::format( "{:%Y-%m-%d %H:%M}", dt );   // 2024-06-15 13:45
+ * @endcode
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <string_view>
+
+#include "Pattern.h"
+
+namespace nfx::time::internal
+{
+	//=====================================================================
+	// std::formatter support
+	//=====================================================================
+
+	/**
+	 * @brief Stack buffer size for toChars() output
+	 * @details Covers every DateTime::Format and TimeSpan duration, including offsets beyond
+	 *          ±99 hours that a DateTimeOffset may hold but never produces from valid input;
+	 *          valid values fit in constants::MAX_ISO8601_LENGTH.
+	 */
+	inline constexpr std::size_t FORMAT_BUFFER_LENGTH{ 48 };
+
+	/** @brief Format spec compiled by parseFormatSpec() */
+	struct FormatSpec
+	{
+		/** @brief Maximum number of pattern steps, as for FormatPattern */
+		static constexpr std::size_t MAX_STEPS{ 32 };
+
+		/** @brief Maximum number of pattern literal bytes, as for FormatPattern */
+		static constexpr std::size_t MAX_LITERALS{ 64 };
+
+		/** @brief Longest output of any pattern */
+		static constexpr std::size_t MAX_OUTPUT_LENGTH{ 1 + MAX_LITERALS + MAX_STEPS * MAX_SPAN_DAY_DIGITS };
+
+		/** @brief Index of the named format in the formatter's table; 0 (the default) for an empty spec */
+		std::size_t name{ 0 };
+
+		/** @brief Spec is a pattern rather than a name */
+		bool isPattern{ false };
+
+		/** @brief Compiled pattern steps */
+		std::array<FormatStep, MAX_STEPS> steps{};
+
+		/** @brief Literal bytes referenced by the pattern steps */
+		std::array<char, MAX_LITERALS> literals{};
+
+		/** @brief Number of pattern steps in use */
+		std::size_t stepCount{ 0 };
+	};
+
+	/**
+	 * @brief Parse the spec of a replacement field
+	 * @param ctx Parse context positioned after the ':'
+	 * @param names Accepted names, the default first
+	 * @param spanOnly Reject patterns using fields only calendar values have (TimeSpan)
+	 * @param spec Receives the compiled spec
+	 * @return Iterator to the closing '}'
+	 * @throws std::format_error if the spec is not a name from the table or a valid pattern
+	 */
+	template <std::size_t N>
+	constexpr std::format_parse_context::iterator parseFormatSpec(
+		std::format_parse_context& ctx, const std::array<std::string_view, N>& names, bool spanOnly, FormatSpec& spec )
+	{
+		auto it{ ctx.begin() };
+		while ( it != ctx.end() && *it != '}' )
+		{
+			++it;
+		}
+
+		const std::string_view text{ ctx.begin(), it };
+		if ( text.empty() )
+		{
+			return it;
+		}
+
+		if ( text.find( '%' ) != std::string_view::npos )
+		{
+			std::size_t maxLength{ 0 };
+			if ( const char* error{ compileFormatPattern(
+					 text, spec.steps.data(), FormatSpec::MAX_STEPS, spec.literals.data(), FormatSpec::MAX_LITERALS, spec.stepCount, maxLength ) } )
+			{
+				throw std::format_error{ error };
+			}
+			if ( spanOnly && usesDateFields( spec.steps.data(), spec.stepCount ) )
+			{
+				throw std::format_error{ "Format pattern uses a field a TimeSpan does not have" };
+			}
+			spec.isPattern = true;
+
+			return it;
+		}
+
+		for ( std::size_t i{ 0 }; i < N; ++i )
+		{
+			if ( names[i] == text )
+			{
+				spec.name = i;
+
+				return it;
+			}
+		}
+
+		throw std::format_error{ "Unknown format spec" };
+	}
+
+	/**
+	 * @brief Hand formatted bytes to the format context
+	 * @details One bulk write through the string_view formatter; storing byte by byte through
+	 *          ctx.out() pays the sink's per-byte overhead and is several times slower.
+	 * @return Output iterator after the bytes
+	 */
+	template <typename FormatContext>
+	auto writeFormatted( FormatContext& ctx, const char* first, const char* last )
+	{
+		return std::format_to( ctx.out(), "{}", std::string_view{ first, static_cast<std::size_t>( last - first ) } );
+	}
+} // namespace nfx::time::internal
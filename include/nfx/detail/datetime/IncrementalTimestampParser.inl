@@ -0,0 +1,67 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file IncrementalTimestampParser.inl
+ * @brief Inline implementations for IncrementalTimestampParser statistics accessors
+ */
+
+namespace nfx::time
+{
+	//=====================================================================
+	// IncrementalTimestampParser class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Statistics
+	//----------------------------------------------
+
+	inline std::uint64_t IncrementalTimestampParser::minuteHits() const noexcept
+	{
+		return m_minuteHits;
+	}
+
+	inline std::uint64_t IncrementalTimestampParser::dayHits() const noexcept
+	{
+		return m_dayHits;
+	}
+
+	inline std::uint64_t IncrementalTimestampParser::misses() const noexcept
+	{
+		return m_misses;
+	}
+
+	inline void IncrementalTimestampParser::resetStatistics() noexcept
+	{
+		m_minuteHits = 0;
+		m_dayHits = 0;
+		m_misses = 0;
+	}
+
+	inline void IncrementalTimestampParser::reset() noexcept
+	{
+		m_cached = false;
+		resetStatistics();
+	}
+} // namespace nfx::time
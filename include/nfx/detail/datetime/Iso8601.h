@@ -0,0 +1,733 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Iso8601.h
+ * @brief Constexpr ISO 8601 parsers shared by fromString() and the compile-time literals
+ * @details Every function here is usable in constant evaluation, so the same code validates
+ *          "..."_dt, "..."_dto and "..."_ts literals at compile time and backs the runtime
+ *          DateTime, DateTimeOffset and TimeSpan fromString() overloads. Parsers produce raw
+ *          tick counts so this header does not depend on the value types themselves.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+#include "Constants.h"
+
+namespace nfx::time::internal
+{
+	//=====================================================================
+	// Calendar arithmetic
+	//=====================================================================
+
+	/**
+	 * @brief Cumulative days before the first day of each month, indexed by [isLeapYear][month - 1]
+	 * @details Entry 12 holds the total number of days in the year.
+	 */
+	inline constexpr std::int32_t DAYS_BEFORE_MONTH[2][13]{
+		{ 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365 },
+		{ 0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335, 366 } };
+
+	/** @brief Gregorian leap year rule */
+	inline constexpr bool isLeapYear( std::int32_t year ) noexcept
+	{
+		return ( year % 4 == 0 && year % 100 != 0 ) || ( year % 400 == 0 );
+	}
+
+	/** @brief Days since January 1, 0001 (day 0) of January 1 of the given year */
+	inline constexpr std::int32_t daysBeforeYear( std::int32_t year ) noexcept
+	{
+		const std::int32_t y{ year - 1 };
+
+		return y * constants::DAYS_PER_YEAR + y / 4 - y / 100 + y / 400;
+	}
+
+	/** @brief Convert date components to a day number (days since January 1, 0001) */
+	inline constexpr std::int64_t daysFromDate( std::int32_t year, std::int32_t month, std::int32_t day ) noexcept
+	{
+		return daysBeforeYear( year ) +
+			   DAYS_BEFORE_MONTH[isLeapYear( year )][month - 1] +
+			   day - 1;
+	}
+
+	/** @brief Convert time components to ticks */
+	inline constexpr std::int64_t timeToTicks( std::int32_t hour, std::int32_t minute, std::int32_t second, std::int32_t millisecond ) noexcept
+	{
+		return ( static_cast<std::int64_t>( hour ) * constants::TICKS_PER_HOUR ) +
+			   ( static_cast<std::int64_t>( minute ) * constants::TICKS_PER_MINUTE ) +
+			   ( static_cast<std::int64_t>( second ) * constants::TICKS_PER_SECOND ) +
+			   ( static_cast<std::int64_t>( millisecond ) * constants::TICKS_PER_MILLISECOND );
+	}
+
+	/** @brief Validate date components */
+	inline constexpr bool isValidDate( std::int32_t year, std::int32_t month, std::int32_t day ) noexcept
+	{
+		if ( year < constants::MIN_YEAR || year > constants::MAX_YEAR )
+		{
+			return false;
+		}
+		if ( month < 1 || month > 12 )
+		{
+			return false;
+		}
+
+		const auto& daysBeforeMonth{ DAYS_BEFORE_MONTH[isLeapYear( year )] };
+		if ( day < 1 || day > daysBeforeMonth[month] - daysBeforeMonth[month - 1] )
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	/** @brief Validate time components */
+	inline constexpr bool isValidTime( std::int32_t hour, std::int32_t minute, std::int32_t second, std::int32_t millisecond ) noexcept
+	{
+		return hour >= 0 && hour <= constants::HOURS_PER_DAY - 1 &&
+			   minute >= 0 && minute <= constants::MINUTES_PER_HOUR - 1 &&
+			   second >= 0 && second <= constants::SECONDS_PER_MINUTE - 1 &&
+			   millisecond >= 0 && millisecond <= constants::MILLISECONDS_PER_SECOND - 1;
+	}
+
+	//=====================================================================
+	// Number parsing
+	//=====================================================================
+
+	/** @brief Check for an ASCII decimal digit */
+	inline constexpr bool isDigit( char ch ) noexcept
+	{
+		return ch >= '0' && ch <= '9';
+	}
+
+	/**
+	 * @brief Constexpr counterpart of std::from_chars for std::int32_t (base 10)
+	 * @return Pointer past the last character consumed, or nullptr if no number was
+	 *         found or the value does not fit in std::int32_t
+	 */
+	inline constexpr const char* parseInteger( const char* first, const char* last, std::int32_t& value ) noexcept
+	{
+		const bool isNegative{ first < last && *first == '-' };
+		const char* ptr{ isNegative ? first + 1 : first };
+		if ( ptr >= last || !isDigit( *ptr ) )
+		{
+			return nullptr;
+		}
+
+		std::int64_t magnitude{ 0 };
+		for ( ; ptr < last && isDigit( *ptr ); ++ptr )
+		{
+			magnitude = magnitude * 10 + ( *ptr - '0' );
+			if ( magnitude > std::int64_t{ std::numeric_limits<std::int32_t>::max() } + isNegative )
+			{
+				return nullptr;
+			}
+		}
+
+		value = static_cast<std::int32_t>( isNegative ? -magnitude : magnitude );
+
+		return ptr;
+	}
+
+	//=====================================================================
+	// ISO 8601 date and time
+	//=====================================================================
+
+	/*
+		Both date-time parsers share one forward pass over the date and time fields and only
+		look at the short remainder after it for the designator. The accepted language is
+		the one of the original parsers, which located the designator by scanning backward:
+
+		  - input shorter than 10 characters is rejected;
+		  - text after the date-time is ignored by parseDateTime(); parseDateTimeOffset()
+		    treats the last 'Z', '+' or '-' at index 10 or later as the designator;
+		  - a month/day dash beyond index 10 is only accepted when a later '+' or '-' cut
+		    the string there first.
+	*/
+
+	/** @brief Fields of the forward date-time pass */
+	struct DateTimeScan
+	{
+		/** @brief Local date-time ticks */
+		std::int64_t ticks;
+
+		/** @brief Index of the first character after the date-time */
+		std::size_t end;
+
+		/** @brief Index of the dash between month and day */
+		std::size_t secondDash;
+	};
+
+	/**
+	 * @brief Parse an optional '.' and up to 7 fraction digits (100ns precision)
+	 * @param ptr First character after the seconds
+	 * @param end End of the input
+	 * @param fractionalTicks Receives the fraction in ticks (zero when absent)
+	 * @return Pointer past the consumed characters; further digits are left unconsumed
+	 */
+	inline constexpr const char* scanFraction( const char* ptr, const char* end, std::int32_t& fractionalTicks ) noexcept
+	{
+		fractionalTicks = 0;
+		if ( ptr >= end || *ptr != '.' )
+		{
+			return ptr;
+		}
+
+		++ptr;
+		std::int32_t fractionDigits{ 0 };
+		for ( ; ptr < end && isDigit( *ptr ) && fractionDigits < 7; ++ptr, ++fractionDigits )
+		{
+			fractionalTicks = fractionalTicks * 10 + ( *ptr - '0' );
+		}
+
+		constexpr std::int32_t scales[]{ 0, 1000000, 100000, 10000, 1000, 100, 10, 1 };
+		fractionalTicks *= scales[fractionDigits];
+
+		return ptr;
+	}
+
+	/**
+	 * @brief Parse YYYY-M+-D+[TH+:M+:S+[.f{0,7}]] from the start of a string
+	 * @param text Input of at least 10 characters
+	 * @param scan Receives the ticks and where the date-time ends
+	 * @return true if the fields are present and valid; trailing text is not inspected
+	 */
+	inline constexpr bool scanDateTime( std::string_view text, DateTimeScan& scan ) noexcept
+	{
+		const char* data{ text.data() };
+		const char* end{ data + text.size() };
+
+		const auto parseField{ [end]( const char* first, std::int32_t& value ) constexpr noexcept {
+			const char* fieldEnd{ first };
+			while ( fieldEnd < end && isDigit( *fieldEnd ) )
+			{
+				++fieldEnd;
+			}
+
+			return parseInteger( first, fieldEnd, value );
+		} };
+
+		// Year (YYYY), '-', month, '-', day
+		std::int32_t year{ 0 };
+		if ( parseInteger( data, data + 4, year ) != data + 4 || data[4] != '-' )
+		{
+			return false;
+		}
+
+		std::int32_t month{ 0 };
+		const char* ptr{ parseField( data + 5, month ) };
+		if ( ptr == nullptr || ptr >= end || *ptr != '-' )
+		{
+			return false;
+		}
+		scan.secondDash = static_cast<std::size_t>( ptr - data );
+
+		std::int32_t day{ 0 };
+		ptr = parseField( ptr + 1, day );
+		if ( ptr == nullptr )
+		{
+			return false;
+		}
+
+		// Time part is optional
+		std::int32_t hour{ 0 }, minute{ 0 }, second{ 0 };
+		std::int32_t fractionalTicks{ 0 };
+
+		if ( ptr < end && *ptr == 'T' )
+		{
+			ptr = parseField( ptr + 1, hour );
+			if ( ptr == nullptr || ptr >= end || *ptr != ':' )
+			{
+				return false;
+			}
+
+			ptr = parseField( ptr + 1, minute );
+			if ( ptr == nullptr || ptr >= end || *ptr != ':' )
+			{
+				return false;
+			}
+
+			ptr = parseField( ptr + 1, second );
+			if ( ptr == nullptr )
+			{
+				return false;
+			}
+
+			ptr = scanFraction( ptr, end, fractionalTicks );
+		}
+
+		if ( !isValidDate( year, month, day ) || !isValidTime( hour, minute, second, 0 ) )
+		{
+			return false;
+		}
+
+		scan.ticks = daysFromDate( year, month, day ) * constants::TICKS_PER_DAY + timeToTicks( hour, minute, second, 0 ) + fractionalTicks;
+		scan.end = static_cast<std::size_t>( ptr - data );
+
+		return true;
+	}
+
+	/** @brief Whether text[first, last) holds a '+' or '-' at an index greater than 10 */
+	inline constexpr bool hasSignAfterDate( std::string_view text, std::size_t first, std::size_t last ) noexcept
+	{
+		for ( std::size_t i{ first > 11 ? first : 11 }; i < last; ++i )
+		{
+			if ( text[i] == '+' || text[i] == '-' )
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * @brief Parse a numeric UTC offset
+	 * @param offsetString ±HH:MM, ±H:MM, ±HHMM, ±HH or ±H
+	 * @param offsetTicks Receives the offset in ticks on success
+	 * @return true if the offset is well-formed and within ±14:00
+	 */
+	inline constexpr bool parseOffset( std::string_view offsetString, std::int64_t& offsetTicks ) noexcept
+	{
+		// Minimum: +H or -H (at least 2 chars: sign + digit)
+		if ( offsetString.length() < 2 )
+		{
+			return false;
+		}
+
+		const bool isNegative{ offsetString[0] == '-' };
+		const std::string_view numericPart{ offsetString.substr( 1 ) };
+		const char* numericEnd{ numericPart.data() + numericPart.size() };
+
+		std::int32_t hours{ 0 };
+		std::int32_t minutes{ 0 };
+
+		const auto colonPos{ numericPart.find( ':' ) };
+		if ( colonPos != std::string_view::npos )
+		{
+			// Format: +HH:MM or +H:MM
+			if ( colonPos == 0 || colonPos >= numericPart.length() - 1 )
+			{
+				return false;
+			}
+
+			const char* colon{ numericPart.data() + colonPos };
+			if ( parseInteger( numericPart.data(), colon, hours ) != colon ||
+				 parseInteger( colon + 1, numericEnd, minutes ) != numericEnd )
+			{
+				return false;
+			}
+		}
+		else if ( numericPart.length() == 4 )
+		{
+			// Format: +HHMM
+			const char* middle{ numericPart.data() + 2 };
+			if ( parseInteger( numericPart.data(), middle, hours ) != middle ||
+				 parseInteger( middle, numericEnd, minutes ) != numericEnd )
+			{
+				return false;
+			}
+		}
+		else if ( numericPart.length() == 2 || numericPart.length() == 1 )
+		{
+			// Format: +HH or +H
+			if ( parseInteger( numericPart.data(), numericEnd, hours ) != numericEnd )
+			{
+				return false;
+			}
+		}
+		else
+		{
+			return false;
+		}
+
+		// Hours must be 0-14 and minutes 0-59, with exactly ±14:00 as the maximum
+		if ( hours < 0 || hours > 14 || minutes < 0 || minutes > 59 )
+		{
+			return false;
+		}
+
+		if ( hours == 14 && minutes > 0 )
+		{
+			return false;
+		}
+
+		const std::int64_t totalMinutes{ hours * constants::MINUTES_PER_HOUR + minutes };
+		offsetTicks = ( isNegative ? -totalMinutes : totalMinutes ) * constants::TICKS_PER_MINUTE;
+
+		return true;
+	}
+
+	/**
+	 * @brief Check the text after a scanned date-time as parseDateTime() does
+	 * @param text Whole input
+	 * @param scan Result of the forward pass over text
+	 * @param ticks Receives the date-time ticks on success
+	 * @return true unless the month/day dash sits where only a cut at a sign accepted it
+	 */
+	inline constexpr bool parseDateTimeRemainder( std::string_view text, const DateTimeScan& scan, std::int64_t& ticks ) noexcept
+	{
+		if ( scan.secondDash > 10 && !hasSignAfterDate( text, scan.end, text.size() ) )
+		{
+			return false;
+		}
+
+		ticks = scan.ticks;
+
+		return true;
+	}
+
+	/**
+	 * @brief Check the text after a scanned date-time as parseDateTimeOffset() does
+	 * @param text Whole input
+	 * @param scan Result of the forward pass over text
+	 * @param ticks Receives the local date-time ticks on success
+	 * @param offsetTicks Receives the offset from UTC in ticks (zero when absent) on success
+	 * @return true if the remainder is empty, ignorable or a valid designator
+	 */
+	inline constexpr bool parseDateTimeOffsetRemainder( std::string_view text, const DateTimeScan& scan, std::int64_t& ticks, std::int64_t& offsetTicks ) noexcept
+	{
+		// The designator is the last 'Z', '+' or '-' after the date-time (and the date)
+		const std::size_t first{ scan.end > 10 ? scan.end : 10 };
+		std::size_t designator{ text.size() };
+		while ( designator > first )
+		{
+			const char ch{ text[designator - 1] };
+			if ( ch == 'Z' || ch == '+' || ch == '-' )
+			{
+				break;
+			}
+			--designator;
+		}
+
+		if ( designator == first )
+		{
+			// No designator; a month/day dash at index 10 or later would have been taken for one
+			if ( scan.secondDash >= 10 )
+			{
+				return false;
+			}
+
+			ticks = scan.ticks;
+			offsetTicks = 0;
+
+			return true;
+		}
+
+		const std::size_t offsetPos{ designator - 1 };
+
+		// Reject double signs (e.g., "+-", "-+", "++", "--")
+		const char prevChar{ text[offsetPos - 1] };
+		if ( prevChar == '+' || prevChar == '-' )
+		{
+			return false;
+		}
+
+		std::int64_t offset{ 0 };
+		if ( text[offsetPos] != 'Z' && !parseOffset( text.substr( offsetPos ), offset ) )
+		{
+			return false;
+		}
+
+		if ( scan.secondDash > 10 && !hasSignAfterDate( text, scan.end, offsetPos ) )
+		{
+			return false;
+		}
+
+		ticks = scan.ticks;
+		offsetTicks = offset;
+
+		return true;
+	}
+
+	/**
+	 * @brief Parse an ISO 8601 date or date-time into ticks
+	 * @param iso8601String YYYY-MM-DD with optional THH:mm:ss[.fffffff] and trailing Z or offset
+	 * @param ticks Receives the parsed ticks on success
+	 * @return true if parsing and validation succeeded
+	 * @details A trailing UTC designator or numeric offset is accepted and ignored.
+	 */
+	inline constexpr bool parseDateTime( std::string_view iso8601String, std::int64_t& ticks ) noexcept
+	{
+		DateTimeScan scan{};
+		if ( iso8601String.length() < 10 || !scanDateTime( iso8601String, scan ) )
+		{
+			return false;
+		}
+
+		return parseDateTimeRemainder( iso8601String, scan, ticks );
+	}
+
+	/**
+	 * @brief Parse an ISO 8601 date-time with optional UTC designator or offset into ticks
+	 * @param iso8601String Date-time optionally followed by Z, ±HH:MM, ±H:MM, ±HHMM, ±HH or ±H
+	 * @param ticks Receives the local date-time ticks on success
+	 * @param offsetTicks Receives the offset from UTC in ticks (zero when absent) on success
+	 * @return true if parsing and validation succeeded
+	 * @details Offsets are limited to ±14:00 as allowed by ISO 8601. Local time without a
+	 *          designator is valid but ambiguous per ISO 8601; its offset defaults to zero.
+	 */
+	inline constexpr bool parseDateTimeOffset( std::string_view iso8601String, std::int64_t& ticks, std::int64_t& offsetTicks ) noexcept
+	{
+		DateTimeScan scan{};
+		if ( iso8601String.length() < 10 || !scanDateTime( iso8601String, scan ) )
+		{
+			return false;
+		}
+
+		return parseDateTimeOffsetRemainder( iso8601String, scan, ticks, offsetTicks );
+	}
+
+	//=====================================================================
+	// ISO 8601 durations
+	//=====================================================================
+
+	/** @brief Decimal component of a duration, kept as integers */
+	struct DurationNumber
+	{
+		/** @brief Digits before the decimal point */
+		std::uint64_t whole;
+
+		/** @brief Leading digits after the decimal point */
+		std::uint64_t fraction;
+
+		/** @brief Number of digits in fraction (at most 16; later digits are dropped) */
+		std::int32_t fractionDigits;
+	};
+
+	/**
+	 * @brief Parse an unsigned decimal number (digits, optional '.' and fraction digits)
+	 * @return Pointer past the last character consumed, or nullptr if no digit was found or
+	 *         the integer part exceeds any representable duration
+	 */
+	inline constexpr const char* parseDurationNumber( const char* first, const char* last, DurationNumber& number ) noexcept
+	{
+		number = DurationNumber{ 0, 0, 0 };
+		bool anyDigits{ false };
+
+		const char* ptr{ first };
+		for ( ; ptr < last && isDigit( *ptr ); ++ptr )
+		{
+			anyDigits = true;
+			number.whole = number.whole * 10 + static_cast<std::uint64_t>( *ptr - '0' );
+			if ( number.whole > 100000000000000000ULL )
+			{
+				return nullptr;
+			}
+		}
+
+		if ( ptr < last && *ptr == '.' )
+		{
+			for ( ++ptr; ptr < last && isDigit( *ptr ); ++ptr )
+			{
+				anyDigits = true;
+				if ( number.fractionDigits < 16 )
+				{
+					number.fraction = number.fraction * 10 + static_cast<std::uint64_t>( *ptr - '0' );
+					++number.fractionDigits;
+				}
+			}
+		}
+
+		return anyDigits ? ptr : nullptr;
+	}
+
+	/**
+	 * @brief Add a decimal component times a unit to a tick magnitude
+	 * @param number Component value
+	 * @param unitMantissa Unit length in ticks divided by 10^unitExponent
+	 * @param unitExponent Power of ten of the unit length (at most 16)
+	 * @param magnitude Running total, updated on success
+	 * @param limit Largest total allowed
+	 * @return false if the total would exceed limit
+	 * @details The fractional part is truncated to whole ticks. Every unit is a small
+	 *          mantissa times a power of ten, so the product never needs more than 64 bits.
+	 */
+	inline constexpr bool addDurationComponent( const DurationNumber& number, std::uint64_t unitMantissa, std::int32_t unitExponent, std::uint64_t& magnitude, std::uint64_t limit ) noexcept
+	{
+		constexpr std::uint64_t powersOf10[]{
+			1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+			1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+			100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL };
+
+		const std::uint64_t unitTicks{ unitMantissa * powersOf10[unitExponent] };
+		const std::uint64_t fractionTicks{ number.fractionDigits <= unitExponent
+											   ? number.fraction * unitMantissa * powersOf10[unitExponent - number.fractionDigits]
+											   : number.fraction * unitMantissa / powersOf10[number.fractionDigits - unitExponent] };
+
+		const std::uint64_t available{ limit - magnitude };
+		if ( number.whole > available / unitTicks )
+		{
+			return false;
+		}
+
+		const std::uint64_t componentTicks{ number.whole * unitTicks };
+		if ( fractionTicks > available - componentTicks )
+		{
+			return false;
+		}
+
+		magnitude += componentTicks + fractionTicks;
+
+		return true;
+	}
+
+	/**
+	 * @brief Parse an ISO 8601 duration (or plain numeric seconds) into ticks
+	 * @param iso8601DurationString [-]P[nD][T[nH][nM][nS]] or [-]n decimal seconds
+	 * @param ticks Receives the parsed ticks on success
+	 * @return true if parsing and validation succeeded
+	 * @details Single forward pass over the string with integer arithmetic only, so results
+	 *          are exact to the tick: fractional components are truncated toward zero and a
+	 *          total outside the TimeSpan range is rejected. Any component may be fractional
+	 *          (e.g. P1.5D, PT0.0000001S). Time components must appear at most once and in
+	 *          H, M, S order, and nothing may follow the last component.
+	 */
+	inline constexpr bool parseTimeSpan( std::string_view iso8601DurationString, std::int64_t& ticks ) noexcept
+	{
+		const char* ptr{ iso8601DurationString.data() };
+		const char* end{ ptr + iso8601DurationString.size() };
+
+		const bool isNegative{ ptr < end && *ptr == '-' };
+		if ( isNegative )
+		{
+			++ptr;
+		}
+
+		// The magnitude of std::numeric_limits<std::int64_t>::min() is one more than max()
+		const std::uint64_t limit{ static_cast<std::uint64_t>( std::numeric_limits<std::int64_t>::max() ) + ( isNegative ? 1 : 0 ) };
+		std::uint64_t magnitude{ 0 };
+		DurationNumber number{};
+
+		if ( ptr < end && *ptr == 'P' )
+		{
+			// Position in [nD][T[nH][nM][nS]]: the last part read so far
+			enum class Part : std::uint8_t
+			{
+				Start,
+				Days,
+				Time,
+				Hours,
+				Minutes,
+				Seconds
+			};
+
+			Part part{ Part::Start };
+			for ( ++ptr; ptr < end; ++ptr )
+			{
+				if ( *ptr == 'T' )
+				{
+					if ( part != Part::Start && part != Part::Days )
+					{
+						return false;
+					}
+					part = Part::Time;
+
+					continue;
+				}
+
+				ptr = parseDurationNumber( ptr, end, number );
+				if ( ptr == nullptr || ptr == end )
+				{
+					return false;
+				}
+
+				// Unit of the designator as mantissa * 10^exponent ticks
+				bool inOrder{ false };
+				std::uint64_t unitMantissa{ 0 };
+				std::int32_t unitExponent{ 0 };
+				switch ( *ptr )
+				{
+					case 'D':
+					{
+						inOrder = part == Part::Start;
+						part = Part::Days;
+						unitMantissa = 864;
+						unitExponent = 9;
+
+						break;
+					}
+					case 'H':
+					{
+						inOrder = part == Part::Time;
+						part = Part::Hours;
+						unitMantissa = 36;
+						unitExponent = 9;
+
+						break;
+					}
+					case 'M':
+					{
+						inOrder = part == Part::Time || part == Part::Hours;
+						part = Part::Minutes;
+						unitMantissa = 6;
+						unitExponent = 8;
+
+						break;
+					}
+					case 'S':
+					{
+						inOrder = part == Part::Time || part == Part::Hours || part == Part::Minutes;
+						part = Part::Seconds;
+						unitMantissa = 1;
+						unitExponent = 7;
+
+						break;
+					}
+					default:
+					{
+						break;
+					}
+				}
+
+				if ( !inOrder || !addDurationComponent( number, unitMantissa, unitExponent, magnitude, limit ) )
+				{
+					return false;
+				}
+			}
+
+			// "P" has no component and "PT" or "P1DT" none after the 'T'
+			if ( part == Part::Start || part == Part::Time )
+			{
+				return false;
+			}
+		}
+		else
+		{
+			// Plain decimal seconds (convenience form)
+			ptr = parseDurationNumber( ptr, end, number );
+			if ( ptr != end || !addDurationComponent( number, 1, 7, magnitude, limit ) )
+			{
+				return false;
+			}
+		}
+
+		ticks = isNegative && magnitude != 0 ? -static_cast<std::int64_t>( magnitude - 1 ) - 1 : static_cast<std::int64_t>( magnitude );
+
+		return true;
+	}
+} // namespace nfx::time::internal
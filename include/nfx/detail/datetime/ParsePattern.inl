@@ -0,0 +1,68 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ParsePattern.inl
+ * @brief Inline implementations for ParsePattern convenience overloads and accessors
+ */
+
+namespace nfx::time
+{
+	//=====================================================================
+	// ParsePattern class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Parsing
+	//----------------------------------------------
+
+	inline std::optional<DateTime> ParsePattern::parseDateTime( std::string_view text ) const noexcept
+	{
+		DateTime result;
+		if ( parse( text, result ) )
+		{
+			return result;
+		}
+		return std::nullopt;
+	}
+
+	inline std::optional<DateTimeOffset> ParsePattern::parseDateTimeOffset( std::string_view text ) const noexcept
+	{
+		DateTimeOffset result;
+		if ( parse( text, result ) )
+		{
+			return result;
+		}
+		return std::nullopt;
+	}
+
+	//----------------------------------------------
+	// Property accessors
+	//----------------------------------------------
+
+	inline std::string_view ParsePattern::pattern() const noexcept
+	{
+		return m_pattern;
+	}
+} // namespace nfx::time
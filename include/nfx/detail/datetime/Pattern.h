@@ -0,0 +1,1180 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Pattern.h
+ * @brief Constexpr strftime-style pattern compilers and the parse and format steps they produce
+ * @details A pattern such as "%d/%b/%Y:%H:%M:%S %z" is compiled into a flat array of steps:
+ *          fixed-width numeric fields, month names, fractions, offsets and runs of literal
+ *          bytes. The compiler is constexpr, so DateTime::parse<"...">() compiles the
+ *          pattern while the program is built and unrolls the steps into straight-line
+ *          code; a malformed pattern is a compile error there. ParsePattern runs the same
+ *          compiler on a pattern known only at run time and interprets the steps.
+ *
+ * @par Parse specifiers:
+ * | Specifier | Input                                   |
+ * |-----------|-----------------------------------------|
+ * | %Y        | Year, 4 digits                          |
+ * | %m        | Month, 2 digits                         |
+ * | %b        | Month name, 3 letters, any case (Jan)   |
+ * | %d        | Day of month, 2 digits                  |
+ * | %j        | Day of year, 3 digits                   |
+ * | %H        | Hour (00-23), 2 digits                  |
+ * | %M        | Minute, 2 digits                        |
+ * | %S        | Second, 2 digits                        |
+ * | %f        | Fraction of a second, 1-9 digits        |
+ * | %z        | Z, ±HH, ±HHMM or ±HH:MM (within ±14:00) |
+ * | %F        | Same as %Y-%m-%d                        |
+ * | %T        | Same as %H:%M:%S                        |
+ * | %%        | A literal '%'                           |
+ *
+ * Every other pattern byte must appear verbatim in the input. Fraction digits beyond
+ * the seventh are below tick precision and are dropped.
+ *
+ * @par Format specifiers:
+ * | Specifier | Output                                           |
+ * |-----------|--------------------------------------------------|
+ * | %Y        | Year, 4 digits                                   |
+ * | %m        | Month, 2 digits                                  |
+ * | %b        | Month name, 3 letters (Jan)                      |
+ * | %d        | Day of month, 2 digits; whole days of a TimeSpan |
+ * | %j        | Day of year, 3 digits                            |
+ * | %a        | Weekday name, 3 letters (Mon)                    |
+ * | %H        | Hour (00-23), 2 digits                           |
+ * | %M        | Minute, 2 digits                                 |
+ * | %S        | Second, 2 digits                                 |
+ * | %f        | Fraction of a second, 7 digits                   |
+ * | %z        | Offset, ±HH:MM                                   |
+ * | %F %T %%  | As for parsing                                   |
+ *
+ * Format patterns have no required fields, and FormatPattern writes every step with
+ * digit-pair table lookups instead of locale or stream machinery.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include "Constants.h"
+#include "Iso8601.h"
+
+namespace nfx::time::internal
+{
+	//=====================================================================
+	// Pattern literal
+	//=====================================================================
+
+	/**
+	 * @brief String literal usable as a template argument, e.g. parse<"%Y-%m-%d">()
+	 * @tparam N Size of the literal including its terminating null
+	 */
+	template <std::size_t N>
+	struct PatternLiteral
+	{
+		/** @brief Copy the literal */
+		consteval PatternLiteral( const char ( &text )[N] ) noexcept
+		{
+			for ( std::size_t i{ 0 }; i < N; ++i )
+			{
+				value[i] = text[i];
+			}
+		}
+
+		/** @brief Pattern text without the terminating null */
+		constexpr std::string_view view() const noexcept
+		{
+			return { value, N - 1 };
+		}
+
+		/** @brief Pattern bytes */
+		char value[N]{};
+	};
+
+	//=====================================================================
+	// Parse steps
+	//=====================================================================
+
+	/** @brief What a parse step consumes */
+	enum class ParseField : std::uint8_t
+	{
+		Literal,
+		Year,
+		Month,
+		MonthName,
+		Day,
+		DayOfYear,
+		Hour,
+		Minute,
+		Second,
+		Fraction,
+		Offset
+	};
+
+	/** @brief One instruction of a compiled parse pattern */
+	struct ParseStep
+	{
+		/** @brief Field consumed */
+		ParseField field;
+
+		/** @brief Digit count of numeric fields, byte count of literal runs */
+		std::uint16_t width;
+
+		/** @brief First byte of a literal run in the literal buffer */
+		std::uint16_t literalOffset;
+	};
+
+	/** @brief Step and literal buffer sizes of a compiled pattern */
+	struct ParsePatternSize
+	{
+		/** @brief Number of steps */
+		std::size_t steps;
+
+		/** @brief Number of literal bytes */
+		std::size_t literals;
+	};
+
+	/** @brief Field values collected while running the steps */
+	struct ParsedFields
+	{
+		std::int32_t year{ 1 };
+		std::int32_t month{ 1 };
+		std::int32_t day{ 1 };
+		std::int32_t dayOfYear{ -1 };
+		std::int32_t hour{ 0 };
+		std::int32_t minute{ 0 };
+		std::int32_t second{ 0 };
+		std::int32_t fractionTicks{ 0 };
+		std::int32_t offsetMinutes{ 0 };
+	};
+
+	//----------------------------------------------
+	// Compiler
+	//----------------------------------------------
+
+	/**
+	 * @brief Compile a strftime-style parse pattern
+	 * @param pattern Pattern text
+	 * @param steps Receives the steps, or nullptr to only measure
+	 * @param literals Receives the literal bytes, or nullptr to only measure
+	 * @param size Receives the number of steps and literal bytes
+	 * @return nullptr on success, otherwise a description of the error
+	 * @details Besides unknown specifiers, a pattern is rejected when a field appears twice,
+	 *          when it lacks %Y or a month and day (%m or %b with %d, or %j), or when %f is
+	 *          directly followed by another numeric field, which it could not be told apart from.
+	 */
+	inline constexpr const char* compileParsePattern( std::string_view pattern, ParseStep* steps, char* literals, ParsePatternSize& size ) noexcept
+	{
+		size = ParsePatternSize{ 0, 0 };
+		std::uint32_t seen{ 0 };
+		bool afterFraction{ false };
+		bool afterLiteral{ false };
+
+		const auto addField{ [&]( ParseField field, std::uint16_t width ) constexpr noexcept -> const char* {
+			const std::uint32_t bit{ 1u << static_cast<std::uint32_t>( field ) };
+			if ( seen & bit )
+			{
+				return "Parse pattern repeats a field";
+			}
+			if ( afterFraction && field != ParseField::Offset && field != ParseField::MonthName )
+			{
+				return "Parse pattern has a numeric field right after %f";
+			}
+			seen |= bit;
+			afterFraction = field == ParseField::Fraction;
+			afterLiteral = false;
+
+			if ( steps != nullptr )
+			{
+				steps[size.steps] = ParseStep{ field, width, 0 };
+			}
+			++size.steps;
+
+			return nullptr;
+		} };
+
+		const auto addLiteral{ [&]( char ch ) constexpr noexcept -> const char* {
+			if ( size.literals >= 0xFFFF )
+			{
+				return "Parse pattern is too long";
+			}
+
+			// Extend the current run or start a new one
+			if ( steps != nullptr )
+			{
+				literals[size.literals] = ch;
+				if ( afterLiteral )
+				{
+					++steps[size.steps - 1].width;
+				}
+				else
+				{
+					steps[size.steps] = ParseStep{ ParseField::Literal, 1, static_cast<std::uint16_t>( size.literals ) };
+				}
+			}
+			if ( !afterLiteral )
+			{
+				++size.steps;
+			}
+			++size.literals;
+			afterFraction = false;
+			afterLiteral = true;
+
+			return nullptr;
+		} };
+
+		for ( std::size_t i{ 0 }; i < pattern.size(); ++i )
+		{
+			const char* error{ nullptr };
+			if ( pattern[i] != '%' )
+			{
+				error = addLiteral( pattern[i] );
+			}
+			else if ( ++i == pattern.size() )
+			{
+				return "Parse pattern ends with a lone '%'";
+			}
+			else
+			{
+				switch ( pattern[i] )
+				{
+					case 'Y':
+					{
+						error = addField( ParseField::Year, 4 );
+
+						break;
+					}
+					case 'm':
+					{
+						error = addField( ParseField::Month, 2 );
+
+						break;
+					}
+					case 'b':
+					{
+						error = addField( ParseField::MonthName, 3 );
+
+						break;
+					}
+					case 'd':
+					{
+						error = addField( ParseField::Day, 2 );
+
+						break;
+					}
+					case 'j':
+					{
+						error = addField( ParseField::DayOfYear, 3 );
+
+						break;
+					}
+					case 'H':
+					{
+						error = addField( ParseField::Hour, 2 );
+
+						break;
+					}
+					case 'M':
+					{
+						error = addField( ParseField::Minute, 2 );
+
+						break;
+					}
+					case 'S':
+					{
+						error = addField( ParseField::Second, 2 );
+
+						break;
+					}
+					case 'f':
+					{
+						error = addField( ParseField::Fraction, 9 );
+
+						break;
+					}
+					case 'z':
+					{
+						error = addField( ParseField::Offset, 6 );
+
+						break;
+					}
+					case 'F':
+					{
+						error = addField( ParseField::Year, 4 );
+						error = error ? error : addLiteral( '-' );
+						error = error ? error : addField( ParseField::Month, 2 );
+						error = error ? error : addLiteral( '-' );
+						error = error ? error : addField( ParseField::Day, 2 );
+
+						break;
+					}
+					case 'T':
+					{
+						error = addField( ParseField::Hour, 2 );
+						error = error ? error : addLiteral( ':' );
+						error = error ? error : addField( ParseField::Minute, 2 );
+						error = error ? error : addLiteral( ':' );
+						error = error ? error : addField( ParseField::Second, 2 );
+
+						break;
+					}
+					case '%':
+					{
+						error = addLiteral( '%' );
+
+						break;
+					}
+					default:
+					{
+						return "Parse pattern has an unknown specifier";
+					}
+				}
+			}
+
+			if ( error != nullptr )
+			{
+				return error;
+			}
+		}
+
+		const auto has{ [seen]( ParseField field ) constexpr noexcept {
+			return ( seen & ( 1u << static_cast<std::uint32_t>( field ) ) ) != 0;
+		} };
+
+		if ( !has( ParseField::Year ) )
+		{
+			return "Parse pattern has no %Y";
+		}
+
+		const bool hasMonth{ has( ParseField::Month ) || has( ParseField::MonthName ) };
+		if ( has( ParseField::Month ) && has( ParseField::MonthName ) )
+		{
+			return "Parse pattern repeats a field";
+		}
+		if ( has( ParseField::DayOfYear ) ? hasMonth || has( ParseField::Day ) : !hasMonth || !has( ParseField::Day ) )
+		{
+			return "Parse pattern needs %m or %b with %d, or %j alone";
+		}
+
+		return nullptr;
+	}
+
+	//----------------------------------------------
+	// Execution
+	//----------------------------------------------
+
+	/** @brief Read exactly Width digits */
+	template <std::int32_t Width>
+	constexpr bool parseFixedDigits( const char*& ptr, const char* end, std::int32_t& value ) noexcept
+	{
+		if ( end - ptr < Width )
+		{
+			return false;
+		}
+
+		value = 0;
+		for ( std::int32_t i{ 0 }; i < Width; ++i )
+		{
+			if ( !isDigit( ptr[i] ) )
+			{
+				return false;
+			}
+			value = value * 10 + ( ptr[i] - '0' );
+		}
+		ptr += Width;
+
+		return true;
+	}
+
+	/** @brief Read a three-letter English month abbreviation in any case */
+	inline constexpr bool parseMonthName( const char*& ptr, const char* end, std::int32_t& month ) noexcept
+	{
+		constexpr std::string_view names{ "janfebmaraprmayjunjulaugsepoctnovdec" };
+		if ( end - ptr < 3 )
+		{
+			return false;
+		}
+
+		const char first{ static_cast<char>( ptr[0] | 0x20 ) };
+		const char second{ static_cast<char>( ptr[1] | 0x20 ) };
+		const char third{ static_cast<char>( ptr[2] | 0x20 ) };
+		for ( std::int32_t i{ 0 }; i < 12; ++i )
+		{
+			if ( names[i * 3] == first && names[i * 3 + 1] == second && names[i * 3 + 2] == third )
+			{
+				month = i + 1;
+				ptr += 3;
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/** @brief Read 1-9 fraction digits, keeping the first seven as ticks */
+	inline constexpr bool parseFractionDigits( const char*& ptr, const char* end, std::int32_t& fractionTicks ) noexcept
+	{
+		constexpr std::int32_t scales[]{ 0, 1000000, 100000, 10000, 1000, 100, 10, 1 };
+
+		std::int32_t digits{ 0 };
+		fractionTicks = 0;
+		for ( ; ptr < end && digits < 9 && isDigit( *ptr ); ++ptr, ++digits )
+		{
+			if ( digits < 7 )
+			{
+				fractionTicks = fractionTicks * 10 + ( *ptr - '0' );
+			}
+		}
+		if ( digits == 0 )
+		{
+			return false;
+		}
+		fractionTicks *= scales[digits < 7 ? digits : 7];
+
+		return true;
+	}
+
+	/** @brief Read Z, ±HH, ±HHMM or ±HH:MM within ±14:00 */
+	inline constexpr bool parseOffsetField( const char*& ptr, const char* end, std::int32_t& offsetMinutes ) noexcept
+	{
+		if ( ptr < end && *ptr == 'Z' )
+		{
+			offsetMinutes = 0;
+			++ptr;
+
+			return true;
+		}
+
+		if ( ptr == end || ( *ptr != '+' && *ptr != '-' ) )
+		{
+			return false;
+		}
+		const bool isNegative{ *ptr++ == '-' };
+
+		std::int32_t hours{ 0 };
+		std::int32_t minutes{ 0 };
+		if ( !parseFixedDigits<2>( ptr, end, hours ) )
+		{
+			return false;
+		}
+		if ( ptr < end && *ptr == ':' )
+		{
+			++ptr;
+			if ( !parseFixedDigits<2>( ptr, end, minutes ) )
+			{
+				return false;
+			}
+		}
+		else if ( ptr < end && isDigit( *ptr ) && !parseFixedDigits<2>( ptr, end, minutes ) )
+		{
+			return false;
+		}
+
+		if ( hours > 14 || minutes > 59 || ( hours == 14 && minutes > 0 ) )
+		{
+			return false;
+		}
+
+		const std::int32_t totalMinutes{ hours * constants::MINUTES_PER_HOUR + minutes };
+		offsetMinutes = isNegative ? -totalMinutes : totalMinutes;
+
+		return true;
+	}
+
+	/**
+	 * @brief Validate collected fields and convert them to ticks
+	 * @param fields Values read by the steps; a day of year replaces month and day
+	 * @param ticks Receives the local date-time ticks on success
+	 * @return true if the date and time are valid
+	 */
+	inline constexpr bool resolveParsedFields( ParsedFields& fields, std::int64_t& ticks ) noexcept
+	{
+		if ( fields.dayOfYear >= 0 )
+		{
+			if ( fields.year < 1 || fields.year > 9999 )
+			{
+				return false;
+			}
+
+			const auto& daysBeforeMonth{ DAYS_BEFORE_MONTH[isLeapYear( fields.year )] };
+			if ( fields.dayOfYear < 1 || fields.dayOfYear > daysBeforeMonth[12] )
+			{
+				return false;
+			}
+
+			fields.month = 1;
+			while ( fields.dayOfYear > daysBeforeMonth[fields.month] )
+			{
+				++fields.month;
+			}
+			fields.day = fields.dayOfYear - daysBeforeMonth[fields.month - 1];
+		}
+
+		if ( !isValidDate( fields.year, fields.month, fields.day ) || !isValidTime( fields.hour, fields.minute, fields.second, 0 ) )
+		{
+			return false;
+		}
+
+		ticks = daysFromDate( fields.year, fields.month, fields.day ) * constants::TICKS_PER_DAY +
+				timeToTicks( fields.hour, fields.minute, fields.second, 0 ) + fields.fractionTicks;
+
+		return true;
+	}
+
+	//=====================================================================
+	// Compile-time parse patterns
+	//=====================================================================
+
+	/** @brief Steps and literal bytes of a pattern compiled at compile time */
+	template <std::size_t StepCount, std::size_t LiteralCount>
+	struct ParseProgram
+	{
+		std::array<ParseStep, StepCount> steps{};
+		std::array<char, LiteralCount> literals{};
+	};
+
+	/** @brief Compile a pattern literal, failing compilation with the error if it is malformed */
+	template <PatternLiteral Pattern>
+	consteval auto compileParseProgram()
+	{
+		constexpr ParsePatternSize size{ [] {
+			ParsePatternSize measured{};
+			if ( const char* error{ compileParsePattern( Pattern.view(), nullptr, nullptr, measured ) } )
+			{
+				throw std::invalid_argument{ error };
+			}
+
+			return measured;
+		}() };
+
+		ParseProgram<size.steps, size.literals> program{};
+		ParsePatternSize filled{};
+		compileParsePattern( Pattern.view(), program.steps.data(), program.literals.data(), filled );
+
+		return program;
+	}
+
+	/** @brief Compiled form of a pattern literal */
+	template <PatternLiteral Pattern>
+	inline constexpr auto PARSE_PROGRAM{ compileParseProgram<Pattern>() };
+
+	/**
+	 * @brief Run one step of a compiled pattern against the input
+	 * @tparam Pattern Pattern literal
+	 * @tparam Index Position of the step, so that its field, width and literal bytes are constants
+	 * @param ptr Current input position, advanced on success
+	 * @param end End of the input
+	 * @param fields Receives the field value
+	 * @return true if the input matched
+	 */
+	template <PatternLiteral Pattern, std::size_t Index>
+	constexpr bool runCompiledStep( const char*& ptr, const char* end, ParsedFields& fields ) noexcept
+	{
+		constexpr ParseStep step{ PARSE_PROGRAM<Pattern>.steps[Index] };
+
+		if constexpr ( step.field == ParseField::Literal )
+		{
+			if ( end - ptr < step.width )
+			{
+				return false;
+			}
+			for ( std::size_t i{ 0 }; i < step.width; ++i )
+			{
+				if ( ptr[i] != PARSE_PROGRAM<Pattern>.literals[step.literalOffset + i] )
+				{
+					return false;
+				}
+			}
+			ptr += step.width;
+
+			return true;
+		}
+		else if constexpr ( step.field == ParseField::Year )
+		{
+			return parseFixedDigits<4>( ptr, end, fields.year );
+		}
+		else if constexpr ( step.field == ParseField::Month )
+		{
+			return parseFixedDigits<2>( ptr, end, fields.month );
+		}
+		else if constexpr ( step.field == ParseField::MonthName )
+		{
+			return parseMonthName( ptr, end, fields.month );
+		}
+		else if constexpr ( step.field == ParseField::Day )
+		{
+			return parseFixedDigits<2>( ptr, end, fields.day );
+		}
+		else if constexpr ( step.field == ParseField::DayOfYear )
+		{
+			return parseFixedDigits<3>( ptr, end, fields.dayOfYear );
+		}
+		else if constexpr ( step.field == ParseField::Hour )
+		{
+			return parseFixedDigits<2>( ptr, end, fields.hour );
+		}
+		else if constexpr ( step.field == ParseField::Minute )
+		{
+			return parseFixedDigits<2>( ptr, end, fields.minute );
+		}
+		else if constexpr ( step.field == ParseField::Second )
+		{
+			return parseFixedDigits<2>( ptr, end, fields.second );
+		}
+		else if constexpr ( step.field == ParseField::Fraction )
+		{
+			return parseFractionDigits( ptr, end, fields.fractionTicks );
+		}
+		else
+		{
+			return parseOffsetField( ptr, end, fields.offsetMinutes );
+		}
+	}
+
+	/**
+	 * @brief Parse text with a pattern compiled at compile time
+	 * @param text Input, which the pattern must match entirely
+	 * @param ticks Receives the local date-time ticks on success
+	 * @param offsetMinutes Receives the %z offset in minutes (zero without %z) on success
+	 * @return true if the input matched and holds a valid date and time
+	 * @details The steps are expanded into one straight-line sequence, so every width and
+	 *          literal is a constant in the generated code.
+	 */
+	template <PatternLiteral Pattern>
+	constexpr bool parseWithPattern( std::string_view text, std::int64_t& ticks, std::int32_t& offsetMinutes ) noexcept
+	{
+		const char* ptr{ text.data() };
+		const char* end{ ptr + text.size() };
+		ParsedFields fields{};
+
+		const bool matched{ [&]<std::size_t... I>( std::index_sequence<I...> ) constexpr noexcept {
+			return ( runCompiledStep<Pattern, I>( ptr, end, fields ) && ... );
+		}( std::make_index_sequence<PARSE_PROGRAM<Pattern>.steps.size()>{} ) };
+
+		if ( !matched || ptr != end || !resolveParsedFields( fields, ticks ) )
+		{
+			return false;
+		}
+		offsetMinutes = fields.offsetMinutes;
+
+		return true;
+	}
+
+	//=====================================================================
+	// Format steps
+	//=====================================================================
+
+	/** @brief What a format step writes */
+	enum class FormatField : std::uint8_t
+	{
+		Literal,
+		Year,
+		Month,
+		MonthName,
+		Day,
+		DayOfYear,
+		WeekdayName,
+		Hour,
+		Minute,
+		Second,
+		Fraction,
+		Offset
+	};
+
+	/** @brief One instruction of a compiled format pattern */
+	struct FormatStep
+	{
+		/** @brief Field written */
+		FormatField field;
+
+		/** @brief Byte count of literal runs */
+		std::uint8_t width;
+
+		/** @brief First byte of a literal run in the literal buffer */
+		std::uint16_t literalOffset;
+	};
+
+	/** @brief Widest output of %d for a TimeSpan: 10675199 days */
+	inline constexpr std::size_t MAX_SPAN_DAY_DIGITS{ 8 };
+
+	/** @brief Bytes written for each field; %d is counted at its TimeSpan width */
+	inline constexpr std::uint8_t FORMAT_FIELD_WIDTHS[]{ 0, 4, 2, 3, MAX_SPAN_DAY_DIGITS, 3, 3, 2, 2, 2, 7, 6 };
+
+	//----------------------------------------------
+	// Compiler
+	//----------------------------------------------
+
+	/**
+	 * @brief Compile a strftime-style format pattern into caller-provided buffers
+	 * @param pattern Pattern text
+	 * @param steps Receives the steps; must hold maxSteps entries
+	 * @param maxSteps Capacity of steps
+	 * @param literals Receives the literal bytes; must hold maxLiterals bytes
+	 * @param maxLiterals Capacity of literals
+	 * @param stepCount Receives the number of steps
+	 * @param maxLength Receives an upper bound of the output length, including a TimeSpan sign
+	 * @return nullptr on success, otherwise a description of the error
+	 */
+	inline constexpr const char* compileFormatPattern( std::string_view pattern, FormatStep* steps, std::size_t maxSteps, char* literals, std::size_t maxLiterals,
+		std::size_t& stepCount, std::size_t& maxLength ) noexcept
+	{
+		stepCount = 0;
+		maxLength = 1;
+		std::size_t literalCount{ 0 };
+		bool afterLiteral{ false };
+
+		const auto addField{ [&]( FormatField field ) constexpr noexcept -> const char* {
+			if ( stepCount == maxSteps )
+			{
+				return "Format pattern has too many fields";
+			}
+			steps[stepCount++] = FormatStep{ field, 0, 0 };
+			maxLength += FORMAT_FIELD_WIDTHS[static_cast<std::size_t>( field )];
+			afterLiteral = false;
+
+			return nullptr;
+		} };
+
+		const auto addLiteral{ [&]( char ch ) constexpr noexcept -> const char* {
+			if ( literalCount == maxLiterals )
+			{
+				return "Format pattern has too many literal bytes";
+			}
+
+			// Extend the current run or start a new one
+			if ( afterLiteral && steps[stepCount - 1].width < 0xFF )
+			{
+				++steps[stepCount - 1].width;
+			}
+			else if ( stepCount == maxSteps )
+			{
+				return "Format pattern has too many fields";
+			}
+			else
+			{
+				steps[stepCount++] = FormatStep{ FormatField::Literal, 1, static_cast<std::uint16_t>( literalCount ) };
+			}
+			literals[literalCount++] = ch;
+			++maxLength;
+			afterLiteral = true;
+
+			return nullptr;
+		} };
+
+		for ( std::size_t i{ 0 }; i < pattern.size(); ++i )
+		{
+			const char* error{ nullptr };
+			if ( pattern[i] != '%' )
+			{
+				error = addLiteral( pattern[i] );
+			}
+			else if ( ++i == pattern.size() )
+			{
+				return "Format pattern ends with a lone '%'";
+			}
+			else
+			{
+				switch ( pattern[i] )
+				{
+					case 'Y':
+					{
+						error = addField( FormatField::Year );
+
+						break;
+					}
+					case 'm':
+					{
+						error = addField( FormatField::Month );
+
+						break;
+					}
+					case 'b':
+					{
+						error = addField( FormatField::MonthName );
+
+						break;
+					}
+					case 'd':
+					{
+						error = addField( FormatField::Day );
+
+						break;
+					}
+					case 'j':
+					{
+						error = addField( FormatField::DayOfYear );
+
+						break;
+					}
+					case 'a':
+					{
+						error = addField( FormatField::WeekdayName );
+
+						break;
+					}
+					case 'H':
+					{
+						error = addField( FormatField::Hour );
+
+						break;
+					}
+					case 'M':
+					{
+						error = addField( FormatField::Minute );
+
+						break;
+					}
+					case 'S':
+					{
+						error = addField( FormatField::Second );
+
+						break;
+					}
+					case 'f':
+					{
+						error = addField( FormatField::Fraction );
+
+						break;
+					}
+					case 'z':
+					{
+						error = addField( FormatField::Offset );
+
+						break;
+					}
+					case 'F':
+					{
+						error = addField( FormatField::Year );
+						error = error ? error : addLiteral( '-' );
+						error = error ? error : addField( FormatField::Month );
+						error = error ? error : addLiteral( '-' );
+						error = error ? error : addField( FormatField::Day );
+
+						break;
+					}
+					case 'T':
+					{
+						error = addField( FormatField::Hour );
+						error = error ? error : addLiteral( ':' );
+						error = error ? error : addField( FormatField::Minute );
+						error = error ? error : addLiteral( ':' );
+						error = error ? error : addField( FormatField::Second );
+
+						break;
+					}
+					case '%':
+					{
+						error = addLiteral( '%' );
+
+						break;
+					}
+					default:
+					{
+						return "Format pattern has an unknown specifier";
+					}
+				}
+			}
+
+			if ( error != nullptr )
+			{
+				return error;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * @brief Check whether compiled format steps use a field only calendar values have
+	 * @return true if a step writes %Y, %m, %b, %j, %a or %z
+	 */
+	inline constexpr bool usesDateFields( const FormatStep* steps, std::size_t stepCount ) noexcept
+	{
+		for ( std::size_t i{ 0 }; i < stepCount; ++i )
+		{
+			switch ( steps[i].field )
+			{
+				case FormatField::Year:
+				case FormatField::Month:
+				case FormatField::MonthName:
+				case FormatField::DayOfYear:
+				case FormatField::WeekdayName:
+				case FormatField::Offset:
+				{
+					return true;
+				}
+				default:
+				{
+					break;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	//----------------------------------------------
+	// Execution
+	//----------------------------------------------
+
+	/** @brief "00" to "99", two bytes per value */
+	inline constexpr char DIGIT_PAIRS[]{
+		"00010203040506070809"
+		"10111213141516171819"
+		"20212223242526272829"
+		"30313233343536373839"
+		"40414243444546474849"
+		"50515253545556575859"
+		"60616263646566676869"
+		"70717273747576777879"
+		"80818283848586878889"
+		"90919293949596979899" };
+
+	/** @brief Three-letter English month abbreviations, January first */
+	inline constexpr char MONTH_ABBREVIATIONS[]{ "JanFebMarAprMayJunJulAugSepOctNovDec" };
+
+	/** @brief Three-letter English weekday abbreviations, Sunday first */
+	inline constexpr char WEEKDAY_ABBREVIATIONS[]{ "SunMonTueWedThuFriSat" };
+
+	/** @brief Field values written by the steps */
+	struct FormatFields
+	{
+		std::int32_t year{ 1 };
+		std::int32_t month{ 1 };
+		std::int32_t day{ 1 };
+		std::int32_t dayOfYear{ 1 };
+		std::int32_t dayOfWeek{ 1 };
+		std::int32_t hour{ 0 };
+		std::int32_t minute{ 0 };
+		std::int32_t second{ 0 };
+		std::int32_t fractionTicks{ 0 };
+		std::int32_t offsetMinutes{ 0 };
+
+		/** @brief Write %d as an unpadded day count and a leading '-' when negative (TimeSpan) */
+		bool isSpan{ false };
+
+		/** @brief Span is negative */
+		bool isNegative{ false };
+	};
+
+	/**
+	 * @brief Fields of a calendar value
+	 * @param c DateTime::Components of the value (the offset is left at zero)
+	 */
+	template <typename Components>
+	constexpr FormatFields calendarFormatFields( const Components& c ) noexcept
+	{
+		FormatFields fields;
+		fields.year = c.year;
+		fields.month = c.month;
+		fields.day = c.day;
+		fields.dayOfYear = c.dayOfYear;
+		fields.dayOfWeek = c.dayOfWeek;
+		fields.hour = c.hour;
+		fields.minute = c.minute;
+		fields.second = c.second;
+		fields.fractionTicks = c.fractionTicks;
+
+		return fields;
+	}
+
+	/**
+	 * @brief Fields of a duration: whole days and the time within the day
+	 * @param ticks TimeSpan ticks
+	 */
+	inline constexpr FormatFields spanFormatFields( std::int64_t ticks ) noexcept
+	{
+		std::uint64_t magnitude{ ticks < 0 ? 0ULL - static_cast<std::uint64_t>( ticks ) : static_cast<std::uint64_t>( ticks ) };
+
+		FormatFields fields;
+		fields.isSpan = true;
+		fields.isNegative = ticks < 0;
+		fields.day = static_cast<std::int32_t>( magnitude / constants::TICKS_PER_DAY );
+		magnitude %= constants::TICKS_PER_DAY;
+		fields.hour = static_cast<std::int32_t>( magnitude / constants::TICKS_PER_HOUR );
+		magnitude %= constants::TICKS_PER_HOUR;
+		fields.minute = static_cast<std::int32_t>( magnitude / constants::TICKS_PER_MINUTE );
+		magnitude %= constants::TICKS_PER_MINUTE;
+		fields.second = static_cast<std::int32_t>( magnitude / constants::TICKS_PER_SECOND );
+		fields.fractionTicks = static_cast<std::int32_t>( magnitude % constants::TICKS_PER_SECOND );
+
+		return fields;
+	}
+
+	/** @brief Write a value below 100 as two digits */
+	template <typename OutputIt>
+	constexpr OutputIt writeDigitPair( OutputIt out, std::int32_t value )
+	{
+		const char* pair{ DIGIT_PAIRS + value * 2 };
+		*out++ = pair[0];
+		*out++ = pair[1];
+
+		return out;
+	}
+
+	/** @brief Write a non-negative value without padding */
+	template <typename OutputIt>
+	constexpr OutputIt writeUnpadded( OutputIt out, std::int32_t value )
+	{
+		char digits[10]{};
+		std::size_t count{ 0 };
+		do
+		{
+			digits[count++] = static_cast<char>( '0' + value % 10 );
+			value /= 10;
+		} while ( value != 0 );
+
+		while ( count != 0 )
+		{
+			*out++ = digits[--count];
+		}
+
+		return out;
+	}
+
+	/**
+	 * @brief Write formatted output
+	 * @param steps Compiled steps
+	 * @param stepCount Number of steps
+	 * @param literals Literal buffer of the compiled pattern
+	 * @param fields Values to write
+	 * @param out Output position
+	 * @return Output position after the last byte written
+	 */
+	template <typename OutputIt>
+	constexpr OutputIt writeFormatSteps( const FormatStep* steps, std::size_t stepCount, const char* literals, const FormatFields& fields, OutputIt out )
+	{
+		if ( fields.isNegative )
+		{
+			*out++ = '-';
+		}
+
+		for ( std::size_t i{ 0 }; i < stepCount; ++i )
+		{
+			const FormatStep& step{ steps[i] };
+			switch ( step.field )
+			{
+				case FormatField::Literal:
+				{
+					const char* literal{ literals + step.literalOffset };
+					for ( std::uint8_t j{ 0 }; j < step.width; ++j )
+					{
+						*out++ = literal[j];
+					}
+
+					break;
+				}
+				case FormatField::Year:
+				{
+					out = writeDigitPair( out, fields.year / 100 );
+					out = writeDigitPair( out, fields.year % 100 );
+
+					break;
+				}
+				case FormatField::Month:
+				{
+					out = writeDigitPair( out, fields.month );
+
+					break;
+				}
+				case FormatField::MonthName:
+				{
+					const char* name{ MONTH_ABBREVIATIONS + ( fields.month - 1 ) * 3 };
+					*out++ = name[0];
+					*out++ = name[1];
+					*out++ = name[2];
+
+					break;
+				}
+				case FormatField::Day:
+				{
+					out = fields.isSpan ? writeUnpadded( out, fields.day ) : writeDigitPair( out, fields.day );
+
+					break;
+				}
+				case FormatField::DayOfYear:
+				{
+					*out++ = static_cast<char>( '0' + fields.dayOfYear / 100 );
+					out = writeDigitPair( out, fields.dayOfYear % 100 );
+
+					break;
+				}
+				case FormatField::WeekdayName:
+				{
+					const char* name{ WEEKDAY_ABBREVIATIONS + fields.dayOfWeek * 3 };
+					*out++ = name[0];
+					*out++ = name[1];
+					*out++ = name[2];
+
+					break;
+				}
+				case FormatField::Hour:
+				{
+					out = writeDigitPair( out, fields.hour );
+
+					break;
+				}
+				case FormatField::Minute:
+				{
+					out = writeDigitPair( out, fields.minute );
+
+					break;
+				}
+				case FormatField::Second:
+				{
+					out = writeDigitPair( out, fields.second );
+
+					break;
+				}
+				case FormatField::Fraction:
+				{
+					const std::int32_t fraction{ fields.fractionTicks };
+					*out++ = static_cast<char>( '0' + fraction / 1000000 );
+					out = writeDigitPair( out, fraction / 10000 % 100 );
+					out = writeDigitPair( out, fraction / 100 % 100 );
+					out = writeDigitPair( out, fraction % 100 );
+
+					break;
+				}
+				case FormatField::Offset:
+				{
+					const std::int32_t minutes{ fields.offsetMinutes < 0 ? -fields.offsetMinutes : fields.offsetMinutes };
+					*out++ = fields.offsetMinutes < 0 ? '-' : '+';
+					out = writeDigitPair( out, minutes / constants::MINUTES_PER_HOUR );
+					*out++ = ':';
+					out = writeDigitPair( out, minutes % constants::MINUTES_PER_HOUR );
+
+					break;
+				}
+			}
+		}
+
+		return out;
+	}
+} // namespace nfx::time::internal
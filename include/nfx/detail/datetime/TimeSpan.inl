@@ -31,10 +31,15 @@
  *          for arithmetic operations and time unit conversions.
  */
 
+#include <array>
+#include <charconv>
 #include <cmath>
 #include <stdexcept>
+#include <string_view>
 
 #include "Constants.h"
+#include "Formatter.h"
+#include "Iso8601.h"
 
 namespace nfx::time
 {
@@ -225,6 +230,19 @@ namespace nfx::time
 		return TimeSpan{ static_cast<std::int64_t>( ticks ) };
 	}
 
+	//----------------------------------------------
+	// String formatting
+	//----------------------------------------------
+
+	inline FixedString<constants::MAX_DURATION_LENGTH> TimeSpan::toFixedString() const noexcept
+	{
+		FixedString<constants::MAX_DURATION_LENGTH> result;
+		const auto written{ toChars( result.data(), result.data() + result.capacity() ) };
+		result.resize( written.ec == std::errc{} ? static_cast<std::size_t>( written.ptr - result.data() ) : 0 );
+
+		return result;
+	}
+
 	//=====================================================================
 	// Stream operators
 	//=====================================================================
@@ -308,6 +326,17 @@ namespace nfx::time
 		{
 			return TimeSpan::fromTicks( std::round( static_cast<double>( nanoseconds ) / 100.0 ) );
 		}
+
+		consteval TimeSpan operator""_ts( const char* iso8601DurationString, std::size_t length )
+		{
+			std::int64_t ticks{ 0 };
+			if ( !internal::parseTimeSpan( { iso8601DurationString, length }, ticks ) )
+			{
+				throw std::invalid_argument{ "Invalid ISO 8601 duration literal" };
+			}
+
+			return TimeSpan{ ticks };
+		}
 	} // namespace literals
 } // namespace nfx::time
 
@@ -315,19 +344,50 @@ namespace nfx::time
 // std::formatter specialization
 //=====================================================================
 
+namespace nfx::time::internal
+{
+	/** @brief Format spec names accepted by the TimeSpan formatter */
+	inline constexpr std::array<std::string_view, 2> TIMESPAN_FORMAT_NAMES{ "iso", "ms" };
+} // namespace nfx::time::internal
+
 namespace std
 {
+	/**
+	 * @brief Formats a TimeSpan with an optional spec, e.g. std::format( "{:ms}", elapsed )
+	 * @details Specs: empty or "iso" (ISO 8601 duration, as toString()), "ms" (whole
+	 *          milliseconds, truncated toward zero), or a FormatPattern pattern using
+	 *          %d %H %M %S %f such as "%H:%M:%S.%f". Output goes straight to the format
+	 *          context without a temporary std::string.
+	 */
 	template <>
 	struct formatter<nfx::time::TimeSpan>
 	{
 		constexpr auto parse( std::format_parse_context& ctx )
 		{
-			return ctx.begin();
+			return nfx::time::internal::parseFormatSpec( ctx, nfx::time::internal::TIMESPAN_FORMAT_NAMES, true, m_spec );
 		}
 
-		auto format( const nfx::time::TimeSpan& ts, std::format_context& ctx ) const
+		template <typename FormatContext>
+		auto format( const nfx::time::TimeSpan& ts, FormatContext& ctx ) const
 		{
-			return format_to( ctx.out(), "{}", ts.toString() );
+			if ( m_spec.isPattern )
+			{
+				char buffer[nfx::time::internal::FormatSpec::MAX_OUTPUT_LENGTH];
+				const char* end{ nfx::time::internal::writeFormatSteps(
+					m_spec.steps.data(), m_spec.stepCount, m_spec.literals.data(), nfx::time::internal::spanFormatFields( ts.ticks() ), buffer + 0 ) };
+
+				return nfx::time::internal::writeFormatted( ctx, buffer, end );
+			}
+
+			char buffer[nfx::time::internal::FORMAT_BUFFER_LENGTH];
+			const auto result{ m_spec.name == 0
+								   ? ts.toChars( buffer, buffer + sizeof( buffer ) )
+								   : std::to_chars( buffer, buffer + sizeof( buffer ), ts.ticks() / nfx::time::constants::TICKS_PER_MILLISECOND ) };
+
+			return nfx::time::internal::writeFormatted( ctx, buffer, result.ptr );
 		}
+
+	private:
+		nfx::time::internal::FormatSpec m_spec;
 	};
 } // namespace std
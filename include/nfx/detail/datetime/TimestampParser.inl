@@ -0,0 +1,66 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimestampParser.inl
+ * @brief Inline implementations for TimestampParser statistics accessors
+ */
+
+namespace nfx::time
+{
+	//=====================================================================
+	// TimestampParser class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Statistics
+	//----------------------------------------------
+
+	inline std::uint64_t TimestampParser::hits() const noexcept
+	{
+		return m_hits;
+	}
+
+	inline std::uint64_t TimestampParser::misses() const noexcept
+	{
+		return m_misses;
+	}
+
+	inline bool TimestampParser::hasLayout() const noexcept
+	{
+		return m_layout.length != 0;
+	}
+
+	inline void TimestampParser::resetStatistics() noexcept
+	{
+		m_hits = 0;
+		m_misses = 0;
+	}
+
+	inline void TimestampParser::reset() noexcept
+	{
+		m_layout = Layout{};
+		resetStatistics();
+	}
+} // namespace nfx::time
@@ -0,0 +1,88 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimestampRenderer.inl
+ * @brief Inline implementations for TimestampRenderer construction and accessors
+ */
+
+namespace nfx::time
+{
+	//=====================================================================
+	// TimestampRenderer class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline TimestampRenderer::TimestampRenderer( Granularity granularity ) noexcept
+		: m_periodTicks{ granularity == Granularity::Minute ? constants::TICKS_PER_MINUTE : constants::TICKS_PER_SECOND }
+	{
+	}
+
+	//----------------------------------------------
+	// Rendering
+	//----------------------------------------------
+
+	inline std::to_chars_result TimestampRenderer::renderNow( char* first, char* last ) noexcept
+	{
+		return render( DateTime::utcNow(), first, last );
+	}
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	inline TimestampRenderer::Granularity TimestampRenderer::granularity() const noexcept
+	{
+		return m_periodTicks == constants::TICKS_PER_MINUTE ? Granularity::Minute : Granularity::Second;
+	}
+
+	//----------------------------------------------
+	// Statistics
+	//----------------------------------------------
+
+	inline std::uint64_t TimestampRenderer::hits() const noexcept
+	{
+		return m_hits;
+	}
+
+	inline std::uint64_t TimestampRenderer::misses() const noexcept
+	{
+		return m_misses;
+	}
+
+	inline void TimestampRenderer::resetStatistics() noexcept
+	{
+		m_hits = 0;
+		m_misses = 0;
+	}
+
+	inline void TimestampRenderer::reset() noexcept
+	{
+		m_cached = false;
+		resetStatistics();
+	}
+} // namespace nfx::time
@@ -0,0 +1,1413 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Batch.cpp
+ * @brief Implementation of column-oriented batch operations
+ * @details Each batch is processed in cache-sized chunks. For decomposition a scalar
+ *          pre-pass performs the 64-bit tick divisions (day number, second of day, sub-second
+ *          fraction), after which 32-bit SIMD kernels run the Euclidean-affine calendar
+ *          decomposition with every division replaced by an exact multiply-shift.
+ *          Composition validates and converts entirely in SIMD registers, widening to
+ *          64-bit lanes only for the final tick arithmetic. Parsing shape-checks canonical
+ *          strings into per-field scratch columns, reuses the composition kernels for
+ *          validation and tick arithmetic, and sends every other row to the general parser.
+ *          Formatting decomposes a chunk, turns every field into ASCII digit bytes in SIMD
+ *          registers and assembles each row from a few word stores.
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#include "nfx/datetime/Batch.h"
+#include "Calendar.h"
+#include "CpuFeatures.h"
+#include "FastFormat.h"
+#include "FastParse.h"
+
+namespace nfx::time::batch
+{
+	namespace
+	{
+		//=====================================================================
+		// Kernel constants
+		//=====================================================================
+
+		/** @brief Rows per chunk; keeps the intermediate columns resident in L1/L2 */
+		constexpr std::size_t CHUNK_ROWS{ 2048 };
+		static_assert( CHUNK_ROWS % 64 == 0, "Chunks must start on an ErrorBitmap word boundary" );
+
+		//----------------------------------------------
+		// Exact multiply-shift divisors
+		//----------------------------------------------
+
+		/*
+			Each pair (M, s) satisfies floor( n * M / 2^s ) == n / d for the full input
+			range of the step it is used in (verified exhaustively):
+
+			  d        input range           method
+			  146097   n1 < 2^24             mulhi( n, 15051803 ) >> 9
+			  1461     n2 < 4 * 146097       mulhi( n, 2939745 )
+			  2141     n  < 2^16             mullo( n, 31345 ) >> 26
+			  3600     n  < 86400            mullo( n, 37283 ) >> 27
+			  60       n  < 3600             mullo( n, 2185 ) >> 17
+			  100      n  < 10000            mullo( n, 5243 ) >> 19
+			  10       n  < 100              mullo( n, 103 ) >> 10
+			  5        n  < 1700             mullo( n, 1639 ) >> 13
+		*/
+
+		constexpr std::uint32_t DIV_146097_MUL{ 15051803 };
+		constexpr std::uint32_t DIV_146097_SHIFT{ 9 };
+		constexpr std::uint32_t DIV_1461_MUL{ 2939745 };
+		constexpr std::uint32_t DIV_2141_MUL{ 31345 };
+		constexpr std::uint32_t DIV_2141_SHIFT{ 26 };
+		constexpr std::uint32_t DIV_3600_MUL{ 37283 };
+		constexpr std::uint32_t DIV_3600_SHIFT{ 27 };
+		constexpr std::uint32_t DIV_60_MUL{ 2185 };
+		constexpr std::uint32_t DIV_60_SHIFT{ 17 };
+		constexpr std::uint32_t DIV_100_MUL{ 5243 };
+		constexpr std::uint32_t DIV_100_SHIFT{ 19 };
+		constexpr std::uint32_t DIV_10_MUL{ 103 };
+		constexpr std::uint32_t DIV_10_SHIFT{ 10 };
+		constexpr std::uint32_t DIV_5_MUL{ 1639 };
+		constexpr std::uint32_t DIV_5_SHIFT{ 13 };
+
+		/** @brief TICKS_PER_DAY == TICKS_PER_DAY_ODD << TICKS_PER_DAY_SHIFT, so days * TICKS_PER_DAY fits a 32x32-bit multiply */
+		constexpr std::uint32_t TICKS_PER_DAY_ODD{ 52734375 };
+		constexpr std::uint32_t TICKS_PER_DAY_SHIFT{ 14 };
+		static_assert( std::int64_t{ TICKS_PER_DAY_ODD } << TICKS_PER_DAY_SHIFT == constants::TICKS_PER_DAY );
+
+		/** @brief Day number of March 1 of year 0 relative to January 1, 0001, plus one for the 1-based day */
+		constexpr std::int32_t COMPOSE_DAY_BIAS{ static_cast<std::int32_t>( internal::DAYS_FROM_MARCH_EPOCH ) + 1 };
+
+		/** @brief All-zero column substituted for omitted optional time columns */
+		alignas( 64 ) constexpr std::array<std::int32_t, CHUNK_ROWS> ZERO_COLUMN{};
+
+		/** @brief Per-chunk column pointers for composition */
+		struct ComposeChunk
+		{
+			const std::int32_t* year;
+			const std::int32_t* month;
+			const std::int32_t* day;
+			const std::int32_t* hour;
+			const std::int32_t* minute;
+			const std::int32_t* second;
+			const std::int32_t* fractionTicks;
+			std::int64_t* ticks;
+			std::uint64_t* invalidWords;
+		};
+
+		/** @brief Rows per parse chunk; small enough for the scratch columns to live on the stack */
+		constexpr std::size_t PARSE_CHUNK_ROWS{ 512 };
+		static_assert( PARSE_CHUNK_ROWS % 64 == 0, "Chunks must start on an ErrorBitmap word boundary" );
+
+		/** @brief Per-field scratch columns for one parse chunk */
+		struct ParseChunk
+		{
+			alignas( 64 ) std::array<std::int32_t, PARSE_CHUNK_ROWS> year;
+			alignas( 64 ) std::array<std::int32_t, PARSE_CHUNK_ROWS> month;
+			alignas( 64 ) std::array<std::int32_t, PARSE_CHUNK_ROWS> day;
+			alignas( 64 ) std::array<std::int32_t, PARSE_CHUNK_ROWS> hour;
+			alignas( 64 ) std::array<std::int32_t, PARSE_CHUNK_ROWS> minute;
+			alignas( 64 ) std::array<std::int32_t, PARSE_CHUNK_ROWS> second;
+			alignas( 64 ) std::array<std::int32_t, PARSE_CHUNK_ROWS> fractionTicks;
+			alignas( 64 ) std::array<std::int32_t, PARSE_CHUNK_ROWS> offsetMinutes;
+			alignas( 64 ) std::array<std::int64_t, PARSE_CHUNK_ROWS> ticks;
+
+			/** @brief Rows left to the general parser, one bit per row */
+			std::array<std::uint64_t, PARSE_CHUNK_ROWS / 64> fallbackWords;
+		};
+
+		/** @brief Per-chunk column pointers for decomposition */
+		struct DecomposeChunk
+		{
+			std::int32_t* year;
+			std::int32_t* month;
+			std::int32_t* day;
+			std::int32_t* hour;
+			std::int32_t* minute;
+			std::int32_t* second;
+			std::int32_t* fractionTicks;
+		};
+
+		/** @brief "00" as a little-endian 16-bit word */
+		constexpr std::uint32_t ASCII_ZERO_PAIR{ 0x3030 };
+
+		/** @brief Rows per format chunk; the field columns live on the stack and the output stays in L1/L2 */
+		constexpr std::size_t FORMAT_CHUNK_ROWS{ 512 };
+
+		/** @brief Per-field scratch columns for one format chunk */
+		struct FormatChunk
+		{
+			alignas( 64 ) std::array<std::int32_t, FORMAT_CHUNK_ROWS> year;
+			alignas( 64 ) std::array<std::int32_t, FORMAT_CHUNK_ROWS> month;
+			alignas( 64 ) std::array<std::int32_t, FORMAT_CHUNK_ROWS> day;
+			alignas( 64 ) std::array<std::int32_t, FORMAT_CHUNK_ROWS> hour;
+			alignas( 64 ) std::array<std::int32_t, FORMAT_CHUNK_ROWS> minute;
+			alignas( 64 ) std::array<std::int32_t, FORMAT_CHUNK_ROWS> second;
+			alignas( 64 ) std::array<std::int32_t, FORMAT_CHUNK_ROWS> fractionTicks;
+		};
+
+		constexpr auto TICKS_PER_DAY{ constants::TICKS_PER_DAY };
+		constexpr auto TICKS_PER_SECOND{ constants::TICKS_PER_SECOND };
+
+		//=====================================================================
+		// SIMD dispatch state
+		//=====================================================================
+
+		SimdLevel detectSimdLevel() noexcept
+		{
+#if NFX_DATETIME_X86_64 && defined( NFX_DATETIME_SIMD ) && NFX_DATETIME_SIMD
+			if ( internal::cpuHasAvx512f() )
+			{
+				return SimdLevel::Avx512;
+			}
+			if ( internal::cpuHasAvx2() )
+			{
+				return SimdLevel::Avx2;
+			}
+#endif
+
+			return SimdLevel::Scalar;
+		}
+
+		std::atomic<SimdLevel>& activeSimdLevel() noexcept
+		{
+			static std::atomic<SimdLevel> level{ supportedSimdLevel() };
+
+			return level;
+		}
+
+		//=====================================================================
+		// Scalar kernels
+		//=====================================================================
+
+		/** @brief Split ticks into day number, second of day and sub-second fraction */
+		inline void splitTicks( std::int64_t ticks, std::int32_t& days, std::int32_t& secondOfDay, std::int32_t& fractionTicks ) noexcept
+		{
+			const auto u{ static_cast<std::uint64_t>( ticks ) };
+			const auto timeTicks{ u % TICKS_PER_DAY };
+
+			days = static_cast<std::int32_t>( u / TICKS_PER_DAY );
+			secondOfDay = static_cast<std::int32_t>( timeTicks / TICKS_PER_SECOND );
+			fractionTicks = static_cast<std::int32_t>( timeTicks % TICKS_PER_SECOND );
+		}
+
+		/** @brief Scalar tail for the SIMD kernels: days/second-of-day columns to fields in place */
+		void decomposeFieldsScalar( std::int32_t* year, std::int32_t* month, std::int32_t* day,
+			std::int32_t* hour, std::int32_t* minute, std::int32_t* second, std::size_t count ) noexcept
+		{
+			for ( std::size_t i{ 0 }; i < count; ++i )
+			{
+				internal::dateComponentsFromDays( year[i], year[i], month[i], day[i] );
+
+				const auto secondOfDay{ hour[i] };
+				hour[i] = secondOfDay / constants::SECONDS_PER_HOUR;
+				minute[i] = secondOfDay % constants::SECONDS_PER_HOUR / constants::SECONDS_PER_MINUTE;
+				second[i] = secondOfDay % constants::SECONDS_PER_MINUTE;
+			}
+		}
+
+		void decomposeChunkScalar( const DateTime* values, std::size_t count, const DecomposeChunk& chunk ) noexcept
+		{
+			for ( std::size_t i{ 0 }; i < count; ++i )
+			{
+				const auto ticks{ values[i].ticks() };
+				internal::dateComponentsFromTicks( ticks, chunk.year[i], chunk.month[i], chunk.day[i] );
+
+				std::int32_t days, secondOfDay;
+				splitTicks( ticks, days, secondOfDay, chunk.fractionTicks[i] );
+				chunk.hour[i] = secondOfDay / constants::SECONDS_PER_HOUR;
+				chunk.minute[i] = secondOfDay % constants::SECONDS_PER_HOUR / constants::SECONDS_PER_MINUTE;
+				chunk.second[i] = secondOfDay % constants::SECONDS_PER_MINUTE;
+			}
+		}
+
+		/** @brief Compose rows [first, count) of a chunk one at a time; returns the number of invalid rows */
+		std::size_t composeChunkScalar( const ComposeChunk& chunk, std::size_t first, std::size_t count ) noexcept
+		{
+			std::size_t invalid{ 0 };
+			for ( std::size_t i{ first }; i < count; ++i )
+			{
+				const auto fraction{ chunk.fractionTicks[i] };
+				if ( !internal::isValidDate( chunk.year[i], chunk.month[i], chunk.day[i] ) ||
+					 !internal::isValidTime( chunk.hour[i], chunk.minute[i], chunk.second[i], 0 ) ||
+					 fraction < 0 || fraction >= TICKS_PER_SECOND )
+				{
+					chunk.ticks[i] = constants::MIN_DATETIME_TICKS;
+					chunk.invalidWords[i >> 6] |= std::uint64_t{ 1 } << ( i & 63 );
+					++invalid;
+
+					continue;
+				}
+
+				chunk.ticks[i] = internal::dateToTicks( chunk.year[i], chunk.month[i], chunk.day[i] ) +
+								 internal::timeToTicks( chunk.hour[i], chunk.minute[i], chunk.second[i], 0 ) +
+								 fraction;
+			}
+
+			return invalid;
+		}
+
+		/** @brief Store a row whose canonical prefix matched, provided the fraction and suffix do too */
+		inline bool storeCanonicalRow( ParseChunk& chunk, std::size_t i, std::string_view text, const internal::CanonicalFields& fields ) noexcept
+		{
+			const char* end{ text.data() + text.size() };
+			std::int32_t fractionTicks, offsetMinutes;
+			const char* ptr{ internal::parseCanonicalFraction( text.data() + internal::CANONICAL_PREFIX_LENGTH, end, fractionTicks ) };
+			if ( ptr == nullptr || !internal::parseCanonicalOffset( ptr, end, offsetMinutes ) )
+			{
+				return false;
+			}
+
+			chunk.year[i] = fields.year;
+			chunk.month[i] = fields.month;
+			chunk.day[i] = fields.day;
+			chunk.hour[i] = fields.hour;
+			chunk.minute[i] = fields.minute;
+			chunk.second[i] = fields.second;
+			chunk.fractionTicks[i] = fractionTicks;
+			chunk.offsetMinutes[i] = offsetMinutes;
+
+			return true;
+		}
+
+		/** @brief Leave a row to the general parser; the placeholder fields always compose */
+		inline void storeFallbackRow( ParseChunk& chunk, std::size_t i ) noexcept
+		{
+			chunk.year[i] = 1;
+			chunk.month[i] = 1;
+			chunk.day[i] = 1;
+			chunk.hour[i] = 0;
+			chunk.minute[i] = 0;
+			chunk.second[i] = 0;
+			chunk.fractionTicks[i] = 0;
+			chunk.offsetMinutes[i] = 0;
+			chunk.fallbackWords[i >> 6] |= std::uint64_t{ 1 } << ( i & 63 );
+		}
+
+		/** @brief Shape-check and split rows [first, count) of a chunk one at a time */
+		void extractChunkScalar( const std::string_view* rows, ParseChunk& chunk, std::size_t first, std::size_t count ) noexcept
+		{
+			for ( std::size_t i{ first }; i < count; ++i )
+			{
+				internal::CanonicalFields fields;
+				if ( rows[i].size() < internal::CANONICAL_PREFIX_LENGTH ||
+					 !internal::parseCanonicalPrefix( rows[i].data(), fields ) ||
+					 !storeCanonicalRow( chunk, i, rows[i], fields ) )
+				{
+					storeFallbackRow( chunk, i );
+				}
+			}
+		}
+
+		/** @brief ASCII digits of a value below 100 as a little-endian 16-bit word, tens first */
+		inline std::uint32_t asciiPair( std::uint32_t value ) noexcept
+		{
+			const std::uint32_t tens{ ( value * DIV_10_MUL ) >> DIV_10_SHIFT };
+
+			return ( tens | ( value - tens * 10 ) << 8 ) | ASCII_ZERO_PAIR;
+		}
+
+		/** @brief Replace rows [first, count) of decomposed fields by ASCII digits: four bytes for the year, two for the others */
+		void asciiDigitsScalar( const DecomposeChunk& chunk, std::size_t first, std::size_t count ) noexcept
+		{
+			for ( std::size_t i{ first }; i < count; ++i )
+			{
+				const auto year{ static_cast<std::uint32_t>( chunk.year[i] ) };
+				const auto century{ ( year * DIV_100_MUL ) >> DIV_100_SHIFT };
+				chunk.year[i] = static_cast<std::int32_t>( asciiPair( century ) | asciiPair( year - century * 100 ) << 16 );
+				chunk.month[i] = static_cast<std::int32_t>( asciiPair( static_cast<std::uint32_t>( chunk.month[i] ) ) );
+				chunk.day[i] = static_cast<std::int32_t>( asciiPair( static_cast<std::uint32_t>( chunk.day[i] ) ) );
+				chunk.hour[i] = static_cast<std::int32_t>( asciiPair( static_cast<std::uint32_t>( chunk.hour[i] ) ) );
+				chunk.minute[i] = static_cast<std::int32_t>( asciiPair( static_cast<std::uint32_t>( chunk.minute[i] ) ) );
+				chunk.second[i] = static_cast<std::int32_t>( asciiPair( static_cast<std::uint32_t>( chunk.second[i] ) ) );
+			}
+		}
+
+#if NFX_DATETIME_X86_64
+		//=====================================================================
+		// AVX2 kernels
+		//=====================================================================
+
+		/** @brief Unsigned high half of a 32x32-bit multiply in each lane */
+		NFX_DATETIME_TARGET( "avx2" ) inline __m256i mulhiEpu32( __m256i a, __m256i b ) noexcept
+		{
+			const __m256i even{ _mm256_srli_epi64( _mm256_mul_epu32( a, b ), 32 ) };
+			const __m256i odd{ _mm256_mul_epu32( _mm256_srli_epi64( a, 32 ), _mm256_srli_epi64( b, 32 ) ) };
+
+			return _mm256_blend_epi32( even, odd, 0xAA );
+		}
+
+		NFX_DATETIME_TARGET( "avx2" ) void decomposeFieldsAvx2( std::int32_t* year, std::int32_t* month, std::int32_t* day,
+			std::int32_t* hour, std::int32_t* minute, std::int32_t* second, std::size_t count ) noexcept
+		{
+			const __m256i marchEpoch{ _mm256_set1_epi32( static_cast<int>( internal::DAYS_FROM_MARCH_EPOCH ) ) };
+			const __m256i three{ _mm256_set1_epi32( 3 ) };
+			const __m256i div146097{ _mm256_set1_epi32( static_cast<int>( DIV_146097_MUL ) ) };
+			const __m256i daysPer400Years{ _mm256_set1_epi32( constants::DAYS_PER_400_YEARS ) };
+			const __m256i div1461{ _mm256_set1_epi32( static_cast<int>( DIV_1461_MUL ) ) };
+			const __m256i daysPer4Years{ _mm256_set1_epi32( constants::DAYS_PER_4_YEARS ) };
+			const __m256i monthSlope{ _mm256_set1_epi32( 2141 ) };
+			const __m256i monthOffset{ _mm256_set1_epi32( 197913 ) };
+			const __m256i lowMask{ _mm256_set1_epi32( 0xFFFF ) };
+			const __m256i div2141{ _mm256_set1_epi32( static_cast<int>( DIV_2141_MUL ) ) };
+			const __m256i lastMarchDay{ _mm256_set1_epi32( static_cast<int>( internal::DAYS_FROM_MARCH_EPOCH ) - 1 ) };
+			const __m256i twelve{ _mm256_set1_epi32( 12 ) };
+			const __m256i hundred{ _mm256_set1_epi32( 100 ) };
+			const __m256i one{ _mm256_set1_epi32( 1 ) };
+			const __m256i div3600{ _mm256_set1_epi32( static_cast<int>( DIV_3600_MUL ) ) };
+			const __m256i secondsPerHour{ _mm256_set1_epi32( constants::SECONDS_PER_HOUR ) };
+			const __m256i div60{ _mm256_set1_epi32( static_cast<int>( DIV_60_MUL ) ) };
+			const __m256i sixty{ _mm256_set1_epi32( constants::SECONDS_PER_MINUTE ) };
+
+			std::size_t i{ 0 };
+			for ( ; i + 8 <= count; i += 8 )
+			{
+				// Date: Neri-Schneider with multiply-shift divisions
+				const __m256i n{ _mm256_add_epi32( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( year + i ) ), marchEpoch ) };
+				const __m256i n1{ _mm256_add_epi32( _mm256_slli_epi32( n, 2 ), three ) };
+				const __m256i century{ _mm256_srli_epi32( mulhiEpu32( n1, div146097 ), DIV_146097_SHIFT ) };
+				const __m256i dayOfCentury{ _mm256_srli_epi32( _mm256_sub_epi32( n1, _mm256_mullo_epi32( century, daysPer400Years ) ), 2 ) };
+
+				const __m256i n2{ _mm256_add_epi32( _mm256_slli_epi32( dayOfCentury, 2 ), three ) };
+				const __m256i yearOfCentury{ mulhiEpu32( n2, div1461 ) };
+				const __m256i dayOfYear{ _mm256_srli_epi32( _mm256_sub_epi32( n2, _mm256_mullo_epi32( yearOfCentury, daysPer4Years ) ), 2 ) };
+
+				const __m256i n3{ _mm256_add_epi32( _mm256_mullo_epi32( dayOfYear, monthSlope ), monthOffset ) };
+				const __m256i m{ _mm256_srli_epi32( n3, 16 ) };
+				const __m256i d{ _mm256_srli_epi32( _mm256_mullo_epi32( _mm256_and_si256( n3, lowMask ), div2141 ), DIV_2141_SHIFT ) };
+
+				// All-ones in January/February lanes: roll over into the next Gregorian year
+				const __m256i isJanOrFeb{ _mm256_cmpgt_epi32( dayOfYear, lastMarchDay ) };
+
+				const __m256i y{ _mm256_sub_epi32( _mm256_add_epi32( _mm256_mullo_epi32( century, hundred ), yearOfCentury ), isJanOrFeb ) };
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( year + i ), y );
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( month + i ), _mm256_sub_epi32( m, _mm256_and_si256( isJanOrFeb, twelve ) ) );
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( day + i ), _mm256_add_epi32( d, one ) );
+
+				// Time of day
+				const __m256i secondOfDay{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( hour + i ) ) };
+				const __m256i h{ _mm256_srli_epi32( _mm256_mullo_epi32( secondOfDay, div3600 ), DIV_3600_SHIFT ) };
+				const __m256i secondOfHour{ _mm256_sub_epi32( secondOfDay, _mm256_mullo_epi32( h, secondsPerHour ) ) };
+				const __m256i mi{ _mm256_srli_epi32( _mm256_mullo_epi32( secondOfHour, div60 ), DIV_60_SHIFT ) };
+
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( hour + i ), h );
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( minute + i ), mi );
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( second + i ), _mm256_sub_epi32( secondOfHour, _mm256_mullo_epi32( mi, sixty ) ) );
+			}
+
+			decomposeFieldsScalar( year + i, month + i, day + i, hour + i, minute + i, second + i, count - i );
+		}
+
+		/** @brief ASCII digits of values below 100 as 16-bit words in 32-bit lanes, tens first */
+		NFX_DATETIME_TARGET( "avx2" ) inline __m256i asciiPairsAvx2( __m256i values ) noexcept
+		{
+			// Products stay below 2^16, so 16-bit multiplies are exact in the zero-extended lanes
+			const __m256i tens{ _mm256_srli_epi32( _mm256_mullo_epi16( values, _mm256_set1_epi32( DIV_10_MUL ) ), DIV_10_SHIFT ) };
+			const __m256i ones{ _mm256_sub_epi32( values, _mm256_mullo_epi16( tens, _mm256_set1_epi32( 10 ) ) ) };
+
+			return _mm256_or_si256( _mm256_or_si256( tens, _mm256_slli_epi32( ones, 8 ) ), _mm256_set1_epi32( ASCII_ZERO_PAIR ) );
+		}
+
+		/** @brief Replace decomposed fields by ASCII digits, eight rows at a time */
+		NFX_DATETIME_TARGET( "avx2" ) void asciiDigitsAvx2( const DecomposeChunk& chunk, std::size_t count ) noexcept
+		{
+			const __m256i div100{ _mm256_set1_epi32( static_cast<int>( DIV_100_MUL ) ) };
+			const __m256i hundred{ _mm256_set1_epi32( 100 ) };
+			const auto convert{ []( std::int32_t* column ) NFX_DATETIME_TARGET( "avx2" ) {
+				const __m256i values{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( column ) ) };
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( column ), asciiPairsAvx2( values ) );
+			} };
+
+			std::size_t i{ 0 };
+			for ( ; i + 8 <= count; i += 8 )
+			{
+				const __m256i year{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( chunk.year + i ) ) };
+				const __m256i century{ _mm256_srli_epi32( _mm256_mullo_epi32( year, div100 ), DIV_100_SHIFT ) };
+				const __m256i yearOfCentury{ _mm256_sub_epi32( year, _mm256_mullo_epi32( century, hundred ) ) };
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( chunk.year + i ),
+					_mm256_or_si256( asciiPairsAvx2( century ), _mm256_slli_epi32( asciiPairsAvx2( yearOfCentury ), 16 ) ) );
+
+				convert( chunk.month + i );
+				convert( chunk.day + i );
+				convert( chunk.hour + i );
+				convert( chunk.minute + i );
+				convert( chunk.second + i );
+			}
+
+			asciiDigitsScalar( chunk, i, count );
+		}
+
+		/** @brief Out-of-range lanes of x, i.e. x < lo || x > hi */
+		NFX_DATETIME_TARGET( "avx2" ) inline __m256i outOfRange( __m256i x, std::int32_t lo, std::int32_t hi ) noexcept
+		{
+			return _mm256_or_si256( _mm256_cmpgt_epi32( _mm256_set1_epi32( lo ), x ), _mm256_cmpgt_epi32( x, _mm256_set1_epi32( hi ) ) );
+		}
+
+		/** @brief Widen 4 unsigned 32-bit lanes and compute days * TICKS_PER_DAY + seconds * TICKS_PER_SECOND + fraction */
+		NFX_DATETIME_TARGET( "avx2" ) inline __m256i ticksFromParts( __m128i days, __m128i seconds, __m128i fraction ) noexcept
+		{
+			const __m256i dayTicks{ _mm256_slli_epi64(
+				_mm256_mul_epu32( _mm256_cvtepu32_epi64( days ), _mm256_set1_epi64x( TICKS_PER_DAY_ODD ) ), TICKS_PER_DAY_SHIFT ) };
+			const __m256i secondTicks{ _mm256_mul_epu32( _mm256_cvtepu32_epi64( seconds ), _mm256_set1_epi64x( TICKS_PER_SECOND ) ) };
+
+			return _mm256_add_epi64( _mm256_add_epi64( dayTicks, secondTicks ), _mm256_cvtepu32_epi64( fraction ) );
+		}
+
+		NFX_DATETIME_TARGET( "avx2" ) std::size_t composeChunkAvx2( const ComposeChunk& chunk, std::size_t count ) noexcept
+		{
+			const __m256i zero{ _mm256_setzero_si256() };
+			const __m256i one{ _mm256_set1_epi32( 1 ) };
+			const __m256i two{ _mm256_set1_epi32( 2 ) };
+			const __m256i three{ _mm256_set1_epi32( 3 ) };
+			const __m256i twelve{ _mm256_set1_epi32( 12 ) };
+			const __m256i twentyEight{ _mm256_set1_epi32( 28 ) };
+			const __m256i thirty{ _mm256_set1_epi32( 30 ) };
+			const __m256i hundred{ _mm256_set1_epi32( 100 ) };
+			const __m256i div100{ _mm256_set1_epi32( static_cast<int>( DIV_100_MUL ) ) };
+			const __m256i div5{ _mm256_set1_epi32( static_cast<int>( DIV_5_MUL ) ) };
+			const __m256i daysPerYear{ _mm256_set1_epi32( constants::DAYS_PER_YEAR ) };
+			const __m256i monthSlope{ _mm256_set1_epi32( 153 ) };
+			const __m256i dayBias{ _mm256_set1_epi32( COMPOSE_DAY_BIAS ) };
+			const __m256i secondsPerHour{ _mm256_set1_epi32( constants::SECONDS_PER_HOUR ) };
+			const __m256i sixty{ _mm256_set1_epi32( constants::SECONDS_PER_MINUTE ) };
+			const __m256i minTicks{ _mm256_set1_epi64x( constants::MIN_DATETIME_TICKS ) };
+
+			std::size_t invalid{ 0 };
+			std::size_t i{ 0 };
+			for ( ; i + 8 <= count; i += 8 )
+			{
+				const __m256i y{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( chunk.year + i ) ) };
+				const __m256i m{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( chunk.month + i ) ) };
+				const __m256i d{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( chunk.day + i ) ) };
+				const __m256i h{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( chunk.hour + i ) ) };
+				const __m256i mi{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( chunk.minute + i ) ) };
+				const __m256i s{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( chunk.second + i ) ) };
+				const __m256i f{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( chunk.fractionTicks + i ) ) };
+
+				// Range validation
+				__m256i bad{ outOfRange( y, constants::MIN_YEAR, constants::MAX_YEAR ) };
+				bad = _mm256_or_si256( bad, outOfRange( m, 1, 12 ) );
+				bad = _mm256_or_si256( bad, outOfRange( h, 0, constants::HOURS_PER_DAY - 1 ) );
+				bad = _mm256_or_si256( bad, outOfRange( mi, 0, constants::MINUTES_PER_HOUR - 1 ) );
+				bad = _mm256_or_si256( bad, outOfRange( s, 0, constants::SECONDS_PER_MINUTE - 1 ) );
+				bad = _mm256_or_si256( bad, outOfRange( f, 0, static_cast<std::int32_t>( TICKS_PER_SECOND - 1 ) ) );
+
+				// Days in month: 30/31 by month parity (flipped from August), February by leap year
+				const __m256i century{ _mm256_srli_epi32( _mm256_mullo_epi32( y, div100 ), DIV_100_SHIFT ) };
+				const __m256i isDiv4{ _mm256_cmpeq_epi32( _mm256_and_si256( y, three ), zero ) };
+				const __m256i isDiv100{ _mm256_cmpeq_epi32( y, _mm256_mullo_epi32( century, hundred ) ) };
+				const __m256i isDiv400{ _mm256_and_si256( isDiv100, _mm256_cmpeq_epi32( _mm256_and_si256( century, three ), zero ) ) };
+				const __m256i isLeap{ _mm256_or_si256( _mm256_andnot_si256( isDiv100, isDiv4 ), isDiv400 ) };
+				const __m256i longMonth{ _mm256_and_si256( _mm256_xor_si256( m, _mm256_srli_epi32( m, 3 ) ), one ) };
+				const __m256i daysInMonth{ _mm256_blendv_epi8(
+					_mm256_add_epi32( thirty, longMonth ), _mm256_sub_epi32( twentyEight, isLeap ), _mm256_cmpeq_epi32( m, two ) ) };
+				bad = _mm256_or_si256( bad, _mm256_or_si256( _mm256_cmpgt_epi32( one, d ), _mm256_cmpgt_epi32( d, daysInMonth ) ) );
+
+				// Day number from a March-based year so that the leap day is last
+				const __m256i isJanOrFeb{ _mm256_cmpgt_epi32( three, m ) };
+				const __m256i marchYear{ _mm256_add_epi32( y, isJanOrFeb ) };
+				const __m256i marchMonth{ _mm256_add_epi32( _mm256_sub_epi32( m, three ), _mm256_and_si256( isJanOrFeb, twelve ) ) };
+				const __m256i marchCentury{ _mm256_srli_epi32( _mm256_mullo_epi32( marchYear, div100 ), DIV_100_SHIFT ) };
+				const __m256i monthDays{ _mm256_srli_epi32( _mm256_mullo_epi32( _mm256_add_epi32( _mm256_mullo_epi32( marchMonth, monthSlope ), two ), div5 ), DIV_5_SHIFT ) };
+
+				__m256i days{ _mm256_mullo_epi32( marchYear, daysPerYear ) };
+				days = _mm256_add_epi32( days, _mm256_srli_epi32( marchYear, 2 ) );
+				days = _mm256_sub_epi32( days, marchCentury );
+				days = _mm256_add_epi32( days, _mm256_srli_epi32( marchCentury, 2 ) );
+				days = _mm256_add_epi32( days, monthDays );
+				days = _mm256_sub_epi32( _mm256_add_epi32( days, d ), dayBias );
+
+				const __m256i seconds{ _mm256_add_epi32(
+					_mm256_add_epi32( _mm256_mullo_epi32( h, secondsPerHour ), _mm256_mullo_epi32( mi, sixty ) ), s ) };
+
+				// Widen to 64-bit ticks; invalid rows collapse to MIN_DATETIME_TICKS
+				const __m256i ticksLo{ _mm256_blendv_epi8(
+					ticksFromParts( _mm256_castsi256_si128( days ), _mm256_castsi256_si128( seconds ), _mm256_castsi256_si128( f ) ),
+					minTicks, _mm256_cvtepi32_epi64( _mm256_castsi256_si128( bad ) ) ) };
+				const __m256i ticksHi{ _mm256_blendv_epi8(
+					ticksFromParts( _mm256_extracti128_si256( days, 1 ), _mm256_extracti128_si256( seconds, 1 ), _mm256_extracti128_si256( f, 1 ) ),
+					minTicks, _mm256_cvtepi32_epi64( _mm256_extracti128_si256( bad, 1 ) ) ) };
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( chunk.ticks + i ), ticksLo );
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( chunk.ticks + i + 4 ), ticksHi );
+
+				const auto bits{ static_cast<std::uint32_t>( _mm256_movemask_ps( _mm256_castsi256_ps( bad ) ) ) };
+				chunk.invalidWords[i >> 6] |= std::uint64_t{ bits } << ( i & 63 );
+				invalid += static_cast<std::size_t>( std::popcount( bits ) );
+			}
+
+			return invalid + composeChunkScalar( chunk, i, count );
+		}
+
+		/**
+		 * @brief Shape-check the YYYY-MM-DDTHH:MM:SS prefix of two strings at once
+		 * @param first,second Strings with at least CANONICAL_PREFIX_LENGTH readable bytes
+		 * @param pairs Receives per string [YY, YY, MM, DD, HH, MM, SS, -] two-digit values
+		 * @return Bit 0 set if first matches, bit 1 set if second matches
+		 * @details Each 128-bit lane holds one string: bytes 0-15 from one load and bytes
+		 *          16-18 from an overlapping load at offset 3, so no byte past the prefix is read.
+		 */
+		NFX_DATETIME_TARGET( "avx2" ) inline std::uint32_t canonicalPrefixPairAvx2( const char* first, const char* second, std::int16_t* pairs ) noexcept
+		{
+			const __m256i head{ _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( reinterpret_cast<const __m128i*>( first ) ) ),
+				_mm_loadu_si128( reinterpret_cast<const __m128i*>( second ) ), 1 ) };
+			const __m256i tail{ _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( reinterpret_cast<const __m128i*>( first + 3 ) ) ),
+				_mm_loadu_si128( reinterpret_cast<const __m128i*>( second + 3 ) ), 1 ) };
+
+			// "YYYY-MM-DDTHH:MM" in head, ":SS" in the top three bytes of tail
+			const __m256i headDigits{ _mm256_setr_epi8(
+				-1, -1, -1, -1, 0, -1, -1, 0, -1, -1, 0, -1, -1, 0, -1, -1,
+				-1, -1, -1, -1, 0, -1, -1, 0, -1, -1, 0, -1, -1, 0, -1, -1 ) };
+			const __m256i headSeparators{ _mm256_setr_epi8(
+				0, 0, 0, 0, '-', 0, 0, '-', 0, 0, 'T', 0, 0, ':', 0, 0,
+				0, 0, 0, 0, '-', 0, 0, '-', 0, 0, 'T', 0, 0, ':', 0, 0 ) };
+			const __m256i tailDigits{ _mm256_setr_epi8(
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1 ) };
+			const __m256i tailSeparatorLanes{ _mm256_setr_epi8(
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0 ) };
+			const __m256i tailSeparators{ _mm256_and_si256( tailSeparatorLanes, _mm256_set1_epi8( ':' ) ) };
+			const __m256i asciiZero{ _mm256_set1_epi8( '0' ) };
+			const __m256i nine{ _mm256_set1_epi8( 9 ) };
+
+			const __m256i headValues{ _mm256_sub_epi8( head, asciiZero ) };
+			const __m256i tailValues{ _mm256_sub_epi8( tail, asciiZero ) };
+			const __m256i headIsDigit{ _mm256_cmpeq_epi8( _mm256_min_epu8( headValues, nine ), headValues ) };
+			const __m256i tailIsDigit{ _mm256_cmpeq_epi8( _mm256_min_epu8( tailValues, nine ), tailValues ) };
+
+			const __m256i headOk{ _mm256_or_si256(
+				_mm256_and_si256( headIsDigit, headDigits ),
+				_mm256_andnot_si256( headDigits, _mm256_cmpeq_epi8( head, headSeparators ) ) ) };
+			const __m256i tailChecked{ _mm256_or_si256( tailDigits, tailSeparatorLanes ) };
+			const __m256i tailOk{ _mm256_or_si256(
+				_mm256_or_si256( _mm256_and_si256( tailIsDigit, tailDigits ), _mm256_and_si256( tailSeparatorLanes, _mm256_cmpeq_epi8( tail, tailSeparators ) ) ),
+				_mm256_andnot_si256( tailChecked, _mm256_set1_epi8( -1 ) ) ) };
+
+			const auto matched{ static_cast<std::uint32_t>( _mm256_movemask_epi8( headOk ) ) &
+								static_cast<std::uint32_t>( _mm256_movemask_epi8( tailOk ) ) };
+
+			// Gather the fourteen digits of each string into adjacent pairs, then 10 * a + b
+			const __m256i headGather{ _mm256_setr_epi8(
+				0, 1, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, -1, -1, -1, -1,
+				0, 1, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, -1, -1, -1, -1 ) };
+			const __m256i tailGather{ _mm256_setr_epi8(
+				-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 14, 15, -1, -1,
+				-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 14, 15, -1, -1 ) };
+			const __m256i digits{ _mm256_or_si256( _mm256_shuffle_epi8( headValues, headGather ), _mm256_shuffle_epi8( tailValues, tailGather ) ) };
+			_mm256_storeu_si256( reinterpret_cast<__m256i*>( pairs ), _mm256_maddubs_epi16( digits, _mm256_set1_epi16( 0x010A ) ) );
+
+			return static_cast<std::uint32_t>( ( matched & 0xFFFF ) == 0xFFFF ) |
+				   static_cast<std::uint32_t>( ( matched >> 16 ) == 0xFFFF ) << 1;
+		}
+
+		/** @brief Shape-check and split the rows of a chunk, two strings per prefix check */
+		NFX_DATETIME_TARGET( "avx2" ) void extractChunkAvx2( const std::string_view* rows, ParseChunk& chunk, std::size_t count ) noexcept
+		{
+			const auto fieldsAt{ []( const std::int16_t* pairs ) {
+				return internal::CanonicalFields{ pairs[0] * 100 + pairs[1], pairs[2], pairs[3], pairs[4], pairs[5], pairs[6] };
+			} };
+
+			alignas( 32 ) std::int16_t pairs[16];
+			std::size_t i{ 0 };
+			for ( ; i + 2 <= count; i += 2 )
+			{
+				if ( rows[i].size() < internal::CANONICAL_PREFIX_LENGTH || rows[i + 1].size() < internal::CANONICAL_PREFIX_LENGTH )
+				{
+					extractChunkScalar( rows, chunk, i, i + 2 );
+
+					continue;
+				}
+
+				const auto matched{ canonicalPrefixPairAvx2( rows[i].data(), rows[i + 1].data(), pairs ) };
+				if ( !( matched & 1 ) || !storeCanonicalRow( chunk, i, rows[i], fieldsAt( pairs ) ) )
+				{
+					storeFallbackRow( chunk, i );
+				}
+				if ( !( matched & 2 ) || !storeCanonicalRow( chunk, i + 1, rows[i + 1], fieldsAt( pairs + 8 ) ) )
+				{
+					storeFallbackRow( chunk, i + 1 );
+				}
+			}
+
+			extractChunkScalar( rows, chunk, i, count );
+		}
+
+		//=====================================================================
+		// AVX-512 kernels
+		//=====================================================================
+
+		/** @brief Unsigned high half of a 32x32-bit multiply in each lane */
+		NFX_DATETIME_TARGET( "avx512f" ) inline __m512i mulhiEpu32( __m512i a, __m512i b ) noexcept
+		{
+			const __m512i even{ _mm512_srli_epi64( _mm512_mul_epu32( a, b ), 32 ) };
+			const __m512i odd{ _mm512_mul_epu32( _mm512_srli_epi64( a, 32 ), _mm512_srli_epi64( b, 32 ) ) };
+
+			return _mm512_mask_blend_epi32( 0xAAAA, even, odd );
+		}
+
+		NFX_DATETIME_TARGET( "avx512f" ) void decomposeFieldsAvx512( std::int32_t* year, std::int32_t* month, std::int32_t* day,
+			std::int32_t* hour, std::int32_t* minute, std::int32_t* second, std::size_t count ) noexcept
+		{
+			const __m512i marchEpoch{ _mm512_set1_epi32( static_cast<int>( internal::DAYS_FROM_MARCH_EPOCH ) ) };
+			const __m512i three{ _mm512_set1_epi32( 3 ) };
+			const __m512i div146097{ _mm512_set1_epi32( static_cast<int>( DIV_146097_MUL ) ) };
+			const __m512i daysPer400Years{ _mm512_set1_epi32( constants::DAYS_PER_400_YEARS ) };
+			const __m512i div1461{ _mm512_set1_epi32( static_cast<int>( DIV_1461_MUL ) ) };
+			const __m512i daysPer4Years{ _mm512_set1_epi32( constants::DAYS_PER_4_YEARS ) };
+			const __m512i monthSlope{ _mm512_set1_epi32( 2141 ) };
+			const __m512i monthOffset{ _mm512_set1_epi32( 197913 ) };
+			const __m512i lowMask{ _mm512_set1_epi32( 0xFFFF ) };
+			const __m512i div2141{ _mm512_set1_epi32( static_cast<int>( DIV_2141_MUL ) ) };
+			const __m512i lastMarchDay{ _mm512_set1_epi32( static_cast<int>( internal::DAYS_FROM_MARCH_EPOCH ) - 1 ) };
+			const __m512i twelve{ _mm512_set1_epi32( 12 ) };
+			const __m512i hundred{ _mm512_set1_epi32( 100 ) };
+			const __m512i one{ _mm512_set1_epi32( 1 ) };
+			const __m512i div3600{ _mm512_set1_epi32( static_cast<int>( DIV_3600_MUL ) ) };
+			const __m512i secondsPerHour{ _mm512_set1_epi32( constants::SECONDS_PER_HOUR ) };
+			const __m512i div60{ _mm512_set1_epi32( static_cast<int>( DIV_60_MUL ) ) };
+			const __m512i sixty{ _mm512_set1_epi32( constants::SECONDS_PER_MINUTE ) };
+
+			std::size_t i{ 0 };
+			for ( ; i + 16 <= count; i += 16 )
+			{
+				// Date: Neri-Schneider with multiply-shift divisions
+				const __m512i n{ _mm512_add_epi32( _mm512_loadu_si512( year + i ), marchEpoch ) };
+				const __m512i n1{ _mm512_add_epi32( _mm512_slli_epi32( n, 2 ), three ) };
+				const __m512i century{ _mm512_srli_epi32( mulhiEpu32( n1, div146097 ), DIV_146097_SHIFT ) };
+				const __m512i dayOfCentury{ _mm512_srli_epi32( _mm512_sub_epi32( n1, _mm512_mullo_epi32( century, daysPer400Years ) ), 2 ) };
+
+				const __m512i n2{ _mm512_add_epi32( _mm512_slli_epi32( dayOfCentury, 2 ), three ) };
+				const __m512i yearOfCentury{ mulhiEpu32( n2, div1461 ) };
+				const __m512i dayOfYear{ _mm512_srli_epi32( _mm512_sub_epi32( n2, _mm512_mullo_epi32( yearOfCentury, daysPer4Years ) ), 2 ) };
+
+				const __m512i n3{ _mm512_add_epi32( _mm512_mullo_epi32( dayOfYear, monthSlope ), monthOffset ) };
+				const __m512i m{ _mm512_srli_epi32( n3, 16 ) };
+				const __m512i d{ _mm512_srli_epi32( _mm512_mullo_epi32( _mm512_and_si512( n3, lowMask ), div2141 ), DIV_2141_SHIFT ) };
+
+				// January/February lanes roll over into the next Gregorian year
+				const __mmask16 isJanOrFeb{ _mm512_cmpgt_epi32_mask( dayOfYear, lastMarchDay ) };
+
+				const __m512i y{ _mm512_add_epi32( _mm512_mullo_epi32( century, hundred ), yearOfCentury ) };
+				_mm512_storeu_si512( year + i, _mm512_mask_add_epi32( y, isJanOrFeb, y, one ) );
+				_mm512_storeu_si512( month + i, _mm512_mask_sub_epi32( m, isJanOrFeb, m, twelve ) );
+				_mm512_storeu_si512( day + i, _mm512_add_epi32( d, one ) );
+
+				// Time of day
+				const __m512i secondOfDay{ _mm512_loadu_si512( hour + i ) };
+				const __m512i h{ _mm512_srli_epi32( _mm512_mullo_epi32( secondOfDay, div3600 ), DIV_3600_SHIFT ) };
+				const __m512i secondOfHour{ _mm512_sub_epi32( secondOfDay, _mm512_mullo_epi32( h, secondsPerHour ) ) };
+				const __m512i mi{ _mm512_srli_epi32( _mm512_mullo_epi32( secondOfHour, div60 ), DIV_60_SHIFT ) };
+
+				_mm512_storeu_si512( hour + i, h );
+				_mm512_storeu_si512( minute + i, mi );
+				_mm512_storeu_si512( second + i, _mm512_sub_epi32( secondOfHour, _mm512_mullo_epi32( mi, sixty ) ) );
+			}
+
+			decomposeFieldsScalar( year + i, month + i, day + i, hour + i, minute + i, second + i, count - i );
+		}
+
+		/** @brief Out-of-range lanes of x, i.e. x < lo || x > hi */
+		NFX_DATETIME_TARGET( "avx512f" ) inline __mmask16 outOfRange( __m512i x, std::int32_t lo, std::int32_t hi ) noexcept
+		{
+			return _mm512_cmplt_epi32_mask( x, _mm512_set1_epi32( lo ) ) | _mm512_cmpgt_epi32_mask( x, _mm512_set1_epi32( hi ) );
+		}
+
+		/** @brief Widen 8 unsigned 32-bit lanes and compute days * TICKS_PER_DAY + seconds * TICKS_PER_SECOND + fraction */
+		NFX_DATETIME_TARGET( "avx512f" ) inline __m512i ticksFromParts( __m256i days, __m256i seconds, __m256i fraction ) noexcept
+		{
+			const __m512i dayTicks{ _mm512_slli_epi64(
+				_mm512_mul_epu32( _mm512_cvtepu32_epi64( days ), _mm512_set1_epi64( TICKS_PER_DAY_ODD ) ), TICKS_PER_DAY_SHIFT ) };
+			const __m512i secondTicks{ _mm512_mul_epu32( _mm512_cvtepu32_epi64( seconds ), _mm512_set1_epi64( TICKS_PER_SECOND ) ) };
+
+			return _mm512_add_epi64( _mm512_add_epi64( dayTicks, secondTicks ), _mm512_cvtepu32_epi64( fraction ) );
+		}
+
+		NFX_DATETIME_TARGET( "avx512f" ) std::size_t composeChunkAvx512( const ComposeChunk& chunk, std::size_t count ) noexcept
+		{
+			const __m512i zero{ _mm512_setzero_si512() };
+			const __m512i one{ _mm512_set1_epi32( 1 ) };
+			const __m512i two{ _mm512_set1_epi32( 2 ) };
+			const __m512i three{ _mm512_set1_epi32( 3 ) };
+			const __m512i twelve{ _mm512_set1_epi32( 12 ) };
+			const __m512i twentyEight{ _mm512_set1_epi32( 28 ) };
+			const __m512i thirty{ _mm512_set1_epi32( 30 ) };
+			const __m512i hundred{ _mm512_set1_epi32( 100 ) };
+			const __m512i div100{ _mm512_set1_epi32( static_cast<int>( DIV_100_MUL ) ) };
+			const __m512i div5{ _mm512_set1_epi32( static_cast<int>( DIV_5_MUL ) ) };
+			const __m512i daysPerYear{ _mm512_set1_epi32( constants::DAYS_PER_YEAR ) };
+			const __m512i monthSlope{ _mm512_set1_epi32( 153 ) };
+			const __m512i dayBias{ _mm512_set1_epi32( COMPOSE_DAY_BIAS ) };
+			const __m512i secondsPerHour{ _mm512_set1_epi32( constants::SECONDS_PER_HOUR ) };
+			const __m512i sixty{ _mm512_set1_epi32( constants::SECONDS_PER_MINUTE ) };
+			const __m512i minTicks{ _mm512_set1_epi64( constants::MIN_DATETIME_TICKS ) };
+
+			std::size_t invalid{ 0 };
+			std::size_t i{ 0 };
+			for ( ; i + 16 <= count; i += 16 )
+			{
+				const __m512i y{ _mm512_loadu_si512( chunk.year + i ) };
+				const __m512i m{ _mm512_loadu_si512( chunk.month + i ) };
+				const __m512i d{ _mm512_loadu_si512( chunk.day + i ) };
+				const __m512i h{ _mm512_loadu_si512( chunk.hour + i ) };
+				const __m512i mi{ _mm512_loadu_si512( chunk.minute + i ) };
+				const __m512i s{ _mm512_loadu_si512( chunk.second + i ) };
+				const __m512i f{ _mm512_loadu_si512( chunk.fractionTicks + i ) };
+
+				// Range validation
+				__mmask16 bad{ outOfRange( y, constants::MIN_YEAR, constants::MAX_YEAR ) };
+				bad |= outOfRange( m, 1, 12 );
+				bad |= outOfRange( h, 0, constants::HOURS_PER_DAY - 1 );
+				bad |= outOfRange( mi, 0, constants::MINUTES_PER_HOUR - 1 );
+				bad |= outOfRange( s, 0, constants::SECONDS_PER_MINUTE - 1 );
+				bad |= outOfRange( f, 0, static_cast<std::int32_t>( TICKS_PER_SECOND - 1 ) );
+
+				// Days in month: 30/31 by month parity (flipped from August), February by leap year
+				const __m512i century{ _mm512_srli_epi32( _mm512_mullo_epi32( y, div100 ), DIV_100_SHIFT ) };
+				const __mmask16 isDiv4{ _mm512_cmpeq_epi32_mask( _mm512_and_si512( y, three ), zero ) };
+				const __mmask16 isDiv100{ _mm512_cmpeq_epi32_mask( y, _mm512_mullo_epi32( century, hundred ) ) };
+				const __mmask16 isDiv400{ static_cast<__mmask16>( isDiv100 & _mm512_cmpeq_epi32_mask( _mm512_and_si512( century, three ), zero ) ) };
+				const __mmask16 isLeap{ static_cast<__mmask16>( ( isDiv4 & ~isDiv100 ) | isDiv400 ) };
+				const __m512i longMonth{ _mm512_and_si512( _mm512_xor_si512( m, _mm512_srli_epi32( m, 3 ) ), one ) };
+				const __m512i daysInMonth{ _mm512_mask_blend_epi32( _mm512_cmpeq_epi32_mask( m, two ),
+					_mm512_add_epi32( thirty, longMonth ), _mm512_mask_add_epi32( twentyEight, isLeap, twentyEight, one ) ) };
+				bad |= _mm512_cmplt_epi32_mask( d, one ) | _mm512_cmpgt_epi32_mask( d, daysInMonth );
+
+				// Day number from a March-based year so that the leap day is last
+				const __mmask16 isJanOrFeb{ _mm512_cmplt_epi32_mask( m, three ) };
+				const __m512i marchYear{ _mm512_mask_sub_epi32( y, isJanOrFeb, y, one ) };
+				const __m512i monthFromMarch{ _mm512_sub_epi32( m, three ) };
+				const __m512i marchMonth{ _mm512_mask_add_epi32( monthFromMarch, isJanOrFeb, monthFromMarch, twelve ) };
+				const __m512i marchCentury{ _mm512_srli_epi32( _mm512_mullo_epi32( marchYear, div100 ), DIV_100_SHIFT ) };
+				const __m512i monthDays{ _mm512_srli_epi32( _mm512_mullo_epi32( _mm512_add_epi32( _mm512_mullo_epi32( marchMonth, monthSlope ), two ), div5 ), DIV_5_SHIFT ) };
+
+				__m512i days{ _mm512_mullo_epi32( marchYear, daysPerYear ) };
+				days = _mm512_add_epi32( days, _mm512_srli_epi32( marchYear, 2 ) );
+				days = _mm512_sub_epi32( days, marchCentury );
+				days = _mm512_add_epi32( days, _mm512_srli_epi32( marchCentury, 2 ) );
+				days = _mm512_add_epi32( days, monthDays );
+				days = _mm512_sub_epi32( _mm512_add_epi32( days, d ), dayBias );
+
+				const __m512i seconds{ _mm512_add_epi32(
+					_mm512_add_epi32( _mm512_mullo_epi32( h, secondsPerHour ), _mm512_mullo_epi32( mi, sixty ) ), s ) };
+
+				// Widen to 64-bit ticks; invalid rows collapse to MIN_DATETIME_TICKS
+				const __m512i ticksLo{ _mm512_mask_blend_epi64( static_cast<__mmask8>( bad ),
+					ticksFromParts( _mm512_castsi512_si256( days ), _mm512_castsi512_si256( seconds ), _mm512_castsi512_si256( f ) ), minTicks ) };
+				const __m512i ticksHi{ _mm512_mask_blend_epi64( static_cast<__mmask8>( bad >> 8 ),
+					ticksFromParts( _mm512_extracti64x4_epi64( days, 1 ), _mm512_extracti64x4_epi64( seconds, 1 ), _mm512_extracti64x4_epi64( f, 1 ) ), minTicks ) };
+				_mm512_storeu_si512( chunk.ticks + i, ticksLo );
+				_mm512_storeu_si512( chunk.ticks + i + 8, ticksHi );
+
+				chunk.invalidWords[i >> 6] |= std::uint64_t{ bad } << ( i & 63 );
+				invalid += static_cast<std::size_t>( std::popcount( static_cast<std::uint32_t>( bad ) ) );
+			}
+
+			return invalid + composeChunkScalar( chunk, i, count );
+		}
+#endif
+
+		//=====================================================================
+		// Kernel dispatch
+		//=====================================================================
+
+		/** @brief Decompose one chunk of values into its field columns with the kernel for the given level */
+		void decomposeChunk( SimdLevel level, const DateTime* values, std::size_t count, const DecomposeChunk& chunk ) noexcept
+		{
+#if NFX_DATETIME_X86_64
+			if ( level != SimdLevel::Scalar )
+			{
+				// 64-bit pre-pass: day number into the year column, second of day into the hour column
+				for ( std::size_t i{ 0 }; i < count; ++i )
+				{
+					splitTicks( values[i].ticks(), chunk.year[i], chunk.hour[i], chunk.fractionTicks[i] );
+				}
+
+				if ( level == SimdLevel::Avx512 )
+				{
+					decomposeFieldsAvx512( chunk.year, chunk.month, chunk.day, chunk.hour, chunk.minute, chunk.second, count );
+				}
+				else
+				{
+					decomposeFieldsAvx2( chunk.year, chunk.month, chunk.day, chunk.hour, chunk.minute, chunk.second, count );
+				}
+
+				return;
+			}
+#else
+			static_cast<void>( level );
+#endif
+
+			decomposeChunkScalar( values, count, chunk );
+		}
+
+		/** @brief Replace a decomposed chunk's fields by ASCII digits with the kernel for the given level */
+		void asciiDigitsChunk( SimdLevel level, const DecomposeChunk& chunk, std::size_t count ) noexcept
+		{
+#if NFX_DATETIME_X86_64
+			if ( level != SimdLevel::Scalar )
+			{
+				asciiDigitsAvx2( chunk, count );
+
+				return;
+			}
+#else
+			static_cast<void>( level );
+#endif
+
+			asciiDigitsScalar( chunk, 0, count );
+		}
+
+		/** @brief Compose one chunk with the kernel for the given level; returns the number of invalid rows */
+		std::size_t composeChunk( SimdLevel level, const ComposeChunk& chunk, std::size_t count ) noexcept
+		{
+			switch ( level )
+			{
+#if NFX_DATETIME_X86_64
+				case SimdLevel::Avx512:
+				{
+					return composeChunkAvx512( chunk, count );
+				}
+				case SimdLevel::Avx2:
+				{
+					return composeChunkAvx2( chunk, count );
+				}
+#endif
+				default:
+				{
+					return composeChunkScalar( chunk, 0, count );
+				}
+			}
+		}
+
+		/**
+		 * @brief Parse rows [begin, begin + count) into the scratch ticks and offset columns
+		 * @param rows The chunk's rows
+		 * @param chunk Scratch columns; ticks and offsetMinutes hold the results
+		 * @param invalidWords Error bitmap words of the chunk (already cleared)
+		 * @param withOffset Parse as DateTimeOffset rather than DateTime for fallback rows
+		 * @return Number of invalid rows
+		 */
+		std::size_t parseChunk( SimdLevel level, const std::string_view* rows, std::size_t count, ParseChunk& chunk,
+			std::uint64_t* invalidWords, bool withOffset ) noexcept
+		{
+			chunk.fallbackWords.fill( 0 );
+
+#if NFX_DATETIME_X86_64
+			if ( level != SimdLevel::Scalar )
+			{
+				extractChunkAvx2( rows, chunk, count );
+			}
+			else
+#endif
+			{
+				extractChunkScalar( rows, chunk, 0, count );
+			}
+
+			const ComposeChunk compose{
+				chunk.year.data(),
+				chunk.month.data(),
+				chunk.day.data(),
+				chunk.hour.data(),
+				chunk.minute.data(),
+				chunk.second.data(),
+				chunk.fractionTicks.data(),
+				chunk.ticks.data(),
+				invalidWords };
+			std::size_t invalid{ composeChunk( level, compose, count ) };
+
+			// Everything the canonical shape check rejected goes through the general parser
+			for ( std::size_t word{ 0 }; word < chunk.fallbackWords.size(); ++word )
+			{
+				for ( auto bits{ chunk.fallbackWords[word] }; bits != 0; bits &= bits - 1 )
+				{
+					const std::size_t i{ word * 64 + static_cast<std::size_t>( std::countr_zero( bits ) ) };
+					std::int64_t offsetTicks{ 0 };
+					const bool parsed{ withOffset ? internal::parseDateTimeOffset( rows[i], chunk.ticks[i], offsetTicks )
+												  : internal::parseDateTime( rows[i], chunk.ticks[i] ) };
+					if ( !parsed )
+					{
+						chunk.ticks[i] = constants::MIN_DATETIME_TICKS;
+						invalidWords[i >> 6] |= std::uint64_t{ 1 } << ( i & 63 );
+						++invalid;
+
+						continue;
+					}
+
+					chunk.offsetMinutes[i] = static_cast<std::int32_t>( offsetTicks / constants::TICKS_PER_MINUTE );
+				}
+			}
+
+			return invalid;
+		}
+
+		/** @brief View of row i of an offsets-plus-data column; malformed offsets yield an unparseable empty row */
+		inline std::string_view rowAt( const StringColumn& column, std::size_t i ) noexcept
+		{
+			const auto begin{ column.offsets[i] };
+			const auto end{ column.offsets[i + 1] };
+			if ( begin < 0 || end < begin || static_cast<std::size_t>( end ) > column.data.size() )
+			{
+				return {};
+			}
+
+			return { column.data.data() + begin, static_cast<std::size_t>( end - begin ) };
+		}
+
+		/** @brief Parse every row, chunk by chunk, and hand each chunk's results to store( begin, count, chunk ) */
+		template <typename Rows, typename Store>
+		std::size_t parseRows( const Rows& rows, std::size_t rowCount, ErrorBitmap& invalidRows, bool withOffset, Store&& store )
+		{
+			invalidRows.reset( rowCount );
+
+			const auto level{ simdLevel() };
+			ParseChunk chunk;
+			std::array<std::string_view, PARSE_CHUNK_ROWS> views;
+			std::size_t invalid{ 0 };
+
+			for ( std::size_t begin{ 0 }; begin < rowCount; begin += PARSE_CHUNK_ROWS )
+			{
+				const auto count{ std::min( PARSE_CHUNK_ROWS, rowCount - begin ) };
+				const std::string_view* chunkRows;
+				if constexpr ( std::is_same_v<Rows, StringColumn> )
+				{
+					for ( std::size_t i{ 0 }; i < count; ++i )
+					{
+						views[i] = rowAt( rows, begin + i );
+					}
+					chunkRows = views.data();
+				}
+				else
+				{
+					chunkRows = rows.data() + begin;
+				}
+
+				invalid += parseChunk( level, chunkRows, count, chunk, invalidRows.words().data() + begin / 64, withOffset );
+				store( begin, count, chunk );
+			}
+
+			return invalid;
+		}
+
+		/** @brief Copy a parsed chunk into DateTime output */
+		inline auto dateTimeStore( std::span<DateTime> out ) noexcept
+		{
+			return [out]( std::size_t begin, std::size_t count, const ParseChunk& chunk ) {
+				for ( std::size_t i{ 0 }; i < count; ++i )
+				{
+					out[begin + i] = DateTime{ chunk.ticks[i] };
+				}
+			};
+		}
+
+		/** @brief Copy a parsed chunk into DateTimeOffset output; invalid rows become DateTimeOffset{} */
+		inline auto dateTimeOffsetStore( std::span<DateTimeOffset> out, const ErrorBitmap& invalidRows ) noexcept
+		{
+			return [out, &invalidRows]( std::size_t begin, std::size_t count, const ParseChunk& chunk ) {
+				for ( std::size_t i{ 0 }; i < count; ++i )
+				{
+					out[begin + i] = invalidRows.test( begin + i )
+										 ? DateTimeOffset{}
+										 : DateTimeOffset{ chunk.ticks[i], TimeSpan{ chunk.offsetMinutes[i] * constants::TICKS_PER_MINUTE } };
+				}
+			};
+		}
+
+		/** @brief Throw unless an input of the given length matches the output */
+		inline void requireRows( std::size_t inputRows, std::size_t outputRows )
+		{
+			if ( inputRows != outputRows )
+			{
+				throw std::invalid_argument{ "Batch string column length does not match output length" };
+			}
+		}
+		//=====================================================================
+		// Row writers
+		//=====================================================================
+
+		/** @brief Longest row written for a format */
+		constexpr std::size_t maxRowLength( DateTime::Format format ) noexcept
+		{
+			switch ( format )
+			{
+				case DateTime::Format::Iso8601Basic:
+				{
+					return 20;
+				}
+				case DateTime::Format::Iso8601Extended:
+				{
+					return 28;
+				}
+				case DateTime::Format::Iso8601WithOffset:
+				{
+					return 25;
+				}
+				case DateTime::Format::DateOnly:
+				{
+					return 10;
+				}
+				case DateTime::Format::TimeOnly:
+				{
+					return 8;
+				}
+				default:
+				{
+					return 20;
+				}
+			}
+		}
+
+		inline void storeWord( char* out, std::uint64_t word ) noexcept
+		{
+			std::memcpy( out, &word, sizeof( word ) );
+		}
+
+		inline void storeWord( char* out, std::uint32_t word ) noexcept
+		{
+			std::memcpy( out, &word, sizeof( word ) );
+		}
+
+		/**
+		 * @brief Write the rows of a chunk whose fields hold ASCII digits (little-endian only)
+		 * @param chunk Field columns after asciiDigitsChunk()
+		 * @param format Calendar format
+		 * @param out Output position with room for count rows of maxRowLength( format )
+		 * @param ends Receives the end of every row, relative to offset
+		 * @param offset Buffer position of out
+		 * @return Output position after the last row
+		 */
+		char* writeDigitRows( const DecomposeChunk& chunk, std::size_t count, DateTime::Format format, char* out,
+			std::int64_t* ends, std::int64_t offset ) noexcept
+		{
+			const auto field{ []( const std::int32_t* column, std::size_t i ) noexcept {
+				return static_cast<std::uint64_t>( static_cast<std::uint32_t>( column[i] ) );
+			} };
+			// "YYYY-MM-" and "DDTHH:MM"
+			const auto dateWord{ [&]( std::size_t i ) noexcept {
+				return field( chunk.year, i ) | std::uint64_t{ '-' } << 32 | field( chunk.month, i ) << 40 | std::uint64_t{ '-' } << 56;
+			} };
+			const auto dayTimeWord{ [&]( std::size_t i ) noexcept {
+				return field( chunk.day, i ) | std::uint64_t{ 'T' } << 16 | field( chunk.hour, i ) << 24 | std::uint64_t{ ':' } << 40 |
+					   field( chunk.minute, i ) << 48;
+			} };
+			// ":SS" followed by one more byte
+			const auto secondWord{ [&]( std::size_t i, char next ) noexcept {
+				return static_cast<std::uint32_t>( ':' | field( chunk.second, i ) << 8 | static_cast<std::uint64_t>( next ) << 24 );
+			} };
+
+			char* const base{ out };
+			const auto finishRow{ [&]( std::size_t i ) noexcept { ends[i] = offset + ( out - base ); } };
+
+			switch ( format )
+			{
+				case DateTime::Format::Iso8601Extended:
+				{
+					for ( std::size_t i{ 0 }; i < count; ++i )
+					{
+						storeWord( out, dateWord( i ) );
+						storeWord( out + 8, dayTimeWord( i ) );
+						storeWord( out + 16, secondWord( i, '\0' ) );
+						out = internal::writeTrimmedFraction( out + 19, chunk.fractionTicks[i] );
+						*out++ = 'Z';
+						finishRow( i );
+					}
+
+					break;
+				}
+				case DateTime::Format::Iso8601WithOffset:
+				{
+					for ( std::size_t i{ 0 }; i < count; ++i )
+					{
+						storeWord( out, dateWord( i ) );
+						storeWord( out + 8, dayTimeWord( i ) );
+						storeWord( out + 16, secondWord( i, '+' ) );
+						std::memcpy( out + 20, "00:00", 5 );
+						out += 25;
+						finishRow( i );
+					}
+
+					break;
+				}
+				case DateTime::Format::DateOnly:
+				{
+					for ( std::size_t i{ 0 }; i < count; ++i )
+					{
+						storeWord( out, dateWord( i ) );
+						std::memcpy( out + 8, chunk.day + i, 2 );
+						out += 10;
+						finishRow( i );
+					}
+
+					break;
+				}
+				case DateTime::Format::TimeOnly:
+				{
+					for ( std::size_t i{ 0 }; i < count; ++i )
+					{
+						storeWord( out, field( chunk.hour, i ) | std::uint64_t{ ':' } << 16 | field( chunk.minute, i ) << 24 |
+											std::uint64_t{ ':' } << 40 | field( chunk.second, i ) << 48 );
+						out += 8;
+						finishRow( i );
+					}
+
+					break;
+				}
+				default:
+				{
+					for ( std::size_t i{ 0 }; i < count; ++i )
+					{
+						storeWord( out, dateWord( i ) );
+						storeWord( out + 8, dayTimeWord( i ) );
+						storeWord( out + 16, secondWord( i, 'Z' ) );
+						out += 20;
+						finishRow( i );
+					}
+
+					break;
+				}
+			}
+
+			return out;
+		}
+	} // namespace
+
+	//=====================================================================
+	// SIMD dispatch
+	//=====================================================================
+
+	SimdLevel supportedSimdLevel() noexcept
+	{
+		static const SimdLevel supported{ detectSimdLevel() };
+
+		return supported;
+	}
+
+	SimdLevel simdLevel() noexcept
+	{
+		return activeSimdLevel().load( std::memory_order_relaxed );
+	}
+
+	SimdLevel setSimdLevel( SimdLevel level ) noexcept
+	{
+		const auto effective{ std::min( level, supportedSimdLevel() ) };
+		activeSimdLevel().store( effective, std::memory_order_relaxed );
+
+		return effective;
+	}
+
+	//=====================================================================
+	// Decomposition
+	//=====================================================================
+
+	void DecomposedColumns::resize( std::size_t rows )
+	{
+		year.resize( rows );
+		month.resize( rows );
+		day.resize( rows );
+		hour.resize( rows );
+		minute.resize( rows );
+		second.resize( rows );
+		fractionTicks.resize( rows );
+	}
+
+	std::size_t DecomposedColumns::size() const noexcept
+	{
+		return year.size();
+	}
+
+	void decompose( std::span<const DateTime> values, DecomposedColumns& columns )
+	{
+		columns.resize( values.size() );
+
+		const auto level{ simdLevel() };
+		for ( std::size_t begin{ 0 }; begin < values.size(); begin += CHUNK_ROWS )
+		{
+			const DecomposeChunk chunk{
+				columns.year.data() + begin,
+				columns.month.data() + begin,
+				columns.day.data() + begin,
+				columns.hour.data() + begin,
+				columns.minute.data() + begin,
+				columns.second.data() + begin,
+				columns.fractionTicks.data() + begin };
+
+			decomposeChunk( level, values.data() + begin, std::min( CHUNK_ROWS, values.size() - begin ), chunk );
+		}
+	}
+
+	//=====================================================================
+	// Composition
+	//=====================================================================
+
+	std::size_t compose( const ComponentColumns& columns, std::span<DateTime> out, ErrorBitmap& invalidRows )
+	{
+		const auto rows{ out.size() };
+		const auto isRequiredLength{ [rows]( std::span<const std::int32_t> column ) { return column.size() == rows; } };
+		const auto isOptionalLength{ [rows]( std::span<const std::int32_t> column ) { return column.empty() || column.size() == rows; } };
+		if ( !isRequiredLength( columns.year ) || !isRequiredLength( columns.month ) || !isRequiredLength( columns.day ) ||
+			 !isOptionalLength( columns.hour ) || !isOptionalLength( columns.minute ) || !isOptionalLength( columns.second ) ||
+			 !isOptionalLength( columns.fractionTicks ) )
+		{
+			throw std::invalid_argument{ "Batch component column length does not match output length" };
+		}
+
+		invalidRows.reset( rows );
+
+		const auto level{ simdLevel() };
+		std::array<std::int64_t, CHUNK_ROWS> ticks;
+		std::size_t invalid{ 0 };
+
+		for ( std::size_t begin{ 0 }; begin < rows; begin += CHUNK_ROWS )
+		{
+			const auto count{ std::min( CHUNK_ROWS, rows - begin ) };
+			const auto columnAt{ [begin]( std::span<const std::int32_t> column ) {
+				return column.empty() ? ZERO_COLUMN.data() : column.data() + begin;
+			} };
+
+			const ComposeChunk chunk{
+				columns.year.data() + begin,
+				columns.month.data() + begin,
+				columns.day.data() + begin,
+				columnAt( columns.hour ),
+				columnAt( columns.minute ),
+				columnAt( columns.second ),
+				columnAt( columns.fractionTicks ),
+				ticks.data(),
+				invalidRows.words().data() + begin / 64 };
+
+			invalid += composeChunk( level, chunk, count );
+
+			for ( std::size_t i{ 0 }; i < count; ++i )
+			{
+				out[begin + i] = DateTime{ ticks[i] };
+			}
+		}
+
+		return invalid;
+	}
+
+	//=====================================================================
+	// Parsing
+	//=====================================================================
+
+	std::size_t parse( std::span<const std::string_view> strings, std::span<DateTime> out, ErrorBitmap& invalidRows )
+	{
+		requireRows( strings.size(), out.size() );
+
+		return parseRows( strings, out.size(), invalidRows, false, dateTimeStore( out ) );
+	}
+
+	std::size_t parse( const StringColumn& strings, std::span<DateTime> out, ErrorBitmap& invalidRows )
+	{
+		requireRows( strings.size(), out.size() );
+
+		return parseRows( strings, out.size(), invalidRows, false, dateTimeStore( out ) );
+	}
+
+	std::size_t parse( std::span<const std::string_view> strings, std::span<DateTimeOffset> out, ErrorBitmap& invalidRows )
+	{
+		requireRows( strings.size(), out.size() );
+
+		return parseRows( strings, out.size(), invalidRows, true, dateTimeOffsetStore( out, invalidRows ) );
+	}
+
+	std::size_t parse( const StringColumn& strings, std::span<DateTimeOffset> out, ErrorBitmap& invalidRows )
+	{
+		requireRows( strings.size(), out.size() );
+
+		return parseRows( strings, out.size(), invalidRows, true, dateTimeOffsetStore( out, invalidRows ) );
+	}
+
+	//=====================================================================
+	// Formatting
+	//=====================================================================
+
+	void format( std::span<const DateTime> values, DateTime::Format format, OutputBuffer& out )
+	{
+		const bool isEpochFormat{ format == DateTime::Format::UnixSeconds || format == DateTime::Format::UnixMilliseconds };
+		const auto level{ simdLevel() };
+		FormatChunk chunk;
+		const DecomposeChunk columns{
+			chunk.year.data(),
+			chunk.month.data(),
+			chunk.day.data(),
+			chunk.hour.data(),
+			chunk.minute.data(),
+			chunk.second.data(),
+			chunk.fractionTicks.data() };
+
+		auto& offsets{ out.m_offsets };
+		auto& data{ out.m_data };
+		std::size_t row{ offsets.size() };
+		offsets.resize( row + values.size() );
+
+		for ( std::size_t begin{ 0 }; begin < values.size(); begin += FORMAT_CHUNK_ROWS )
+		{
+			const auto count{ std::min( FORMAT_CHUNK_ROWS, values.size() - begin ) };
+			const DateTime* const chunkValues{ values.data() + begin };
+
+			// Room for the longest row of the format, trimmed to the bytes written below
+			const auto start{ data.size() };
+			data.resize( start + count * maxRowLength( format ) );
+			char* const base{ data.data() + start };
+			char* ptr{ base };
+
+			if ( isEpochFormat )
+			{
+				for ( std::size_t i{ 0 }; i < count; ++i )
+				{
+					ptr = internal::writeInteger( ptr, format == DateTime::Format::UnixSeconds ? chunkValues[i].toEpochSeconds()
+																							   : chunkValues[i].toEpochMilliseconds() );
+					offsets[row++] = static_cast<std::int64_t>( start + static_cast<std::size_t>( ptr - base ) );
+				}
+			}
+			else if constexpr ( std::endian::native == std::endian::little )
+			{
+				decomposeChunk( level, chunkValues, count, columns );
+				asciiDigitsChunk( level, columns, count );
+				ptr = writeDigitRows( columns, count, format, base, offsets.data() + row, static_cast<std::int64_t>( start ) );
+				row += count;
+			}
+			else
+			{
+				decomposeChunk( level, chunkValues, count, columns );
+				for ( std::size_t i{ 0 }; i < count; ++i )
+				{
+					const DateTime::Components c{
+						chunk.year[i], chunk.month[i], chunk.day[i], chunk.hour[i], chunk.minute[i], chunk.second[i], chunk.fractionTicks[i], 0, 0 };
+					ptr = internal::writeCalendarFormat( ptr, c, format );
+					offsets[row++] = static_cast<std::int64_t>( start + static_cast<std::size_t>( ptr - base ) );
+				}
+			}
+
+			data.resize( start + static_cast<std::size_t>( ptr - base ) );
+		}
+	}
+} // namespace nfx::time::batch
@@ -0,0 +1,129 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CachedClock.cpp
+ * @brief Implementation of the background-updated clock service
+ */
+
+#include <algorithm>
+#include <chrono>
+
+#include "nfx/datetime/CachedClock.h"
+
+namespace nfx::time
+{
+	//=====================================================================
+	// CachedClock class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	CachedClock::CachedClock( TimeSpan period ) noexcept
+		: m_periodTicks{ period.ticks() > 0 ? std::max( period.ticks(), MIN_PERIOD_TICKS ) : DEFAULT_PERIOD_TICKS }
+	{
+	}
+
+	CachedClock::~CachedClock()
+	{
+		stop();
+	}
+
+	//----------------------------------------------
+	// Lifecycle
+	//----------------------------------------------
+
+	void CachedClock::start()
+	{
+		std::lock_guard lifecycle{ m_lifecycle };
+		if ( m_thread.joinable() )
+		{
+			return;
+		}
+
+		{
+			std::lock_guard lock{ m_mutex };
+			m_stopRequested = false;
+		}
+
+		// Readers see a fresh value as soon as start() returns, not one period later
+		m_ticks.store( DateTime::utcNow().ticks(), std::memory_order_relaxed );
+		try
+		{
+			m_thread = std::thread{ [this] { run(); } };
+		}
+		catch ( ... )
+		{
+			m_ticks.store( 0, std::memory_order_relaxed );
+			throw;
+		}
+	}
+
+	void CachedClock::stop() noexcept
+	{
+		std::lock_guard lifecycle{ m_lifecycle };
+		if ( !m_thread.joinable() )
+		{
+			return;
+		}
+
+		{
+			std::lock_guard lock{ m_mutex };
+			m_stopRequested = true;
+		}
+		m_wakeup.notify_one();
+		m_thread.join();
+
+		m_ticks.store( 0, std::memory_order_relaxed );
+	}
+
+	//----------------------------------------------
+	// Implementation
+	//----------------------------------------------
+
+	void CachedClock::run() noexcept
+	{
+		using Ticks = std::chrono::duration<std::int64_t, std::ratio<1, constants::TICKS_PER_SECOND>>;
+		const auto period{ std::chrono::duration_cast<std::chrono::steady_clock::duration>( Ticks{ m_periodTicks } ) };
+
+		std::unique_lock lock{ m_mutex };
+		auto next{ std::chrono::steady_clock::now() };
+		while ( !m_stopRequested )
+		{
+			m_ticks.store( DateTime::utcNow().ticks(), std::memory_order_relaxed );
+
+			// Keep a fixed cadence, but after a long stall resume from now instead of catching up
+			next += period;
+			const auto current{ std::chrono::steady_clock::now() };
+			if ( next < current )
+			{
+				next = current + period;
+			}
+
+			m_wakeup.wait_until( lock, next, [this] { return m_stopRequested; } );
+		}
+	}
+} // namespace nfx::time
@@ -0,0 +1,293 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Calendar.h
+ * @brief Internal Gregorian calendar arithmetic shared across nfx-datetime implementation
+ * @details Provides tick/component conversions and the optional precomputed day lookup
+ *          table used for the hot date window selected at build time (see
+ *          NFX_DATETIME_ENABLE_DAY_TABLE). Day numbers and component validation come from the
+ *          constexpr helpers in nfx/detail/datetime/Iso8601.h. Not part of the public API.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#include "nfx/datetime/DateTime.h"
+#include "nfx/detail/datetime/Constants.h"
+#include "nfx/detail/datetime/Iso8601.h"
+
+namespace nfx::time::internal
+{
+	//=====================================================================
+	// Calendar arithmetic
+	//=====================================================================
+
+	//----------------------------------------------
+	// Calendar tables
+	//----------------------------------------------
+
+	/**
+	 * @brief Days between the computational epoch (March 1, year 0) and January 1, 0001
+	 * @details The Euclidean-affine algorithms below count years from March so that the
+	 *          leap day falls at the end of the computational year.
+	 */
+	inline constexpr std::uint32_t DAYS_FROM_MARCH_EPOCH{ 306 };
+
+	//----------------------------------------------
+	// Day number conversions
+	//----------------------------------------------
+
+	/** @brief Convert a day number (days since January 1, 0001) to date components */
+	inline constexpr void dateComponentsFromDays( std::int64_t days, std::int32_t& year, std::int32_t& month, std::int32_t& day ) noexcept
+	{
+		// Neri-Schneider Euclidean-affine decomposition: branch-free, constant time,
+		// exact for every day in [0001-01-01, 9999-12-31]
+		const auto n{ static_cast<std::uint32_t>( days ) + DAYS_FROM_MARCH_EPOCH };
+
+		// Century and day of century
+		const std::uint32_t n1{ 4 * n + 3 };
+		const std::uint32_t century{ n1 / static_cast<std::uint32_t>( constants::DAYS_PER_400_YEARS ) };
+		const std::uint32_t dayOfCentury{ n1 % static_cast<std::uint32_t>( constants::DAYS_PER_400_YEARS ) / 4 };
+
+		// Year of century and day of (March-based) year
+		const std::uint32_t n2{ 4 * dayOfCentury + 3 };
+		const std::uint64_t p2{ 2939745ULL * n2 };
+		const auto yearOfCentury{ static_cast<std::uint32_t>( p2 >> 32 ) };
+		const std::uint32_t dayOfYear{ static_cast<std::uint32_t>( p2 ) / 2939745 / 4 };
+
+		// Month and day of (March-based) month
+		const std::uint32_t n3{ 2141 * dayOfYear + 197913 };
+		const std::uint32_t m{ n3 >> 16 };
+		const std::uint32_t d{ ( n3 & 0xFFFF ) / 2141 };
+
+		// Map January and February back onto the following Gregorian year
+		const std::uint32_t isJanOrFeb{ dayOfYear >= DAYS_FROM_MARCH_EPOCH };
+
+		year = static_cast<std::int32_t>( 100 * century + yearOfCentury + isJanOrFeb );
+		month = static_cast<std::int32_t>( isJanOrFeb ? m - 12 : m );
+		day = static_cast<std::int32_t>( d + 1 );
+	}
+
+	//=====================================================================
+	// Day lookup table
+	//=====================================================================
+
+#if defined( NFX_DATETIME_DAY_TABLE ) && NFX_DATETIME_DAY_TABLE
+	/** @brief Whether the precomputed day lookup table is compiled in */
+	inline constexpr bool DAY_TABLE_ENABLED{ true };
+
+	/** @brief First year covered by the day lookup table */
+	inline constexpr std::int32_t DAY_TABLE_FIRST_YEAR{ NFX_DATETIME_DAY_TABLE_FIRST_YEAR };
+
+	/** @brief Last year covered by the day lookup table */
+	inline constexpr std::int32_t DAY_TABLE_LAST_YEAR{ NFX_DATETIME_DAY_TABLE_LAST_YEAR };
+#else
+	/** @brief Whether the precomputed day lookup table is compiled in */
+	inline constexpr bool DAY_TABLE_ENABLED{ false };
+
+	/** @brief First year covered by the day lookup table (empty window) */
+	inline constexpr std::int32_t DAY_TABLE_FIRST_YEAR{ 1 };
+
+	/** @brief Last year covered by the day lookup table (empty window) */
+	inline constexpr std::int32_t DAY_TABLE_LAST_YEAR{ 0 };
+#endif
+
+	static_assert( !DAY_TABLE_ENABLED || ( DAY_TABLE_FIRST_YEAR >= constants::MIN_YEAR && DAY_TABLE_LAST_YEAR <= constants::MAX_YEAR ),
+		"Day table window must lie within the DateTime year range" );
+	static_assert( DAY_TABLE_LAST_YEAR - DAY_TABLE_FIRST_YEAR < 256,
+		"Day table window is limited to 256 years (8-bit packed year offset)" );
+
+	/** @brief Number of years covered by the day lookup table */
+	inline constexpr std::uint32_t DAY_TABLE_YEAR_COUNT{ static_cast<std::uint32_t>( DAY_TABLE_LAST_YEAR - DAY_TABLE_FIRST_YEAR + 1 ) };
+
+	/** @brief Day number of the first table entry */
+	inline constexpr std::int64_t DAY_TABLE_FIRST_DAY{ daysBeforeYear( DAY_TABLE_FIRST_YEAR ) };
+
+	/** @brief Number of days covered by the day lookup table */
+	inline constexpr std::uint64_t DAY_TABLE_DAY_COUNT{
+		static_cast<std::uint64_t>( daysBeforeYear( DAY_TABLE_LAST_YEAR + 1 ) - DAY_TABLE_FIRST_DAY ) };
+
+	/**
+	 * @brief log2 of the number of entries per table block
+	 * @details The table is generated in fixed-size blocks so that each block is a separate
+	 *          constant evaluation, keeping every compiler well under its constexpr step limit.
+	 */
+	inline constexpr std::uint32_t DAY_TABLE_BLOCK_SHIFT{ 10 };
+
+	/** @brief Number of entries per table block */
+	inline constexpr std::uint32_t DAY_TABLE_BLOCK_SIZE{ 1U << DAY_TABLE_BLOCK_SHIFT };
+
+	/** @brief Number of blocks making up the table */
+	inline constexpr std::size_t DAY_TABLE_BLOCK_COUNT{ ( DAY_TABLE_DAY_COUNT + DAY_TABLE_BLOCK_SIZE - 1 ) / DAY_TABLE_BLOCK_SIZE };
+
+	//----------------------------------------------
+	// Packed entry layout
+	//----------------------------------------------
+
+	/*
+		 31   29 28   26 25        17 16         9 8      5 4      0
+		┌───────┬───────┬────────────┬────────────┬────────┬────────┐
+		│ spare │  dow  │ dayOfYear  │ yearOffset │ month  │  day   │
+		└───────┴───────┴────────────┴────────────┴────────┴────────┘
+
+		An entry is never zero (day >= 1), so zero marks a table miss.
+	*/
+
+	/** @brief Pack date fields into a day table entry */
+	inline constexpr std::uint32_t packDayTableEntry( std::int32_t year, std::int32_t month, std::int32_t day,
+		std::int32_t dayOfYear, std::int32_t dayOfWeek ) noexcept
+	{
+		return static_cast<std::uint32_t>( day ) |
+			   static_cast<std::uint32_t>( month ) << 5 |
+			   static_cast<std::uint32_t>( year - DAY_TABLE_FIRST_YEAR ) << 9 |
+			   static_cast<std::uint32_t>( dayOfYear ) << 17 |
+			   static_cast<std::uint32_t>( dayOfWeek ) << 26;
+	}
+
+	/**
+	 * @brief Day table blocks, each holding DAY_TABLE_BLOCK_SIZE packed entries
+	 * @details Defined in DayTable.cpp; empty when the table is disabled.
+	 */
+	extern const std::array<const std::uint32_t*, DAY_TABLE_BLOCK_COUNT> DAY_TABLE_BLOCKS;
+
+	/** @brief Per-year table of (first day number << 1) | isLeapYear for the table window */
+	inline constexpr auto DAY_TABLE_YEAR_STARTS{ []() {
+		std::array<std::uint32_t, DAY_TABLE_YEAR_COUNT> starts{};
+		for ( std::uint32_t i{ 0 }; i < DAY_TABLE_YEAR_COUNT; ++i )
+		{
+			const auto year{ DAY_TABLE_FIRST_YEAR + static_cast<std::int32_t>( i ) };
+			starts[i] = static_cast<std::uint32_t>( daysBeforeYear( year ) ) << 1 | ( DateTime::isLeapYear( year ) ? 1U : 0U );
+		}
+
+		return starts;
+	}() };
+
+	/** @brief Look up the packed entry for a day number, or 0 when it lies outside the table window */
+	inline std::uint32_t dayTableEntry( std::int64_t days ) noexcept
+	{
+		const auto index{ static_cast<std::uint64_t>( days - DAY_TABLE_FIRST_DAY ) };
+		if ( index >= DAY_TABLE_DAY_COUNT )
+		{
+			return 0;
+		}
+
+		return DAY_TABLE_BLOCKS[index >> DAY_TABLE_BLOCK_SHIFT][index & ( DAY_TABLE_BLOCK_SIZE - 1 )];
+	}
+
+	//=====================================================================
+	// Tick conversions
+	//=====================================================================
+
+	/** @brief Convert ticks to date components, day of year and day of week */
+	inline constexpr void dateComponentsFromTicks( std::int64_t ticks, std::int32_t& year, std::int32_t& month, std::int32_t& day,
+		std::int32_t& dayOfYear, std::int32_t& dayOfWeek ) noexcept
+	{
+		const std::int64_t days{ ticks / constants::TICKS_PER_DAY };
+
+		if constexpr ( DAY_TABLE_ENABLED )
+		{
+			if ( !std::is_constant_evaluated() )
+			{
+				if ( const auto entry{ dayTableEntry( days ) }; entry != 0 )
+				{
+					day = static_cast<std::int32_t>( entry & 0x1F );
+					month = static_cast<std::int32_t>( ( entry >> 5 ) & 0xF );
+					year = DAY_TABLE_FIRST_YEAR + static_cast<std::int32_t>( ( entry >> 9 ) & 0xFF );
+					dayOfYear = static_cast<std::int32_t>( ( entry >> 17 ) & 0x1FF );
+					dayOfWeek = static_cast<std::int32_t>( entry >> 26 );
+
+					return;
+				}
+			}
+		}
+
+		dateComponentsFromDays( days, year, month, day );
+		dayOfYear = DAYS_BEFORE_MONTH[DateTime::isLeapYear( year )][month - 1] + day;
+
+		// January 1, 0001 was a Monday (0=Sunday, 6=Saturday)
+		dayOfWeek = static_cast<std::int32_t>( ( days + 1 ) % 7 );
+	}
+
+	/** @brief Convert ticks to date components */
+	inline constexpr void dateComponentsFromTicks( std::int64_t ticks, std::int32_t& year, std::int32_t& month, std::int32_t& day ) noexcept
+	{
+		const std::int64_t days{ ticks / constants::TICKS_PER_DAY };
+
+		if constexpr ( DAY_TABLE_ENABLED )
+		{
+			if ( !std::is_constant_evaluated() )
+			{
+				if ( const auto entry{ dayTableEntry( days ) }; entry != 0 )
+				{
+					day = static_cast<std::int32_t>( entry & 0x1F );
+					month = static_cast<std::int32_t>( ( entry >> 5 ) & 0xF );
+					year = DAY_TABLE_FIRST_YEAR + static_cast<std::int32_t>( ( entry >> 9 ) & 0xFF );
+
+					return;
+				}
+			}
+		}
+
+		dateComponentsFromDays( days, year, month, day );
+	}
+
+	/** @brief Convert ticks to time components */
+	inline constexpr void timeComponentsFromTicks( std::int64_t ticks, std::int32_t& hour, std::int32_t& minute, std::int32_t& second, std::int32_t& millisecond ) noexcept
+	{
+		std::int64_t timeTicks{ ticks % constants::TICKS_PER_DAY };
+
+		hour = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_HOUR );
+		timeTicks %= constants::TICKS_PER_HOUR;
+
+		minute = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_MINUTE );
+		timeTicks %= constants::TICKS_PER_MINUTE;
+
+		second = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_SECOND );
+		timeTicks %= constants::TICKS_PER_SECOND;
+
+		millisecond = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_MILLISECOND );
+	}
+
+	/** @brief Convert date components to ticks */
+	inline constexpr std::int64_t dateToTicks( std::int32_t year, std::int32_t month, std::int32_t day ) noexcept
+	{
+		if constexpr ( DAY_TABLE_ENABLED )
+		{
+			const auto index{ static_cast<std::uint32_t>( year - DAY_TABLE_FIRST_YEAR ) };
+			if ( index < DAY_TABLE_YEAR_COUNT )
+			{
+				const auto start{ DAY_TABLE_YEAR_STARTS[index] };
+				const std::int64_t totalDays{ ( start >> 1 ) + DAYS_BEFORE_MONTH[start & 1][month - 1] + day - 1 };
+
+				return totalDays * constants::TICKS_PER_DAY;
+			}
+		}
+
+		return daysFromDate( year, month, day ) * constants::TICKS_PER_DAY;
+	}
+} // namespace nfx::time::internal
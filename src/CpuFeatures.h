@@ -0,0 +1,156 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CpuFeatures.h
+ * @brief Internal runtime CPU feature detection for x86-64
+ * @details Queries CPUID and XCR0 so that SIMD kernels are only dispatched when both the
+ *          processor and the operating system support the required register state, and
+ *          reports whether the time-stamp counter is usable as a clock source.
+ *          On other architectures every query reports false. Not part of the public API.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#if defined( __x86_64__ ) || defined( _M_X64 )
+#	define NFX_DATETIME_X86_64 1
+#	if defined( _MSC_VER ) && !defined( __clang__ )
+#		include <intrin.h>
+#		define NFX_DATETIME_TARGET( isa )
+#	else
+#		include <cpuid.h>
+#		define NFX_DATETIME_TARGET( isa ) __attribute__( ( target( isa ) ) )
+#	endif
+#	include <immintrin.h>
+#else
+#	define NFX_DATETIME_X86_64 0
+#	define NFX_DATETIME_TARGET( isa )
+#endif
+
+namespace nfx::time::internal
+{
+	//=====================================================================
+	// CPU feature detection
+	//=====================================================================
+
+	/**
+	 * @brief Execute CPUID for a leaf and sub-leaf
+	 * @return { EAX, EBX, ECX, EDX }, all zero when the leaf is unsupported or not on x86-64
+	 */
+	inline std::array<std::uint32_t, 4> cpuid( std::uint32_t leaf, std::uint32_t subleaf = 0 ) noexcept
+	{
+		std::array<std::uint32_t, 4> regs{};
+#if NFX_DATETIME_X86_64
+#	if defined( _MSC_VER ) && !defined( __clang__ )
+		int info[4]{};
+		__cpuid( info, static_cast<int>( leaf & 0x80000000U ) );
+		if ( static_cast<std::uint32_t>( info[0] ) < leaf )
+		{
+			return regs;
+		}
+		__cpuidex( info, static_cast<int>( leaf ), static_cast<int>( subleaf ) );
+		for ( std::size_t i{ 0 }; i < 4; ++i )
+		{
+			regs[i] = static_cast<std::uint32_t>( info[i] );
+		}
+#	else
+		if ( __get_cpuid_max( leaf & 0x80000000U, nullptr ) < leaf )
+		{
+			return regs;
+		}
+		__cpuid_count( leaf, subleaf, regs[0], regs[1], regs[2], regs[3] );
+#	endif
+#else
+		static_cast<void>( leaf );
+		static_cast<void>( subleaf );
+#endif
+
+		return regs;
+	}
+
+	/** @brief Read extended control register 0 (OS-enabled register state); 0 without OSXSAVE */
+	inline std::uint64_t xcr0() noexcept
+	{
+#if NFX_DATETIME_X86_64
+		constexpr std::uint32_t OSXSAVE{ 1U << 27 };
+		if ( ( cpuid( 1 )[2] & OSXSAVE ) == 0 )
+		{
+			return 0;
+		}
+#	if defined( _MSC_VER ) && !defined( __clang__ )
+		return _xgetbv( 0 );
+#	else
+		std::uint32_t eax, edx;
+		__asm__ volatile( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+
+		return static_cast<std::uint64_t>( edx ) << 32 | eax;
+#	endif
+#else
+		return 0;
+#endif
+	}
+
+	/** @brief Whether AVX2 instructions are usable */
+	inline bool cpuHasAvx2() noexcept
+	{
+		constexpr std::uint64_t YMM_STATE{ 0x6 };
+		constexpr std::uint32_t AVX2{ 1U << 5 };
+
+		return ( xcr0() & YMM_STATE ) == YMM_STATE && ( cpuid( 7 )[1] & AVX2 ) != 0;
+	}
+
+	/** @brief Whether AVX-512 Foundation instructions are usable */
+	inline bool cpuHasAvx512f() noexcept
+	{
+		constexpr std::uint64_t ZMM_STATE{ 0xE6 };
+		constexpr std::uint32_t AVX512F{ 1U << 16 };
+
+		return ( xcr0() & ZMM_STATE ) == ZMM_STATE && ( cpuid( 7 )[1] & AVX512F ) != 0;
+	}
+
+	/** @brief Whether the time-stamp counter runs at a constant rate in all P-, C- and T-states */
+	inline bool cpuHasInvariantTsc() noexcept
+	{
+		constexpr std::uint32_t INVARIANT_TSC{ 1U << 8 };
+
+		return ( cpuid( 0x80000007 )[3] & INVARIANT_TSC ) != 0;
+	}
+
+	//=====================================================================
+	// Time-stamp counter
+	//=====================================================================
+
+	/** @brief Read the time-stamp counter; 0 when not on x86-64 */
+	inline std::uint64_t readTsc() noexcept
+	{
+#if NFX_DATETIME_X86_64
+		return __rdtsc();
+#else
+		return 0;
+#endif
+	}
+} // namespace nfx::time::internal
@@ -32,13 +32,15 @@
  *          local time representations.
  */
 
-#include <charconv>
 #include <istream>
 #include <limits>
-#include <sstream>
 
 #include "nfx/datetime/DateTime.h"
+#include "Calendar.h"
+#include "FastFormat.h"
+#include "FastParse.h"
 #include "Internal.h"
+#include "Stream.h"
 
 namespace nfx::time
 {
@@ -66,151 +68,6 @@ namespace nfx::time
 			std::min(
 				constants::MAX_DATETIME_TICKS,
 				constants::UNIX_EPOCH_TICKS + ( std::numeric_limits<std::int64_t>::max() / 100 ) );
-
-		//=====================================================================
-		//  Internal helper methods
-		//=====================================================================
-
-		/** @brief Convert ticks to date components */
-		static constexpr void dateComponentsFromTicks( std::int64_t ticks, std::int32_t& year, std::int32_t& month, std::int32_t& day ) noexcept
-		{
-			// Extract date components using Gregorian 400-year cycle algorithm (O(1) complexity)
-			std::int64_t totalDays{ ticks / constants::TICKS_PER_DAY };
-
-			// Use 400-year cycles for O(1) year calculation
-			std::int64_t num400Years{ totalDays / constants::DAYS_PER_400_YEARS };
-			totalDays %= constants::DAYS_PER_400_YEARS;
-
-			// Extract 100-year periods (handle leap year edge case at 400-year boundary)
-			std::int64_t num100Years{ totalDays / constants::DAYS_PER_100_YEARS };
-			if ( num100Years > 3 )
-			{
-				num100Years = 3; // Year divisible by 400 is a leap year
-			}
-			totalDays -= num100Years * constants::DAYS_PER_100_YEARS;
-
-			// Extract 4-year cycles
-			std::int64_t num4Years{ totalDays / constants::DAYS_PER_4_YEARS };
-			totalDays %= constants::DAYS_PER_4_YEARS;
-
-			// Extract remaining years (handle leap year edge case at 4-year boundary)
-			std::int64_t numYears{ totalDays / constants::DAYS_PER_YEAR };
-			if ( numYears > 3 )
-			{
-				numYears = 3; // 4th year in cycle is a leap year
-			}
-			totalDays -= numYears * constants::DAYS_PER_YEAR;
-
-			// Calculate final year (add 1 because year 1 is the base)
-			year = static_cast<std::int32_t>( 1 + num400Years * 400 + num100Years * 100 + num4Years * 4 + numYears );
-
-			// Find the month by iterating through months (already O(1) - max 12 iterations)
-			month = 1;
-			while ( month <= 12 )
-			{
-				std::int32_t daysInCurrentMonth{ DateTime::daysInMonth( year, month ) };
-				if ( totalDays < daysInCurrentMonth )
-				{
-					break;
-				}
-
-				totalDays -= daysInCurrentMonth;
-				++month;
-			}
-
-			// Remaining days is the day of month (add 1 because day is 1-based)
-			day = static_cast<std::int32_t>( totalDays ) + 1;
-		}
-
-		/** @brief Convert ticks to time components */
-		static constexpr void timeComponentsFromTicks( std::int64_t ticks, std::int32_t& hour, std::int32_t& minute, std::int32_t& second, std::int32_t& millisecond ) noexcept
-		{
-			std::int64_t timeTicks{ ticks % constants::TICKS_PER_DAY };
-
-			hour = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_HOUR );
-			timeTicks %= constants::TICKS_PER_HOUR;
-
-			minute = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_MINUTE );
-			timeTicks %= constants::TICKS_PER_MINUTE;
-
-			second = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_SECOND );
-			timeTicks %= constants::TICKS_PER_SECOND;
-
-			millisecond = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_MILLISECOND );
-		}
-
-		/** @brief Convert date components to ticks */
-		static constexpr std::int64_t dateToTicks( std::int32_t year, std::int32_t month, std::int32_t day ) noexcept
-		{
-			// Calculate total days since January 1, year 1 using Gregorian 400-year cycle algorithm (O(1) complexity)
-			std::int64_t totalDays{ 0 };
-
-			// Adjust to 0-based year for calculation
-			std::int32_t y{ year - 1 };
-
-			// Add days for complete 400-year cycles
-			totalDays += ( y / 400 ) * constants::DAYS_PER_400_YEARS;
-			y %= 400;
-
-			// Add days for complete 100-year periods
-			totalDays += ( y / 100 ) * constants::DAYS_PER_100_YEARS;
-			y %= 100;
-
-			// Add days for complete 4-year cycles
-			totalDays += ( y / 4 ) * constants::DAYS_PER_4_YEARS;
-			y %= 4;
-
-			// Add days for remaining years
-			totalDays += y * constants::DAYS_PER_YEAR;
-
-			// Add days for complete months in the given year
-			for ( std::int32_t m{ 1 }; m < month; ++m )
-			{
-				totalDays += DateTime::daysInMonth( year, m );
-			}
-
-			// Add days in the current month (subtract 1 because day is 1-based)
-			totalDays += day - 1;
-
-			return totalDays * constants::TICKS_PER_DAY;
-		}
-
-		/** @brief Convert time components to ticks */
-		static constexpr std::int64_t timeToTicks( std::int32_t hour, std::int32_t minute, std::int32_t second, std::int32_t millisecond ) noexcept
-		{
-			return ( static_cast<std::int64_t>( hour ) * constants::TICKS_PER_HOUR ) +
-				   ( static_cast<std::int64_t>( minute ) * constants::TICKS_PER_MINUTE ) +
-				   ( static_cast<std::int64_t>( second ) * constants::TICKS_PER_SECOND ) +
-				   ( static_cast<std::int64_t>( millisecond ) * constants::TICKS_PER_MILLISECOND );
-		}
-
-		/** @brief Validate date components */
-		static constexpr bool isValidDate( std::int32_t year, std::int32_t month, std::int32_t day ) noexcept
-		{
-			if ( year < constants::MIN_YEAR || year > constants::MAX_YEAR )
-			{
-				return false;
-			}
-			if ( month < 1 || month > 12 )
-			{
-				return false;
-			}
-			if ( day < 1 || day > DateTime::daysInMonth( year, month ) )
-			{
-				return false;
-			}
-
-			return true;
-		}
-
-		/** @brief Validate time components */
-		static constexpr bool isValidTime( std::int32_t hour, std::int32_t minute, std::int32_t second, std::int32_t millisecond ) noexcept
-		{
-			return hour >= 0 && hour <= constants::HOURS_PER_DAY - 1 &&
-				   minute >= 0 && minute <= constants::MINUTES_PER_HOUR - 1 &&
-				   second >= 0 && second <= constants::SECONDS_PER_MINUTE - 1 &&
-				   millisecond >= 0 && millisecond <= constants::MILLISECONDS_PER_SECOND - 1;
-		}
 	} // namespace internal
 
 	//=====================================================================
@@ -339,16 +196,26 @@ namespace nfx::time
 
 	std::int32_t DateTime::dayOfYear() const noexcept
 	{
-		std::int32_t year, month, day;
-		internal::dateComponentsFromTicks( m_ticks, year, month, day );
+		std::int32_t year, month, day, dayOfYear, dayOfWeek;
+		internal::dateComponentsFromTicks( m_ticks, year, month, day, dayOfYear, dayOfWeek );
 
-		std::int32_t dayCount{ 0 };
-		for ( std::int32_t m{ 1 }; m < month; ++m )
-		{
-			dayCount += daysInMonth( year, m );
-		}
+		return dayOfYear;
+	}
+
+	DateTime::Components DateTime::components() const noexcept
+	{
+		Components result{};
+		internal::dateComponentsFromTicks( m_ticks, result.year, result.month, result.day, result.dayOfYear, result.dayOfWeek );
 
-		return dayCount + day;
+		std::int64_t timeTicks{ m_ticks % constants::TICKS_PER_DAY };
+		result.hour = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_HOUR );
+		timeTicks %= constants::TICKS_PER_HOUR;
+		result.minute = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_MINUTE );
+		timeTicks %= constants::TICKS_PER_MINUTE;
+		result.second = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_SECOND );
+		result.fractionTicks = static_cast<std::int32_t>( timeTicks % constants::TICKS_PER_SECOND );
+
+		return result;
 	}
 
 	//----------------------------------------------
@@ -373,94 +240,48 @@ namespace nfx::time
 	// String formatting
 	//----------------------------------------------
 
-	std::string DateTime::toString() const
-	{
-		return toString( Format::Iso8601Basic );
-	}
-
-	std::string DateTime::toString( Format format ) const
+	std::to_chars_result DateTime::toChars( char* first, char* last, Format format ) const noexcept
 	{
-		std::int32_t y, mon, d, h, min, s, ms;
-		internal::dateComponentsFromTicks( m_ticks, y, mon, d );
-		internal::timeComponentsFromTicks( m_ticks, h, min, s, ms );
-
-		std::ostringstream oss;
+		char staging[internal::FORMAT_BUFFER_LENGTH];
+		char* const target{ internal::formatTarget( first, last, staging ) };
+		char* out{ target };
 
 		switch ( format )
 		{
-			case Format::Iso8601Basic:
-			{
-				oss << std::setfill( '0' ) << std::setw( 4 ) << y << "-" << std::setw( 2 ) << mon << "-" << std::setw( 2 ) << d << "T" << std::setw( 2 ) << h << ":"
-					<< std::setw( 2 ) << min << ":" << std::setw( 2 ) << s << "Z";
-
-				break;
-			}
-			case Format::Iso8601Extended:
-			{
-				std::int32_t fractionalTicks{ static_cast<std::int32_t>( m_ticks % constants::TICKS_PER_SECOND ) };
-
-				// Format fractional seconds and strip trailing zeros
-				std::ostringstream fractionOss;
-				fractionOss << std::setfill( '0' ) << std::setw( 7 ) << fractionalTicks;
-				std::string fractionStr = fractionOss.str();
-
-				// Strip trailing zeros (but keep at least one digit if all zeros)
-				auto lastNonZero = fractionStr.find_last_not_of( '0' );
-				if ( lastNonZero != std::string::npos )
-				{
-					fractionStr = fractionStr.substr( 0, lastNonZero + 1 );
-				}
-				else
-				{
-					fractionStr = "0";
-				}
-
-				oss << std::setfill( '0' ) << std::setw( 4 ) << y << "-" << std::setw( 2 ) << mon << "-" << std::setw( 2 ) << d << "T" << std::setw( 2 ) << h
-					<< ":" << std::setw( 2 ) << min << ":" << std::setw( 2 ) << s << "." << fractionStr << "Z";
-
-				break;
-			}
-			case Format::Iso8601WithOffset:
-			{
-				// UTC DateTime always has +00:00 offset
-				oss << std::setfill( '0' ) << std::setw( 4 ) << y << "-" << std::setw( 2 ) << mon << "-" << std::setw( 2 ) << d << "T" << std::setw( 2 ) << h
-					<< ":" << std::setw( 2 ) << min << ":" << std::setw( 2 ) << s << "+00:00";
-
-				break;
-			}
-			case Format::DateOnly:
-			{
-				oss << std::setfill( '0' ) << std::setw( 4 ) << y << "-" << std::setw( 2 ) << mon << "-" << std::setw( 2 ) << d;
-
-				break;
-			}
-			case Format::TimeOnly:
-			{
-				oss << std::setfill( '0' ) << std::setw( 2 ) << h << ":" << std::setw( 2 ) << min << ":" << std::setw( 2 ) << s;
-
-				break;
-			}
 			case Format::UnixSeconds:
 			{
-				oss << toEpochSeconds();
+				out = internal::writeInteger( out, toEpochSeconds() );
 
 				break;
 			}
 			case Format::UnixMilliseconds:
 			{
-				oss << toEpochMilliseconds();
+				out = internal::writeInteger( out, toEpochMilliseconds() );
 
 				break;
 			}
 			default:
 			{
-				oss << toString( Format::Iso8601Basic );
+				out = internal::writeCalendarFormat( out, components(), format );
 
 				break;
 			}
 		}
 
-		return oss.str();
+		return internal::finishFormat( target, out, first, last );
+	}
+
+	std::string DateTime::toString() const
+	{
+		return toString( Format::Iso8601Basic );
+	}
+
+	std::string DateTime::toString( Format format ) const
+	{
+		char buffer[internal::FORMAT_BUFFER_LENGTH];
+		const auto result{ toChars( buffer, buffer + sizeof( buffer ), format ) };
+
+		return std::string( buffer, result.ptr );
 	}
 
 	std::string DateTime::toIso8601Extended() const
@@ -494,201 +315,46 @@ namespace nfx::time
 		return DateTime{ std::chrono::system_clock::now() };
 	}
 
-	DateTime DateTime::today() noexcept
+	DateTime DateTime::utcNowCoarse() noexcept
 	{
-		return now().date();
-	}
-
-	bool DateTime::fromString( std::string_view iso8601String, DateTime& result ) noexcept
-	{
-		// ISO 8601 parser using std::from_chars
-		//  Supports: YYYY-MM-DD, YYYY-MM-DDTHH:mm:ss, YYYY-MM-DDTHH:mm:ssZ,
-		//  YYYY-MM-DDTHH:mm:ss.f, YYYY-MM-DDTHH:mm:ss.fffffffZ, etc.
-		if ( iso8601String.empty() || iso8601String.length() < 10 )
-		{
-			return false;
-		}
-
-		// Remove trailing 'Z' if present
-		if ( iso8601String.back() == 'Z' )
-		{
-			iso8601String.remove_suffix( 1 );
-		}
-
-		// Remove timezone offset for DateTime parsing
-		auto tzPos{ iso8601String.find_last_of( "+-" ) };
-
-		// Ensure it's not in date part (after position 10 = "YYYY-MM-DD")
-		if ( tzPos != std::string_view::npos && tzPos > 10 )
-		{
-			iso8601String = iso8601String.substr( 0, tzPos );
-		}
-
-		const char* data = iso8601String.data();
-		const char* end = data + iso8601String.size();
-
-		// Parse year (YYYY)
-		if ( iso8601String.size() < 4 )
-		{
-			return false;
-		}
-
-		std::int32_t year{ 0 };
-		auto [ptr1, ec1] = std::from_chars( data, data + 4, year );
-		if ( ec1 != std::errc{} || ptr1 != data + 4 )
-		{
-			return false;
-		}
-
-		// Expect '-'
-		if ( ptr1 >= end || *ptr1 != '-' )
-		{
-			return false;
-		}
-		++ptr1; // Skip '-'
-
-		// Parse month (MM or M)
-		std::int32_t month{ 0 };
-		auto dashPos = iso8601String.find( '-', 5 ); // Find second dash after "YYYY-"
-		if ( dashPos == std::string_view::npos )
-		{
-			return false;
-		}
-
-		auto [ptr2, ec2] = std::from_chars( ptr1, data + dashPos, month );
-		if ( ec2 != std::errc{} )
-		{
-			return false;
-		}
-
-		// Expect '-'
-		if ( ptr2 >= end || *ptr2 != '-' )
+		std::int64_t ticks;
+		if ( internal::coarseUtcTicks( ticks ) )
 		{
-			return false;
+			return DateTime{ ticks };
 		}
-		++ptr2; // Skip '-'
 
-		// Parse day (DD or D)
-		std::int32_t day{ 0 };
-		const char* dayEnd = ptr2;
-		while ( dayEnd < end && *dayEnd >= '0' && *dayEnd <= '9' )
-		{
-			++dayEnd;
-		}
+		return utcNow();
+	}
 
-		auto [ptr3, ec3] = std::from_chars( ptr2, dayEnd, day );
-		if ( ec3 != std::errc{} )
+	TimeSpan DateTime::coarseClockResolution() noexcept
+	{
+		std::int64_t ticks;
+		if ( internal::coarseClockResolutionTicks( ticks ) )
 		{
-			return false;
+			return TimeSpan{ ticks };
 		}
 
-		// Time part is optional
-		std::int32_t hour{ 0 }, minute{ 0 }, second{ 0 };
-		std::int32_t fractionalTicks{ 0 };
-
-		if ( ptr3 < end && *ptr3 == 'T' )
-		{
-			++ptr3; // Skip 'T'
-
-			// Parse hour (HH or H)
-			const char* hourEnd = ptr3;
-			while ( hourEnd < end && *hourEnd >= '0' && *hourEnd <= '9' )
-			{
-				++hourEnd;
-			}
-
-			auto [ptr4, ec4] = std::from_chars( ptr3, hourEnd, hour );
-			if ( ec4 != std::errc{} )
-			{
-				return false;
-			}
-
-			// Expect ':'
-			if ( ptr4 >= end || *ptr4 != ':' )
-			{
-				return false;
-			}
-			++ptr4; // Skip ':'
-
-			// Parse minute (MM or M)
-			const char* minEnd = ptr4;
-			while ( minEnd < end && *minEnd >= '0' && *minEnd <= '9' )
-			{
-				++minEnd;
-			}
-
-			auto [ptr5, ec5] = std::from_chars( ptr4, minEnd, minute );
-			if ( ec5 != std::errc{} )
-			{
-				return false;
-			}
-
-			// Expect ':'
-			if ( ptr5 >= end || *ptr5 != ':' )
-			{
-				return false;
-			}
-			++ptr5; // Skip ':'
-
-			// Parse second (SS or S)
-			const char* secEnd = ptr5;
-			while ( secEnd < end && *secEnd >= '0' && *secEnd <= '9' )
-			{
-				++secEnd;
-			}
+		using Ticks = std::chrono::duration<std::int64_t, std::ratio<1, constants::TICKS_PER_SECOND>>;
+		const auto systemTicks{ std::chrono::ceil<Ticks>( std::chrono::system_clock::duration{ 1 } ).count() };
 
-			auto [ptr6, ec6] = std::from_chars( ptr5, secEnd, second );
-			if ( ec6 != std::errc{} )
-			{
-				return false;
-			}
+		return TimeSpan{ systemTicks > 0 ? systemTicks : 1 };
+	}
 
-			// Parse fractional seconds if present
-			if ( ptr6 < end && *ptr6 == '.' )
-			{
-				++ptr6; // Skip '.'
-
-				// Count fractional digits (max 7 for 100ns precision)
-				const char* fracStart = ptr6;
-				const char* fracEnd = fracStart;
-				std::int32_t fractionDigits{ 0 };
-
-				while ( fracEnd < end && *fracEnd >= '0' && *fracEnd <= '9' && fractionDigits < 7 )
-				{
-					++fracEnd;
-					++fractionDigits;
-				}
-
-				if ( fractionDigits > 0 )
-				{
-					std::int32_t fractionValue{ 0 };
-					auto [ptrF, ecF] = std::from_chars( fracStart, fracEnd, fractionValue );
-					if ( ecF != std::errc{} || ptrF != fracEnd )
-					{
-						return false;
-					}
-
-					// Pad to 7 digits (convert to 100ns ticks)
-					while ( fractionDigits < 7 )
-					{
-						fractionValue *= 10;
-						++fractionDigits;
-					}
-
-					fractionalTicks = fractionValue;
-				}
-			}
-		}
+	DateTime DateTime::today() noexcept
+	{
+		return now().date();
+	}
 
-		// Validate components
-		if ( !internal::isValidDate( year, month, day ) || !internal::isValidTime( hour, minute, second, 0 ) )
+	bool DateTime::fromString( std::string_view iso8601String, DateTime& result ) noexcept
+	{
+		// Canonical YYYY-MM-DDTHH:MM:SS[.fffffff][Z] first, general ISO 8601 parser otherwise
+		std::int64_t ticks{ 0 };
+		if ( !internal::parseCanonicalDateTime( iso8601String, ticks ) &&
+			 !internal::parseDateTime( iso8601String, ticks ) )
 		{
 			return false;
 		}
 
-		// Calculate ticks
-		std::int64_t ticks{ internal::dateToTicks( year, month, day ) + internal::timeToTicks( hour, minute, second, 0 ) + fractionalTicks };
-
 		result = DateTime{ ticks };
 
 		return true;
@@ -742,20 +408,14 @@ namespace nfx::time
 
 	std::ostream& operator<<( std::ostream& os, const DateTime& dateTime )
 	{
-		os << dateTime.toString();
+		char buffer[internal::FORMAT_BUFFER_LENGTH];
+		const auto result{ dateTime.toChars( buffer, buffer + sizeof( buffer ) ) };
 
-		return os;
+		return os << std::string_view{ buffer, static_cast<std::size_t>( result.ptr - buffer ) };
 	}
 
 	std::istream& operator>>( std::istream& is, DateTime& dateTime )
 	{
-		std::string str;
-		is >> str;
-		if ( !DateTime::fromString( str, dateTime ) )
-		{
-			is.setstate( std::ios::failbit );
-		}
-
-		return is;
+		return internal::extractToken( is, [&dateTime]( std::string_view token ) { return DateTime::fromString( token, dateTime ); } );
 	}
 } // namespace nfx::time
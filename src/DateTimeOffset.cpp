@@ -31,13 +31,14 @@
  *          timezone-aware datetime values with 100-nanosecond precision.
  */
 
-#include <charconv>
 #include <istream>
 #include <stdexcept>
-#include <sstream>
 
 #include "nfx/datetime/DateTimeOffset.h"
+#include "FastFormat.h"
+#include "FastParse.h"
 #include "Internal.h"
+#include "Stream.h"
 
 namespace nfx::time
 {
@@ -65,93 +66,6 @@ namespace nfx::time
 
 			return offsetTicks >= -MAX_OFFSET_TICKS && offsetTicks <= MAX_OFFSET_TICKS;
 		}
-
-		//----------------------------------------------
-		// String formatting
-		//----------------------------------------------
-
-		/** @brief Append timezone offset to output stream */
-		static void appendOffset( std::ostringstream& oss, std::int32_t offsetMinutes )
-		{
-			if ( offsetMinutes == 0 )
-			{
-				oss << 'Z';
-			}
-			else
-			{
-				const auto absMinutes{ std::abs( offsetMinutes ) };
-				const auto offsetHours{ absMinutes / constants::MINUTES_PER_HOUR };
-				const auto offsetMins{ absMinutes % constants::MINUTES_PER_HOUR };
-				oss << ( offsetMinutes >= 0 ? '+' : '-' )
-					<< std::setw( 2 ) << offsetHours << ':'
-					<< std::setw( 2 ) << offsetMins;
-			}
-		}
-
-		/** @brief Format ISO 8601 datetime with offset */
-		static std::string formatIso8601( const DateTimeOffset& dto, DateTime::Format format )
-		{
-			std::ostringstream oss;
-			oss << std::setfill( '0' );
-
-			// Date part
-			oss << std::setw( 4 ) << dto.year() << '-'
-				<< std::setw( 2 ) << dto.month() << '-'
-				<< std::setw( 2 ) << dto.day() << 'T';
-
-			// Time part
-			oss << std::setw( 2 ) << dto.hour() << ':'
-				<< std::setw( 2 ) << dto.minute() << ':'
-				<< std::setw( 2 ) << dto.second();
-
-			// Add fractional seconds for extended format
-			if ( format == DateTime::Format::Iso8601Extended )
-			{
-				const auto ms{ dto.millisecond() };
-				const auto us{ dto.microsecond() };
-				const auto ns{ dto.nanosecond() };
-				if ( ms > 0 || us > 0 || ns > 0 )
-				{
-					oss << '.' << std::setw( 3 ) << ms;
-					if ( us > 0 || ns > 0 )
-					{
-						oss << std::setw( 3 ) << us;
-						if ( ns > 0 )
-						{
-							oss << std::setw( 1 ) << ( ns / 100 );
-						}
-					}
-				}
-			}
-
-			// Offset part
-			appendOffset( oss, dto.totalOffsetMinutes() );
-			return oss.str();
-		}
-
-		/** @brief Format date only */
-		static std::string formatDateOnly( const DateTimeOffset& dto )
-		{
-			std::ostringstream oss;
-			oss << std::setfill( '0' )
-				<< std::setw( 4 ) << dto.year() << '-'
-				<< std::setw( 2 ) << dto.month() << '-'
-				<< std::setw( 2 ) << dto.day();
-			return oss.str();
-		}
-
-		/** @brief Format time only with offset */
-		static std::string formatTimeOnly( const DateTimeOffset& dto )
-		{
-			std::ostringstream oss;
-			oss << std::setfill( '0' )
-				<< std::setw( 2 ) << dto.hour() << ':'
-				<< std::setw( 2 ) << dto.minute() << ':'
-				<< std::setw( 2 ) << dto.second();
-
-			appendOffset( oss, dto.totalOffsetMinutes() );
-			return oss.str();
-		}
 	} // namespace internal
 
 	//=====================================================================
@@ -253,9 +167,10 @@ namespace nfx::time
 	DateTimeOffset DateTimeOffset::addMonths( std::int32_t months ) const noexcept
 	{
 		// Extract date components
-		auto year{ m_dateTime.year() };
-		auto month{ m_dateTime.month() };
-		const auto day{ m_dateTime.day() };
+		const auto c{ m_dateTime.components() };
+		auto year{ c.year };
+		auto month{ c.month };
+		const auto day{ c.day };
 		const auto timeOfDay{ m_dateTime.timeOfDay() };
 
 		// Add months with proper year overflow handling
@@ -295,42 +210,69 @@ namespace nfx::time
 	// String formatting
 	//----------------------------------------------
 
-	std::string DateTimeOffset::toString() const
+	std::to_chars_result DateTimeOffset::toChars( char* first, char* last, DateTime::Format format ) const noexcept
 	{
-		return toString( DateTime::Format::Iso8601Basic );
-	}
+		char staging[internal::FORMAT_BUFFER_LENGTH];
+		char* const target{ internal::formatTarget( first, last, staging ) };
+		char* out{ target };
 
-	std::string DateTimeOffset::toString( DateTime::Format format ) const
-	{
 		switch ( format )
 		{
-			case DateTime::Format::Iso8601Basic:
-			case DateTime::Format::Iso8601Extended:
-			case DateTime::Format::Iso8601WithOffset:
-			{
-				return internal::formatIso8601( *this, format );
-			}
-			case DateTime::Format::DateOnly:
+			case DateTime::Format::UnixSeconds:
 			{
-				return internal::formatDateOnly( *this );
+				out = internal::writeInteger( out, toEpochSeconds() );
+
+				break;
 			}
-			case DateTime::Format::TimeOnly:
+			case DateTime::Format::UnixMilliseconds:
 			{
-				return internal::formatTimeOnly( *this );
+				out = internal::writeInteger( out, toEpochMilliseconds() );
+
+				break;
 			}
-			case DateTime::Format::UnixSeconds:
+			case DateTime::Format::DateOnly:
 			{
-				return std::to_string( toEpochSeconds() );
+				out = internal::writeDate( out, components() );
+
+				break;
 			}
-			case DateTime::Format::UnixMilliseconds:
+			case DateTime::Format::TimeOnly:
 			{
-				return std::to_string( toEpochMilliseconds() );
+				out = internal::writeTime( out, components() );
+				out = internal::writeOffset( out, totalOffsetMinutes() );
+
+				break;
 			}
 			default:
 			{
-				return toString( DateTime::Format::Iso8601Basic );
+				const auto c{ components() };
+				out = internal::writeDate( out, c );
+				*out++ = 'T';
+				out = internal::writeTime( out, c );
+				if ( format == DateTime::Format::Iso8601Extended )
+				{
+					out = internal::writeGroupedFraction( out, c.fractionTicks );
+				}
+				out = internal::writeOffset( out, totalOffsetMinutes() );
+
+				break;
 			}
 		}
+
+		return internal::finishFormat( target, out, first, last );
+	}
+
+	std::string DateTimeOffset::toString() const
+	{
+		return toString( DateTime::Format::Iso8601Basic );
+	}
+
+	std::string DateTimeOffset::toString( DateTime::Format format ) const
+	{
+		char buffer[internal::FORMAT_BUFFER_LENGTH];
+		const auto result{ toChars( buffer, buffer + sizeof( buffer ), format ) };
+
+		return std::string( buffer, result.ptr );
 	}
 
 	std::string DateTimeOffset::toIso8601Extended() const
@@ -364,18 +306,21 @@ namespace nfx::time
 		return DateTimeOffset{ DateTime::utcNow(), TimeSpan{ 0 } };
 	}
 
+	DateTimeOffset DateTimeOffset::utcNowCoarse() noexcept
+	{
+		return DateTimeOffset{ DateTime::utcNowCoarse(), TimeSpan{ 0 } };
+	}
+
 	DateTimeOffset DateTimeOffset::today() noexcept
 	{
 		// Get current local time, then extract just the date part at midnight
 		const auto localNow{ DateTimeOffset::now() };
 
 		// Extract local date components
-		const auto year{ localNow.year() };
-		const auto month{ localNow.month() };
-		const auto day{ localNow.day() };
+		const auto c{ localNow.components() };
 
 		// Create local midnight for today with the same offset
-		return DateTimeOffset{ year, month, day, 0, 0, 0, localNow.offset() };
+		return DateTimeOffset{ c.year, c.month, c.day, 0, 0, 0, localNow.offset() };
 	}
 
 	DateTimeOffset DateTimeOffset::min() noexcept
@@ -395,145 +340,17 @@ namespace nfx::time
 
 	bool DateTimeOffset::fromString( std::string_view iso8601String, DateTimeOffset& result ) noexcept
 	{
-		/*
-			ISO 8601 compliant parser supporting:
-			- Local time without timezone (valid but ambiguous per ISO 8601)
-			- UTC indicator: Z
-			- Timezone offsets: ±HH:MM (extended), ±HHMM (basic), ±HH (basic)
-			- Maximum offset: ±14:00 (±840 minutes)
-
-			Note: ISO 8601 allows local time without timezone designator, though it's
-			ambiguous for cross-timezone communication. When no timezone is provided,
-			offset defaults to zero (treated as unspecified/local time).
-		*/
-
-		// Work directly with string_view to avoid allocations
-		TimeSpan offset{ 0 };
-		DateTime dateTime;
-		std::string_view dateTimeStr{ iso8601String };
-
-		// Find timezone indicator - search from right to avoid matching negative years
-		std::size_t offsetPos{ std::string_view::npos };
-		for ( std::size_t i{ iso8601String.length() }; i > 10; --i )
+		std::int64_t ticks{ 0 };
+		std::int64_t offsetTicks{ 0 };
+		if ( !internal::parseCanonicalDateTimeOffset( iso8601String, ticks, offsetTicks ) &&
+			 !internal::parseDateTimeOffset( iso8601String, ticks, offsetTicks ) )
 		{
-			// Skip date part (YYYY-MM-DD = 10 chars)
-			const char ch{ iso8601String[i - 1] };
-			if ( ch == 'Z' || ch == '+' || ch == '-' )
-			{
-				offsetPos = i - 1;
-				break;
-			}
-		}
-
-		if ( offsetPos != std::string_view::npos )
-		{
-			// Validate no double signs (e.g., "+-", "-+", "++", "--")
-			const char prevChar{ iso8601String[offsetPos - 1] };
-			if ( prevChar == '+' || prevChar == '-' )
-			{
-				return false; // Reject double sign patterns
-			}
-
-			if ( iso8601String[offsetPos] == 'Z' )
-			{
-				// UTC indicator
-				offset = TimeSpan{ 0 };
-				dateTimeStr = iso8601String.substr( 0, offsetPos );
-			}
-			else
-			{
-				// Parse offset: supports +HH:MM, +HHMM, +HH formats
-				std::string_view offsetStr{ iso8601String.substr( offsetPos ) };
-				dateTimeStr = iso8601String.substr( 0, offsetPos );
-
-				// Minimum: +H or -H (at least 2 chars: sign + digit)
-				if ( offsetStr.length() < 2 )
-				{
-					return false;
-				}
-
-				const bool isNegative{ offsetStr[0] == '-' };
-				const std::string_view numericPart{ offsetStr.substr( 1 ) };
-
-				std::int32_t hours{ 0 };
-				std::int32_t minutes{ 0 };
-
-				const auto colonPos{ numericPart.find( ':' ) };
-				if ( colonPos != std::string_view::npos )
-				{
-					// Format: +HH:MM or +H:MM
-					if ( colonPos == 0 || colonPos >= numericPart.length() - 1 )
-					{
-						return false;
-					}
-
-					const std::string_view hoursStr{ numericPart.substr( 0, colonPos ) };
-					const std::string_view minutesStr{ numericPart.substr( colonPos + 1 ) };
-
-					auto [ptrH, ecH] = std::from_chars( hoursStr.data(), hoursStr.data() + hoursStr.size(), hours );
-					auto [ptrM, ecM] = std::from_chars( minutesStr.data(), minutesStr.data() + minutesStr.size(), minutes );
-
-					if ( ecH != std::errc{} || ecM != std::errc{} ||
-						 ptrH != hoursStr.data() + hoursStr.size() ||
-						 ptrM != minutesStr.data() + minutesStr.size() )
-					{
-						return false; // Invalid numeric format
-					}
-				}
-				else if ( numericPart.length() == 4 )
-				{
-					// Format: +HHMM
-					auto [ptrH, ecH] = std::from_chars( numericPart.data(), numericPart.data() + 2, hours );
-					auto [ptrM, ecM] = std::from_chars( numericPart.data() + 2, numericPart.data() + 4, minutes );
-
-					if ( ecH != std::errc{} || ecM != std::errc{} ||
-						 ptrH != numericPart.data() + 2 ||
-						 ptrM != numericPart.data() + 4 )
-					{
-						return false; // Invalid numeric format
-					}
-				}
-				else if ( numericPart.length() == 2 || numericPart.length() == 1 )
-				{
-					// Format: +HH or +H
-					auto [ptr, ec] = std::from_chars( numericPart.data(), numericPart.data() + numericPart.length(), hours );
-					if ( ec != std::errc{} || ptr != numericPart.data() + numericPart.length() )
-					{
-						return false; // Invalid numeric format
-					}
-					minutes = 0;
-				}
-				else
-				{
-					return false; // Invalid format
-				}
-
-				// Validate offset components - ISO 8601 allows ±14:00 maximum
-				// Hours must be 0-14, minutes 0-59
-				// Special case: if hours == 14, minutes must be 0 (max is exactly ±14:00)
-				if ( hours < 0 || hours > 14 || minutes < 0 || minutes > 59 )
-				{
-					return false; // Out of range
-				}
-
-				if ( hours == 14 && minutes > 0 )
-				{
-					return false; // Maximum offset is exactly ±14:00, not ±14:01+
-				}
-
-				const auto totalMinutes{ hours * constants::MINUTES_PER_HOUR + minutes };
-				offset = TimeSpan::fromMinutes( isNegative ? -totalMinutes : totalMinutes );
-			}
+			return false;
 		}
 
-		// Parse the datetime part
-		if ( DateTime::fromString( dateTimeStr, dateTime ) )
-		{
-			result = DateTimeOffset{ dateTime, offset };
-			return true;
-		}
+		result = DateTimeOffset{ ticks, TimeSpan{ offsetTicks } };
 
-		return false;
+		return true;
 	}
 
 	std::optional<DateTimeOffset> DateTimeOffset::fromString( std::string_view iso8601String ) noexcept
@@ -569,19 +386,14 @@ namespace nfx::time
 
 	std::ostream& operator<<( std::ostream& os, const DateTimeOffset& dateTimeOffset )
 	{
-		return os << dateTimeOffset.toString();
+		char buffer[internal::FORMAT_BUFFER_LENGTH];
+		const auto result{ dateTimeOffset.toChars( buffer, buffer + sizeof( buffer ) ) };
+
+		return os << std::string_view{ buffer, static_cast<std::size_t>( result.ptr - buffer ) };
 	}
 
 	std::istream& operator>>( std::istream& is, DateTimeOffset& dateTimeOffset )
 	{
-		std::string str;
-		is >> str;
-
-		if ( !DateTimeOffset::fromString( str, dateTimeOffset ) )
-		{
-			is.setstate( std::ios::failbit );
-		}
-
-		return is;
+		return internal::extractToken( is, [&dateTimeOffset]( std::string_view token ) { return DateTimeOffset::fromString( token, dateTimeOffset ); } );
 	}
 } // namespace nfx::time
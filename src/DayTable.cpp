@@ -0,0 +1,105 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DayTable.cpp
+ * @brief Compile-time generated day lookup table for the hot date window
+ * @details Every day of the configured window (NFX_DATETIME_DAY_TABLE_FIRST_YEAR to
+ *          NFX_DATETIME_DAY_TABLE_LAST_YEAR) maps to one packed 32-bit entry holding
+ *          year, month, day, day of year and day of week. The table lives in .rodata
+ *          and is never built at runtime (~330 KiB for the default 1970-2199 window).
+ */
+
+#include <algorithm>
+#include <utility>
+
+#include "Calendar.h"
+
+namespace nfx::time::internal
+{
+	namespace
+	{
+		//=====================================================================
+		// Table generation
+		//=====================================================================
+
+		/** @brief Build one block of packed entries, starting at day DAY_TABLE_FIRST_DAY + block * DAY_TABLE_BLOCK_SIZE */
+		constexpr std::array<std::uint32_t, DAY_TABLE_BLOCK_SIZE> makeDayTableBlock( std::size_t block ) noexcept
+		{
+			std::array<std::uint32_t, DAY_TABLE_BLOCK_SIZE> entries{};
+
+			const std::uint64_t first{ block * DAY_TABLE_BLOCK_SIZE };
+			if ( first >= DAY_TABLE_DAY_COUNT )
+			{
+				return entries;
+			}
+
+			// Seed from the arithmetic decomposition, then walk the calendar forward one day at a time
+			const std::int64_t days{ DAY_TABLE_FIRST_DAY + static_cast<std::int64_t>( first ) };
+			std::int32_t year, month, day;
+			dateComponentsFromDays( days, year, month, day );
+			bool isLeap{ DateTime::isLeapYear( year ) };
+			std::int32_t dayOfYear{ DAYS_BEFORE_MONTH[isLeap][month - 1] + day };
+			auto dayOfWeek{ static_cast<std::int32_t>( ( days + 1 ) % 7 ) };
+
+			const std::uint64_t count{ std::min<std::uint64_t>( DAY_TABLE_BLOCK_SIZE, DAY_TABLE_DAY_COUNT - first ) };
+			for ( std::uint64_t i{ 0 }; i < count; ++i )
+			{
+				entries[i] = packDayTableEntry( year, month, day, dayOfYear, dayOfWeek );
+
+				dayOfWeek = dayOfWeek == 6 ? 0 : dayOfWeek + 1;
+				++dayOfYear;
+				if ( ++day > DAYS_BEFORE_MONTH[isLeap][month] - DAYS_BEFORE_MONTH[isLeap][month - 1] )
+				{
+					day = 1;
+					if ( ++month > 12 )
+					{
+						month = 1;
+						dayOfYear = 1;
+						isLeap = DateTime::isLeapYear( ++year );
+					}
+				}
+			}
+
+			return entries;
+		}
+
+		/** @brief One table block; each instantiation is a separate constant evaluation */
+		template <std::size_t Block>
+		constexpr std::array<std::uint32_t, DAY_TABLE_BLOCK_SIZE> DAY_TABLE_BLOCK{ makeDayTableBlock( Block ) };
+
+		template <std::size_t... Blocks>
+		constexpr std::array<const std::uint32_t*, sizeof...( Blocks )> makeDayTableBlocks( std::index_sequence<Blocks...> ) noexcept
+		{
+			return { DAY_TABLE_BLOCK<Blocks>.data()... };
+		}
+	} // namespace
+
+	//=====================================================================
+	// Day lookup table
+	//=====================================================================
+
+	const std::array<const std::uint32_t*, DAY_TABLE_BLOCK_COUNT> DAY_TABLE_BLOCKS{
+		makeDayTableBlocks( std::make_index_sequence<DAY_TABLE_BLOCK_COUNT>{} ) };
+} // namespace nfx::time::internal
@@ -0,0 +1,221 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FastFormat.h
+ * @brief Internal table-driven writers behind toChars() and toString()
+ * @details Every writer takes the fields of one components() decomposition and stores
+ *          bytes through a char pointer with digit-pair table lookups, so formatting needs
+ *          no stream, locale or temporary string. Not part of the public API.
+ */
+
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "nfx/datetime/DateTime.h"
+#include "nfx/detail/datetime/Constants.h"
+#include "nfx/detail/datetime/Formatter.h"
+#include "nfx/detail/datetime/Pattern.h"
+
+namespace nfx::time::internal
+{
+	//=====================================================================
+	// Table-driven formatting
+	//=====================================================================
+
+	//----------------------------------------------
+	// Fields
+	//----------------------------------------------
+
+	/** @brief Write "YYYY-MM-DD" */
+	inline char* writeDate( char* out, const DateTime::Components& c ) noexcept
+	{
+		out = writeDigitPair( out, c.year / 100 );
+		out = writeDigitPair( out, c.year % 100 );
+		*out++ = '-';
+		out = writeDigitPair( out, c.month );
+		*out++ = '-';
+
+		return writeDigitPair( out, c.day );
+	}
+
+	/** @brief Write "HH:MM:SS" */
+	inline char* writeTime( char* out, const DateTime::Components& c ) noexcept
+	{
+		out = writeDigitPair( out, c.hour );
+		*out++ = ':';
+		out = writeDigitPair( out, c.minute );
+		*out++ = ':';
+
+		return writeDigitPair( out, c.second );
+	}
+
+	/** @brief Write "." and seven fraction digits without trailing zeros, or ".0" for a zero fraction */
+	inline char* writeTrimmedFraction( char* out, std::int32_t fractionTicks ) noexcept
+	{
+		*out++ = '.';
+		*out = static_cast<char>( '0' + fractionTicks / 1000000 );
+		writeDigitPair( out + 1, fractionTicks / 10000 % 100 );
+		writeDigitPair( out + 3, fractionTicks / 100 % 100 );
+		writeDigitPair( out + 5, fractionTicks % 100 );
+
+		std::size_t length{ 7 };
+		while ( length > 1 && out[length - 1] == '0' )
+		{
+			--length;
+		}
+
+		return out + length;
+	}
+
+	/** @brief Write nothing for a zero fraction, otherwise "." and 3, 6 or 7 digits (milliseconds, microseconds, ticks) */
+	inline char* writeGroupedFraction( char* out, std::int32_t fractionTicks ) noexcept
+	{
+		if ( fractionTicks == 0 )
+		{
+			return out;
+		}
+
+		const std::int32_t milliseconds{ fractionTicks / 10000 };
+		const std::int32_t belowMilliseconds{ fractionTicks % 10000 };
+		*out++ = '.';
+		*out++ = static_cast<char>( '0' + milliseconds / 100 );
+		out = writeDigitPair( out, milliseconds % 100 );
+		if ( belowMilliseconds == 0 )
+		{
+			return out;
+		}
+
+		*out++ = static_cast<char>( '0' + belowMilliseconds / 1000 );
+		out = writeDigitPair( out, belowMilliseconds / 10 % 100 );
+		if ( belowMilliseconds % 10 != 0 )
+		{
+			*out++ = static_cast<char>( '0' + belowMilliseconds % 10 );
+		}
+
+		return out;
+	}
+
+	/** @brief Write "Z" for a zero offset, otherwise "±HH:MM" (hours unpadded above 99) */
+	inline char* writeOffset( char* out, std::int32_t offsetMinutes ) noexcept
+	{
+		if ( offsetMinutes == 0 )
+		{
+			*out++ = 'Z';
+
+			return out;
+		}
+
+		const std::int32_t minutes{ offsetMinutes < 0 ? -offsetMinutes : offsetMinutes };
+		const std::int32_t hours{ minutes / constants::MINUTES_PER_HOUR };
+		*out++ = offsetMinutes < 0 ? '-' : '+';
+		out = hours < 100 ? writeDigitPair( out, hours ) : writeUnpadded( out, hours );
+		*out++ = ':';
+
+		return writeDigitPair( out, minutes % constants::MINUTES_PER_HOUR );
+	}
+
+	/**
+	 * @brief Write a decomposed DateTime in any Format other than UnixSeconds and UnixMilliseconds
+	 * @return Output position after the last byte written
+	 */
+	inline char* writeCalendarFormat( char* out, const DateTime::Components& c, DateTime::Format format ) noexcept
+	{
+		if ( format != DateTime::Format::TimeOnly )
+		{
+			out = writeDate( out, c );
+			if ( format == DateTime::Format::DateOnly )
+			{
+				return out;
+			}
+			*out++ = 'T';
+		}
+		out = writeTime( out, c );
+
+		if ( format == DateTime::Format::Iso8601Extended )
+		{
+			out = writeTrimmedFraction( out, c.fractionTicks );
+		}
+		if ( format == DateTime::Format::Iso8601WithOffset )
+		{
+			// UTC DateTime always has +00:00 offset
+			std::memcpy( out, "+00:00", 6 );
+			out += 6;
+		}
+		else if ( format != DateTime::Format::TimeOnly )
+		{
+			*out++ = 'Z';
+		}
+
+		return out;
+	}
+
+	/** @brief Write a signed integer in decimal */
+	inline char* writeInteger( char* out, std::int64_t value ) noexcept
+	{
+		return std::to_chars( out, out + 20, value ).ptr;
+	}
+
+	//----------------------------------------------
+	// Output
+	//----------------------------------------------
+
+	/**
+	 * @brief Pick where toChars() writes
+	 * @return first if the caller's buffer covers the worst case, otherwise the staging buffer
+	 */
+	inline char* formatTarget( char* first, char* last, char* staging ) noexcept
+	{
+		return static_cast<std::size_t>( last - first ) >= FORMAT_BUFFER_LENGTH ? first : staging;
+	}
+
+	/**
+	 * @brief Finish toChars() output written by formatTarget()
+	 * @param target Start of the written output
+	 * @param end End of the written output
+	 * @param first Start of the caller's buffer
+	 * @param last End of the caller's buffer
+	 * @return std::to_chars_result for the caller's buffer
+	 */
+	inline std::to_chars_result finishFormat( const char* target, char* end, char* first, char* last ) noexcept
+	{
+		if ( target == first )
+		{
+			return { end, std::errc{} };
+		}
+
+		const auto length{ end - target };
+		if ( length > last - first )
+		{
+			return { last, std::errc::value_too_large };
+		}
+		std::memcpy( first, target, static_cast<std::size_t>( length ) );
+
+		return { first + length, std::errc{} };
+	}
+} // namespace nfx::time::internal
@@ -0,0 +1,327 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FastParse.h
+ * @brief Internal SWAR fast path for the canonical ISO 8601 timestamp layout
+ * @details Recognises YYYY-MM-DDTHH:MM:SS[.f{1,7}][Z|±HH:MM] with three unaligned 8-byte loads,
+ *          validating every digit and separator with masks and converting all six fields
+ *          with a handful of multiply-adds. Anything else is left to the general parser in
+ *          nfx/detail/datetime/Iso8601.h, which accepts a superset of this layout and
+ *          produces the same ticks for it. Not part of the public API.
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "Calendar.h"
+
+namespace nfx::time::internal
+{
+	//=====================================================================
+	// Canonical ISO 8601 fast path
+	//=====================================================================
+
+	//----------------------------------------------
+	// Byte masks
+	//----------------------------------------------
+
+	/*
+		The 19-byte prefix is covered by three little-endian words:
+
+			bytes  0-7    Y Y Y Y - M M -
+			bytes  8-15   D D T . . . . .      (only D, D and T are checked here)
+			bytes 11-18   H H : M M : S S
+	*/
+
+	/** @brief Digit lanes of "YYYY-MM-" */
+	inline constexpr std::uint64_t SWAR_DATE_DIGITS{ 0x00FFFF00FFFFFFFFULL };
+
+	/** @brief Separator bytes of "YYYY-MM-" */
+	inline constexpr std::uint64_t SWAR_DATE_SEPARATORS{ 0x2D00002D00000000ULL };
+
+	/** @brief Checked lanes of "DDT....." */
+	inline constexpr std::uint64_t SWAR_DAY_LANES{ 0x0000000000FFFFFFULL };
+
+	/** @brief Digit lanes of "DDT....." */
+	inline constexpr std::uint64_t SWAR_DAY_DIGITS{ 0x000000000000FFFFULL };
+
+	/** @brief Separator bytes of "DDT....." */
+	inline constexpr std::uint64_t SWAR_DAY_SEPARATORS{ 0x0000000000540000ULL };
+
+	/** @brief Digit lanes of "HH:MM:SS" */
+	inline constexpr std::uint64_t SWAR_TIME_DIGITS{ 0xFFFF00FFFF00FFFFULL };
+
+	/** @brief Separator bytes of "HH:MM:SS" */
+	inline constexpr std::uint64_t SWAR_TIME_SEPARATORS{ 0x00003A00003A0000ULL };
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	/** @brief Unaligned little-endian 8-byte load */
+	inline std::uint64_t loadWord( const char* data ) noexcept
+	{
+		std::uint64_t word;
+		std::memcpy( &word, data, sizeof( word ) );
+
+		return word;
+	}
+
+	/**
+	 * @brief Check separators exactly and digits ('0'-'9') in the given lanes of a word
+	 * @param word Loaded bytes
+	 * @param digits 0xFF in every lane that must hold a digit
+	 * @param lanes 0xFF in every lane that is checked (digits and separators)
+	 * @param separators Expected bytes in the separator lanes, zero elsewhere
+	 */
+	inline bool matchesShape( std::uint64_t word, std::uint64_t digits, std::uint64_t lanes, std::uint64_t separators ) noexcept
+	{
+		constexpr std::uint64_t highNibbles{ 0xF0F0F0F0F0F0F0F0ULL };
+		constexpr std::uint64_t asciiZeros{ 0x3030303030303030ULL };
+		constexpr std::uint64_t sixes{ 0x0606060606060606ULL };
+
+		// Separators must match exactly; digit lanes are zeroed before any addition so
+		// that the following carry-based test cannot spill across lanes
+		const std::uint64_t digitBytes{ word & digits };
+
+		return ( word & ( lanes & ~digits ) ) == separators &&
+			   ( digitBytes & highNibbles ) == ( asciiZeros & digits ) &&
+			   ( ( digitBytes + ( sixes & digits ) ) & highNibbles ) == ( asciiZeros & digits );
+	}
+
+	/**
+	 * @brief Combine adjacent digit lanes into two-digit values
+	 * @details Lane i of the result holds 10 * digit(i) + digit(i + 1) for the digit lanes.
+	 */
+	inline std::uint64_t digitPairs( std::uint64_t word, std::uint64_t digits ) noexcept
+	{
+		const std::uint64_t values{ word & digits & 0x0F0F0F0F0F0F0F0FULL };
+
+		return values * 10 + ( values >> 8 );
+	}
+
+	/** @brief Extract byte lane i */
+	inline std::int32_t lane( std::uint64_t word, std::uint32_t i ) noexcept
+	{
+		return static_cast<std::int32_t>( ( word >> ( 8 * i ) ) & 0xFF );
+	}
+
+	//----------------------------------------------
+	// Layout pieces
+	//----------------------------------------------
+
+	/** @brief Length of the fixed YYYY-MM-DDTHH:MM:SS prefix */
+	inline constexpr std::size_t CANONICAL_PREFIX_LENGTH{ 19 };
+
+	/** @brief Fields of a canonical timestamp, not yet range-validated */
+	struct CanonicalFields
+	{
+		std::int32_t year;
+		std::int32_t month;
+		std::int32_t day;
+		std::int32_t hour;
+		std::int32_t minute;
+		std::int32_t second;
+	};
+
+	/**
+	 * @brief Match and convert the YYYY-MM-DDTHH:MM:SS prefix
+	 * @param data At least CANONICAL_PREFIX_LENGTH readable bytes
+	 * @param fields Receives the six fields when the shape matches
+	 * @return true if every digit and separator is in place
+	 */
+	inline bool parseCanonicalPrefix( const char* data, CanonicalFields& fields ) noexcept
+	{
+		if constexpr ( std::endian::native != std::endian::little )
+		{
+			return false;
+		}
+
+		const std::uint64_t date{ loadWord( data ) };
+		const std::uint64_t day{ loadWord( data + 8 ) };
+		const std::uint64_t time{ loadWord( data + 11 ) };
+
+		if ( !matchesShape( date, SWAR_DATE_DIGITS, ~0ULL, SWAR_DATE_SEPARATORS ) ||
+			 !matchesShape( day, SWAR_DAY_DIGITS, SWAR_DAY_LANES, SWAR_DAY_SEPARATORS ) ||
+			 !matchesShape( time, SWAR_TIME_DIGITS, ~0ULL, SWAR_TIME_SEPARATORS ) )
+		{
+			return false;
+		}
+
+		const std::uint64_t datePairs{ digitPairs( date, SWAR_DATE_DIGITS ) };
+		const std::uint64_t timePairs{ digitPairs( time, SWAR_TIME_DIGITS ) };
+
+		fields.year = lane( datePairs, 0 ) * 100 + lane( datePairs, 2 );
+		fields.month = lane( datePairs, 5 );
+		fields.day = lane( digitPairs( day, SWAR_DAY_DIGITS ), 0 );
+		fields.hour = lane( timePairs, 0 );
+		fields.minute = lane( timePairs, 3 );
+		fields.second = lane( timePairs, 6 );
+
+		return true;
+	}
+
+	/**
+	 * @brief Parse an optional .f{1,7} fraction
+	 * @param ptr First byte after the prefix
+	 * @param end End of input
+	 * @param fractionTicks Receives the fraction in ticks (zero when absent)
+	 * @return Pointer past the fraction, or nullptr for a '.' without digits
+	 */
+	inline const char* parseCanonicalFraction( const char* ptr, const char* end, std::int32_t& fractionTicks ) noexcept
+	{
+		fractionTicks = 0;
+		if ( ptr == end || *ptr != '.' )
+		{
+			return ptr;
+		}
+
+		++ptr;
+		const char* fractionStart{ ptr };
+		const char* fractionEnd{ ptr + ( end - ptr < 7 ? end - ptr : 7 ) };
+		for ( ; ptr < fractionEnd && isDigit( *ptr ); ++ptr )
+		{
+			fractionTicks = fractionTicks * 10 + ( *ptr - '0' );
+		}
+
+		constexpr std::int32_t scales[]{ 0, 1000000, 100000, 10000, 1000, 100, 10, 1 };
+		fractionTicks *= scales[ptr - fractionStart];
+
+		return ptr == fractionStart ? nullptr : ptr;
+	}
+
+	/**
+	 * @brief Parse the remainder after the fraction as nothing, Z or ±HH:MM
+	 * @param ptr First byte after the fraction
+	 * @param end End of input
+	 * @param offsetMinutes Receives the offset from UTC in minutes (zero for nothing or Z)
+	 * @return true if the remainder is one of the accepted forms and within ±14:00
+	 */
+	inline bool parseCanonicalOffset( const char* ptr, const char* end, std::int32_t& offsetMinutes ) noexcept
+	{
+		offsetMinutes = 0;
+		const auto remaining{ end - ptr };
+		if ( remaining == 0 || ( remaining == 1 && *ptr == 'Z' ) )
+		{
+			return true;
+		}
+
+		if ( remaining != 6 || ( *ptr != '+' && *ptr != '-' ) || ptr[3] != ':' ||
+			 !isDigit( ptr[1] ) || !isDigit( ptr[2] ) || !isDigit( ptr[4] ) || !isDigit( ptr[5] ) )
+		{
+			return false;
+		}
+
+		const std::int32_t hours{ ( ptr[1] - '0' ) * 10 + ( ptr[2] - '0' ) };
+		const std::int32_t minutes{ ( ptr[4] - '0' ) * 10 + ( ptr[5] - '0' ) };
+		if ( hours > 14 || minutes > 59 || ( hours == 14 && minutes > 0 ) )
+		{
+			return false;
+		}
+
+		const std::int32_t totalMinutes{ hours * constants::MINUTES_PER_HOUR + minutes };
+		offsetMinutes = *ptr == '-' ? -totalMinutes : totalMinutes;
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Parser
+	//----------------------------------------------
+
+	/**
+	 * @brief Parse YYYY-MM-DDTHH:MM:SS[.f{1,7}][Z] into ticks
+	 * @param iso8601String Input string
+	 * @param ticks Receives the parsed ticks on success
+	 * @return true if the input has the canonical layout and valid components; false means
+	 *         the caller must fall back to the general parser
+	 */
+	inline bool parseCanonicalDateTime( std::string_view iso8601String, std::int64_t& ticks ) noexcept
+	{
+		CanonicalFields fields;
+		if ( iso8601String.size() < CANONICAL_PREFIX_LENGTH || !parseCanonicalPrefix( iso8601String.data(), fields ) )
+		{
+			return false;
+		}
+
+		// Fraction (1-7 digits) and UTC designator
+		const char* end{ iso8601String.data() + iso8601String.size() };
+		std::int32_t fractionTicks{ 0 };
+		const char* ptr{ parseCanonicalFraction( iso8601String.data() + CANONICAL_PREFIX_LENGTH, end, fractionTicks ) };
+		if ( ptr == nullptr || !( ptr == end || ( ptr + 1 == end && *ptr == 'Z' ) ) )
+		{
+			return false;
+		}
+
+		if ( !isValidDate( fields.year, fields.month, fields.day ) || !isValidTime( fields.hour, fields.minute, fields.second, 0 ) )
+		{
+			return false;
+		}
+
+		ticks = dateToTicks( fields.year, fields.month, fields.day ) + timeToTicks( fields.hour, fields.minute, fields.second, 0 ) + fractionTicks;
+
+		return true;
+	}
+
+	/**
+	 * @brief Parse YYYY-MM-DDTHH:MM:SS[.f{1,7}][Z|±HH:MM] into local ticks and offset
+	 * @param iso8601String Input string
+	 * @param ticks Receives the local clock ticks on success
+	 * @param offsetTicks Receives the offset from UTC on success (zero for Z or no suffix)
+	 * @return true if the input has the canonical layout and valid components; false means
+	 *         the caller must fall back to the general parser
+	 */
+	inline bool parseCanonicalDateTimeOffset( std::string_view iso8601String, std::int64_t& ticks, std::int64_t& offsetTicks ) noexcept
+	{
+		CanonicalFields fields;
+		if ( iso8601String.size() < CANONICAL_PREFIX_LENGTH || !parseCanonicalPrefix( iso8601String.data(), fields ) )
+		{
+			return false;
+		}
+
+		const char* end{ iso8601String.data() + iso8601String.size() };
+		std::int32_t fractionTicks{ 0 };
+		std::int32_t offsetMinutes{ 0 };
+		const char* ptr{ parseCanonicalFraction( iso8601String.data() + CANONICAL_PREFIX_LENGTH, end, fractionTicks ) };
+		if ( ptr == nullptr || !parseCanonicalOffset( ptr, end, offsetMinutes ) )
+		{
+			return false;
+		}
+
+		if ( !isValidDate( fields.year, fields.month, fields.day ) || !isValidTime( fields.hour, fields.minute, fields.second, 0 ) )
+		{
+			return false;
+		}
+
+		ticks = dateToTicks( fields.year, fields.month, fields.day ) + timeToTicks( fields.hour, fields.minute, fields.second, 0 ) + fractionTicks;
+		offsetTicks = offsetMinutes * constants::TICKS_PER_MINUTE;
+
+		return true;
+	}
+} // namespace nfx::time::internal
@@ -0,0 +1,183 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file IncrementalTimestampParser.cpp
+ * @brief Implementation of the prefix-reusing ISO 8601 parser
+ * @details The cached prefix is held as the two 8-byte words "YYYY-MM-" and "DDTHH:MM", so
+ *          comparing a new string against it costs two loads and two compares. The
+ *          remainder after the fraction is handed to the same checks the general parser
+ *          applies, which keeps the accepted language identical.
+ */
+
+#include "nfx/datetime/IncrementalTimestampParser.h"
+#include "FastParse.h"
+
+namespace nfx::time
+{
+	namespace
+	{
+		//=====================================================================
+		// Prefix word masks
+		//=====================================================================
+
+		/** @brief Lanes of "DDTHH:MM" holding the day and the 'T' */
+		constexpr std::uint64_t DAY_LANES{ 0x0000000000FFFFFFULL };
+
+		/** @brief Digit lanes of "...HH:MM" */
+		constexpr std::uint64_t HOUR_MINUTE_DIGITS{ 0xFFFF00FFFF000000ULL };
+
+		/** @brief Checked lanes of "...HH:MM" */
+		constexpr std::uint64_t HOUR_MINUTE_LANES{ 0xFFFFFFFFFF000000ULL };
+
+		/** @brief Separator bytes of "...HH:MM" */
+		constexpr std::uint64_t HOUR_MINUTE_SEPARATORS{ 0x00003A0000000000ULL };
+	} // namespace
+
+	//=====================================================================
+	// IncrementalTimestampParser class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Parsing
+	//----------------------------------------------
+
+	bool IncrementalTimestampParser::parse( std::string_view iso8601String, DateTime& result ) noexcept
+	{
+		internal::DateTimeScan fields;
+		std::int64_t ticks;
+		if ( !scan( iso8601String, fields ) || !internal::parseDateTimeRemainder( iso8601String, fields, ticks ) )
+		{
+			return false;
+		}
+
+		result = DateTime{ ticks };
+
+		return true;
+	}
+
+	bool IncrementalTimestampParser::parse( std::string_view iso8601String, DateTimeOffset& result ) noexcept
+	{
+		internal::DateTimeScan fields;
+		if ( !scan( iso8601String, fields ) )
+		{
+			return false;
+		}
+
+		// Nothing, Z or ±HH:MM right after the date-time means the same to the general
+		// remainder check, as long as the designator search would start there
+		std::int32_t offsetMinutes;
+		if ( fields.end >= 10 && fields.secondDash < 10 &&
+			 internal::parseCanonicalOffset( iso8601String.data() + fields.end, iso8601String.data() + iso8601String.size(), offsetMinutes ) )
+		{
+			result = DateTimeOffset{ fields.ticks, TimeSpan{ offsetMinutes * constants::TICKS_PER_MINUTE } };
+
+			return true;
+		}
+
+		std::int64_t ticks;
+		std::int64_t offsetTicks;
+		if ( !internal::parseDateTimeOffsetRemainder( iso8601String, fields, ticks, offsetTicks ) )
+		{
+			return false;
+		}
+
+		result = DateTimeOffset{ ticks, TimeSpan{ offsetTicks } };
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Implementation
+	//----------------------------------------------
+
+	bool IncrementalTimestampParser::scan( std::string_view iso8601String, internal::DateTimeScan& result ) noexcept
+	{
+		const char* data{ iso8601String.data() };
+		const char* end{ data + iso8601String.size() };
+
+		// Reuse needs ":SS" after the prefix with exactly two seconds digits, as the general
+		// parser would read a longer digit run as one seconds field
+		if ( m_cached && iso8601String.size() >= internal::CANONICAL_PREFIX_LENGTH &&
+			 internal::loadWord( data ) == m_dateWord && data[16] == ':' &&
+			 internal::isDigit( data[17] ) && internal::isDigit( data[18] ) &&
+			 ( data + internal::CANONICAL_PREFIX_LENGTH == end || !internal::isDigit( data[internal::CANONICAL_PREFIX_LENGTH] ) ) )
+		{
+			const std::int32_t second{ ( data[17] - '0' ) * 10 + ( data[18] - '0' ) };
+			const std::uint64_t minuteWord{ internal::loadWord( data + 8 ) };
+
+			bool reused{ false };
+			if ( second < constants::SECONDS_PER_MINUTE && minuteWord == m_minuteWord )
+			{
+				++m_minuteHits;
+				reused = true;
+			}
+			else if ( second < constants::SECONDS_PER_MINUTE && ( ( minuteWord ^ m_minuteWord ) & DAY_LANES ) == 0 &&
+					  internal::matchesShape( minuteWord, HOUR_MINUTE_DIGITS, HOUR_MINUTE_LANES, HOUR_MINUTE_SEPARATORS ) )
+			{
+				const std::uint64_t pairs{ internal::digitPairs( minuteWord, HOUR_MINUTE_DIGITS ) };
+				const std::int32_t hour{ internal::lane( pairs, 3 ) };
+				const std::int32_t minute{ internal::lane( pairs, 6 ) };
+				if ( hour < constants::HOURS_PER_DAY && minute < constants::MINUTES_PER_HOUR )
+				{
+					m_minuteWord = minuteWord;
+					m_minuteTicks = m_dayTicks + internal::timeToTicks( hour, minute, 0, 0 );
+					++m_dayHits;
+					reused = true;
+				}
+			}
+
+			if ( reused )
+			{
+				std::int32_t fractionalTicks;
+				const char* ptr{ internal::scanFraction( data + internal::CANONICAL_PREFIX_LENGTH, end, fractionalTicks ) };
+
+				result.ticks = m_minuteTicks + second * constants::TICKS_PER_SECOND + fractionalTicks;
+				result.end = static_cast<std::size_t>( ptr - data );
+				result.secondDash = 7;
+
+				return true;
+			}
+		}
+
+		++m_misses;
+		if ( iso8601String.size() < 10 || !internal::scanDateTime( iso8601String, result ) )
+		{
+			return false;
+		}
+
+		// The fields are valid now, so a canonical prefix can be cached as is
+		internal::CanonicalFields fields;
+		if ( iso8601String.size() >= internal::CANONICAL_PREFIX_LENGTH && internal::parseCanonicalPrefix( data, fields ) )
+		{
+			m_dateWord = internal::loadWord( data );
+			m_minuteWord = internal::loadWord( data + 8 );
+			m_dayTicks = internal::dateToTicks( fields.year, fields.month, fields.day );
+			m_minuteTicks = m_dayTicks + internal::timeToTicks( fields.hour, fields.minute, 0, 0 );
+			m_cached = true;
+		}
+
+		return true;
+	}
+} // namespace nfx::time
@@ -36,6 +36,10 @@
 #include <chrono>
 #include <ctime>
 
+#if defined( __linux__ )
+#	include <time.h>
+#endif
+
 #include "nfx/datetime/DateTime.h"
 #include "nfx/datetime/TimeSpan.h"
 #include "nfx/detail/datetime/Constants.h"
@@ -82,7 +86,7 @@ namespace nfx::time::internal
 	{
 	public:
 		TimeZoneOffsetCache() noexcept
-			: m_cachedHour{ 0 },
+			: m_cachedHour{ -1 }, // No valid DateTime maps to a negative hour key
 			  m_offsetSeconds{ 0 }
 		{
 		}
@@ -95,15 +99,9 @@ namespace nfx::time::internal
 		 */
 		TimeSpan offset( const DateTime& dateTime ) noexcept
 		{
-			// Cache key: year * 1000000 + month * 10000 + day * 100 + hour
+			// Cache key: hours since January 1, 0001
 			// This ensures cache invalidation on DST transitions (which occur at specific hours)
-			const auto year{ dateTime.year() };
-			const auto month{ dateTime.month() };
-			const auto day{ dateTime.day() };
-			const auto hour{ dateTime.hour() };
-
-			const std::int64_t currentHourKey{
-				year * 1000000LL + month * 10000 + day * 100 + hour };
+			const std::int64_t currentHourKey{ dateTime.ticks() / constants::TICKS_PER_HOUR };
 
 			// Fast path: check if cache is valid (lock-free)
 			if ( m_cachedHour.load( std::memory_order_acquire ) == currentHourKey )
@@ -122,7 +120,7 @@ namespace nfx::time::internal
 		}
 
 	private:
-		std::atomic<std::int64_t> m_cachedHour;	   ///< Cached hour key (yyyymmddhh)
+		std::atomic<std::int64_t> m_cachedHour;	   ///< Cached hour key (hours since 0001-01-01)
 		std::atomic<std::int64_t> m_offsetSeconds; ///< Cached offset in seconds
 
 		/**
@@ -186,4 +184,58 @@ namespace nfx::time::internal
 		return cache.offset( dateTime );
 	}
 
+	//----------------------------------------------
+	// Coarse clock
+	//----------------------------------------------
+
+	/**
+	 * @brief Read the kernel's coarse real-time clock
+	 * @param ticks Receives the current UTC time in ticks since 0001-01-01
+	 * @return false if this platform has no coarse clock, in which case ticks is unchanged
+	 * @details CLOCK_REALTIME_COARSE returns the time of the last timer tick from the vDSO
+	 *          data page without reading a hardware counter.
+	 */
+	inline bool coarseUtcTicks( std::int64_t& ticks ) noexcept
+	{
+#if defined( __linux__ ) && defined( CLOCK_REALTIME_COARSE )
+		timespec now;
+		if ( clock_gettime( CLOCK_REALTIME_COARSE, &now ) == 0 )
+		{
+			ticks = constants::UNIX_EPOCH_TICKS + static_cast<std::int64_t>( now.tv_sec ) * constants::TICKS_PER_SECOND +
+					static_cast<std::int64_t>( now.tv_nsec ) / constants::NANOSECONDS_PER_TICK;
+
+			return true;
+		}
+#else
+		static_cast<void>( ticks );
+#endif
+
+		return false;
+	}
+
+	/**
+	 * @brief Get the resolution of the coarse real-time clock
+	 * @param ticks Receives the resolution in ticks, at least one
+	 * @return false if this platform has no coarse clock, in which case ticks is unchanged
+	 */
+	inline bool coarseClockResolutionTicks( std::int64_t& ticks ) noexcept
+	{
+#if defined( __linux__ ) && defined( CLOCK_REALTIME_COARSE )
+		timespec resolution;
+		if ( clock_getres( CLOCK_REALTIME_COARSE, &resolution ) == 0 )
+		{
+			const std::int64_t resolutionTicks{ static_cast<std::int64_t>( resolution.tv_sec ) * constants::TICKS_PER_SECOND +
+												( static_cast<std::int64_t>( resolution.tv_nsec ) + constants::NANOSECONDS_PER_TICK - 1 ) /
+													constants::NANOSECONDS_PER_TICK };
+			ticks = resolutionTicks > 0 ? resolutionTicks : 1;
+
+			return true;
+		}
+#else
+		static_cast<void>( ticks );
+#endif
+
+		return false;
+	}
+
 } // namespace nfx::time::internal
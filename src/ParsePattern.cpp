@@ -0,0 +1,202 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ParsePattern.cpp
+ * @brief Implementation of run-time compiled parse patterns
+ * @details The constructor measures the pattern, sizes the step and literal buffers exactly
+ *          and compiles into them; parsing interprets the steps with the same per-field
+ *          readers as the compile-time patterns.
+ */
+
+#include <stdexcept>
+
+#include "nfx/datetime/ParsePattern.h"
+
+namespace nfx::time
+{
+	namespace
+	{
+		//=====================================================================
+		// Step interpreter
+		//=====================================================================
+
+		/**
+		 * @brief Run one compiled step against the input
+		 * @param step Step to run
+		 * @param literals Literal buffer of the compiled pattern
+		 * @param ptr Current input position, advanced on success
+		 * @param end End of the input
+		 * @param fields Receives the field value
+		 * @return true if the input matched
+		 */
+		bool runParseStep( const internal::ParseStep& step, const char* literals, const char*& ptr, const char* end, internal::ParsedFields& fields ) noexcept
+		{
+			switch ( step.field )
+			{
+				case internal::ParseField::Literal:
+				{
+					if ( end - ptr < step.width )
+					{
+						return false;
+					}
+					for ( std::uint16_t i{ 0 }; i < step.width; ++i )
+					{
+						if ( ptr[i] != literals[step.literalOffset + i] )
+						{
+							return false;
+						}
+					}
+					ptr += step.width;
+
+					return true;
+				}
+				case internal::ParseField::Year:
+				{
+					return internal::parseFixedDigits<4>( ptr, end, fields.year );
+				}
+				case internal::ParseField::Month:
+				{
+					return internal::parseFixedDigits<2>( ptr, end, fields.month );
+				}
+				case internal::ParseField::MonthName:
+				{
+					return internal::parseMonthName( ptr, end, fields.month );
+				}
+				case internal::ParseField::Day:
+				{
+					return internal::parseFixedDigits<2>( ptr, end, fields.day );
+				}
+				case internal::ParseField::DayOfYear:
+				{
+					return internal::parseFixedDigits<3>( ptr, end, fields.dayOfYear );
+				}
+				case internal::ParseField::Hour:
+				{
+					return internal::parseFixedDigits<2>( ptr, end, fields.hour );
+				}
+				case internal::ParseField::Minute:
+				{
+					return internal::parseFixedDigits<2>( ptr, end, fields.minute );
+				}
+				case internal::ParseField::Second:
+				{
+					return internal::parseFixedDigits<2>( ptr, end, fields.second );
+				}
+				case internal::ParseField::Fraction:
+				{
+					return internal::parseFractionDigits( ptr, end, fields.fractionTicks );
+				}
+				case internal::ParseField::Offset:
+				{
+					return internal::parseOffsetField( ptr, end, fields.offsetMinutes );
+				}
+			}
+
+			return false;
+		}
+	} // namespace
+
+	//=====================================================================
+	// ParsePattern class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	ParsePattern::ParsePattern( std::string_view pattern )
+		: m_pattern{ pattern }
+	{
+		internal::ParsePatternSize size{};
+		if ( const char* error{ internal::compileParsePattern( pattern, nullptr, nullptr, size ) } )
+		{
+			throw std::invalid_argument{ error };
+		}
+
+		m_steps.resize( size.steps );
+		m_literals.resize( size.literals );
+		internal::compileParsePattern( pattern, m_steps.data(), m_literals.data(), size );
+	}
+
+	//----------------------------------------------
+	// Parsing
+	//----------------------------------------------
+
+	bool ParsePattern::parse( std::string_view text, DateTime& result ) const noexcept
+	{
+		std::int64_t ticks{ 0 };
+		std::int32_t offsetMinutes{ 0 };
+		if ( !parseTicks( text, ticks, offsetMinutes ) )
+		{
+			return false;
+		}
+
+		result = DateTime{ ticks };
+
+		return true;
+	}
+
+	bool ParsePattern::parse( std::string_view text, DateTimeOffset& result ) const noexcept
+	{
+		std::int64_t ticks{ 0 };
+		std::int32_t offsetMinutes{ 0 };
+		if ( !parseTicks( text, ticks, offsetMinutes ) )
+		{
+			return false;
+		}
+
+		result = DateTimeOffset{ ticks, TimeSpan{ offsetMinutes * constants::TICKS_PER_MINUTE } };
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Implementation
+	//----------------------------------------------
+
+	bool ParsePattern::parseTicks( std::string_view text, std::int64_t& ticks, std::int32_t& offsetMinutes ) const noexcept
+	{
+		const char* ptr{ text.data() };
+		const char* end{ ptr + text.size() };
+		const char* literals{ m_literals.data() };
+		internal::ParsedFields fields{};
+
+		for ( const internal::ParseStep& step : m_steps )
+		{
+			if ( !runParseStep( step, literals, ptr, end, fields ) )
+			{
+				return false;
+			}
+		}
+
+		if ( ptr != end || !internal::resolveParsedFields( fields, ticks ) )
+		{
+			return false;
+		}
+		offsetMinutes = fields.offsetMinutes;
+
+		return true;
+	}
+} // namespace nfx::time
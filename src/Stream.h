@@ -0,0 +1,159 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Stream.h
+ * @brief Internal allocation-free helpers behind the stream operators
+ * @details operator>> reads one whitespace-delimited token exactly as `is >> std::string`
+ *          would, honouring skipws and width(), but into a stack buffer. Only a token longer
+ *          than the buffer, which no formatter ever produces, spills into a std::string so
+ *          that the accepted input stays the same. Not part of the public API.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <locale>
+#include <streambuf>
+#include <string>
+#include <string_view>
+
+namespace nfx::time::internal
+{
+	//=====================================================================
+	// Stream extraction
+	//=====================================================================
+
+	/** @brief Stack buffer for one extracted token; longer than any string the formatters write */
+	inline constexpr std::size_t STREAM_TOKEN_LENGTH{ 64 };
+
+	/** @brief Reset a stream's cached ctype facet when its locale or format state is replaced */
+	inline void clearCachedCtype( std::ios_base::event event, std::ios_base& stream, int index )
+	{
+		if ( event == std::ios_base::imbue_event || event == std::ios_base::copyfmt_event )
+		{
+			stream.pword( index ) = nullptr;
+		}
+	}
+
+	/**
+	 * @brief Get the ctype facet of a stream's locale
+	 * @details `std::use_facet( is.getloc() )` copies the locale and costs a dynamic_cast, which
+	 *          is as much as parsing the token itself. The facet is therefore cached in a
+	 *          pword() slot of the stream and dropped again by a callback on imbue() and
+	 *          copyfmt().
+	 */
+	inline const std::ctype<char>& streamCtype( std::ios_base& stream )
+	{
+		static const int index{ std::ios_base::xalloc() };
+
+		void*& slot{ stream.pword( index ) };
+		if ( slot == nullptr )
+		{
+			slot = const_cast<std::ctype<char>*>( &std::use_facet<std::ctype<char>>( stream.getloc() ) );
+			if ( stream.iword( index ) == 0 )
+			{
+				stream.register_callback( clearCachedCtype, index );
+				stream.iword( index ) = 1;
+			}
+		}
+
+		return *static_cast<const std::ctype<char>*>( slot );
+	}
+
+	/**
+	 * @brief Extract one whitespace-delimited token and parse it
+	 * @param is Input stream
+	 * @param parse Callable taking the token as std::string_view and returning true on success
+	 * @return is, with failbit set if no token was read or parse returned false, and eofbit set
+	 *         if the end of the stream was reached, as for `is >> std::string`
+	 */
+	template <typename Parse>
+	std::istream& extractToken( std::istream& is, Parse&& parse )
+	{
+		const std::istream::sentry sentry{ is };
+		if ( !sentry )
+		{
+			return is;
+		}
+
+		using Traits = std::istream::traits_type;
+		const auto& ctype{ streamCtype( is ) };
+		const std::streamsize width{ is.width() };
+		const std::size_t limit{ width > 0 ? static_cast<std::size_t>( width ) : static_cast<std::size_t>( -1 ) };
+
+		char buffer[STREAM_TOKEN_LENGTH];
+		std::string spill;
+		std::size_t length{ 0 };
+		std::ios::iostate state{ std::ios::goodbit };
+		std::streambuf* const buf{ is.rdbuf() };
+
+		// sgetc()/snextc() only, like the generic `is >> std::string`, so that unbuffered
+		// stream buffers (underflow() without setg()) work as well as buffered ones
+		Traits::int_type next{ buf->sgetc() };
+		while ( length < limit )
+		{
+			if ( Traits::eq_int_type( next, Traits::eof() ) )
+			{
+				state |= std::ios::eofbit;
+
+				break;
+			}
+
+			const char c{ Traits::to_char_type( next ) };
+			if ( ctype.is( std::ctype_base::space, c ) )
+			{
+				break;
+			}
+
+			if ( length < STREAM_TOKEN_LENGTH )
+			{
+				buffer[length] = c;
+			}
+			else
+			{
+				if ( spill.empty() )
+				{
+					spill.assign( buffer, length );
+				}
+				spill.push_back( c );
+			}
+			++length;
+			next = buf->snextc();
+		}
+		is.width( 0 );
+
+		if ( length == 0 || !parse( spill.empty() ? std::string_view{ buffer, length } : std::string_view{ spill } ) )
+		{
+			state |= std::ios::failbit;
+		}
+		if ( state != std::ios::goodbit )
+		{
+			is.setstate( state );
+		}
+
+		return is;
+	}
+} // namespace nfx::time::internal
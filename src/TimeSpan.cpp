@@ -30,13 +30,13 @@
  *          functionality for time intervals with 100-nanosecond precision.
  */
 
-#include <charconv>
-#include <iomanip>
-#include <sstream>
+#include <istream>
+#include <ostream>
 #include <string>
-#include <vector>
 
 #include "nfx/datetime/TimeSpan.h"
+#include "FastFormat.h"
+#include "Stream.h"
 
 namespace nfx::time
 {
@@ -48,84 +48,77 @@ namespace nfx::time
 	// String formatting
 	//----------------------------------------------
 
-	std::string TimeSpan::toString() const
+	std::to_chars_result TimeSpan::toChars( char* first, char* last ) const noexcept
 	{
-		std::ostringstream oss;
+		char staging[internal::FORMAT_BUFFER_LENGTH];
+		char* const target{ internal::formatTarget( first, last, staging ) };
+		char* out{ target };
+
+		// Magnitude in unsigned arithmetic so that the most negative span has one too
+		const bool isNegative{ m_ticks < 0 };
+		const std::uint64_t absTicks{ isNegative ? 0ULL - static_cast<std::uint64_t>( m_ticks ) : static_cast<std::uint64_t>( m_ticks ) };
+		const std::uint64_t totalSeconds{ absTicks / constants::TICKS_PER_SECOND };
+		const auto fractionalTicks{ static_cast<std::int32_t>( absTicks % constants::TICKS_PER_SECOND ) };
+
+		// Break down into days, hours, minutes, seconds
+		const std::uint64_t days{ totalSeconds / constants::SECONDS_PER_DAY };
+		const auto remainingSeconds{ static_cast<std::int32_t>( totalSeconds % constants::SECONDS_PER_DAY ) };
+		const std::int32_t hours{ remainingSeconds / constants::SECONDS_PER_HOUR };
+		const std::int32_t minutes{ ( remainingSeconds % constants::SECONDS_PER_HOUR ) / constants::SECONDS_PER_MINUTE };
+		const std::int32_t seconds{ remainingSeconds % constants::SECONDS_PER_MINUTE };
 
-		// Handle negative durations
-		bool isNegative{ m_ticks < 0 };
 		if ( isNegative )
 		{
-			oss << "-";
+			*out++ = '-';
 		}
+		*out++ = 'P';
 
-		oss << "P";
-
-		std::int64_t absTicks{ std::abs( m_ticks ) };
-		std::int64_t totalSeconds{ absTicks / constants::TICKS_PER_SECOND };
-
-		// Break down into days, hours, minutes, seconds
-		std::int32_t days{ static_cast<std::int32_t>( totalSeconds / constants::SECONDS_PER_DAY ) };
-		std::int32_t remainingSeconds{ static_cast<std::int32_t>( totalSeconds % constants::SECONDS_PER_DAY ) };
-		std::int32_t hours{ remainingSeconds / constants::SECONDS_PER_HOUR };
-		std::int32_t minutes{ ( remainingSeconds % constants::SECONDS_PER_HOUR ) / constants::SECONDS_PER_MINUTE };
-		std::int32_t seconds{ remainingSeconds % constants::SECONDS_PER_MINUTE };
-
-		// Output days if present
 		if ( days > 0 )
 		{
-			oss << days << "D";
+			out = std::to_chars( out, out + 20, days ).ptr;
+			*out++ = 'D';
 		}
 
-		// Check if we have any time components
-		std::int64_t fractionalTicks{ absTicks % constants::TICKS_PER_SECOND };
-		bool hasTimeComponent{ hours > 0 || minutes > 0 || seconds > 0 || fractionalTicks > 0 };
-
-		// Only output time component if present
-		if ( hasTimeComponent )
+		if ( remainingSeconds > 0 || fractionalTicks > 0 )
 		{
-			oss << "T";
-
+			*out++ = 'T';
 			if ( hours > 0 )
 			{
-				oss << hours << "H";
+				out = internal::writeUnpadded( out, hours );
+				*out++ = 'H';
 			}
-
 			if ( minutes > 0 )
 			{
-				oss << minutes << "M";
+				out = internal::writeUnpadded( out, minutes );
+				*out++ = 'M';
 			}
-
-			// Include seconds with or without fractional part
 			if ( seconds > 0 || fractionalTicks > 0 )
 			{
+				out = internal::writeUnpadded( out, seconds );
 				if ( fractionalTicks > 0 )
 				{
-					// Format fractional seconds directly to avoid allocations
-					char fracBuffer[8];
-					std::snprintf( fracBuffer, sizeof( fracBuffer ), "%07lld", static_cast<long long>( fractionalTicks ) );
-
-					// Strip trailing zeros
-					std::size_t fracLen{ 7 };
-					while ( fracLen > 1 && fracBuffer[fracLen - 1] == '0' )
-					{
-						fracBuffer[--fracLen] = '\0';
-					}
-
-					oss << seconds << "." << fracBuffer << "S";
-				}
-				else
-				{
-					oss << seconds << "S";
+					out = internal::writeTrimmedFraction( out, fractionalTicks );
 				}
+				*out++ = 'S';
 			}
 		}
 		else if ( days == 0 )
 		{
-			// No days and no time components: output PT0S for zero duration
-			oss << "T0S";
+			// No days and no time components: PT0S for zero duration
+			*out++ = 'T';
+			*out++ = '0';
+			*out++ = 'S';
 		}
-		return oss.str();
+
+		return internal::finishFormat( target, out, first, last );
+	}
+
+	std::string TimeSpan::toString() const
+	{
+		char buffer[internal::FORMAT_BUFFER_LENGTH];
+		const auto result{ toChars( buffer, buffer + sizeof( buffer ) ) };
+
+		return std::string( buffer, result.ptr );
 	}
 
 	//----------------------------------------------
@@ -134,184 +127,15 @@ namespace nfx::time
 
 	bool TimeSpan::fromString( std::string_view iso8601DurationString, TimeSpan& result ) noexcept
 	{
-		if ( iso8601DurationString.empty() )
-		{
-			return false;
-		}
-
-		// Handle numeric seconds format (convenience)
-		if ( iso8601DurationString.find_first_not_of( "0123456789.-" ) == std::string_view::npos )
+		std::int64_t ticks{ 0 };
+		if ( !internal::parseTimeSpan( iso8601DurationString, ticks ) )
 		{
-			double seconds{};
-			auto [ptr, ec] = std::from_chars( iso8601DurationString.data(), iso8601DurationString.data() + iso8601DurationString.size(), seconds );
-			if ( ec == std::errc{} && ptr == iso8601DurationString.data() + iso8601DurationString.size() )
-			{
-				result = TimeSpan::fromSeconds( seconds );
-				return true;
-			}
 			return false;
 		}
 
-		// Check for negative sign
-		bool isNegative{ false };
-		std::string_view parseStr{ iso8601DurationString };
-		if ( !parseStr.empty() && parseStr[0] == '-' )
-		{
-			isNegative = true;
-			parseStr = parseStr.substr( 1 );
-		}
-
-		if ( parseStr.length() > 1 && parseStr[0] == 'P' )
-		{
-			double days{ 0.0 };
-			double totalSeconds{ 0.0 };
-			bool foundComponent{ false };
-
-			// Parse days component (P[n]D)
-			auto tPos{ parseStr.find( 'T' ) };
-
-			// Parse date part (before T, or entire string if no T)
-			auto datePart{ tPos != std::string_view::npos ? parseStr.substr( 1, tPos - 1 ) : parseStr.substr( 1 ) };
-			if ( !datePart.empty() )
-			{
-				auto dPos{ datePart.find( 'D' ) };
-				if ( dPos != std::string_view::npos )
-				{
-					auto dayStr{ datePart.substr( 0, dPos ) };
-					auto [ptr, ec] = std::from_chars( dayStr.data(), dayStr.data() + dayStr.size(), days );
-					if ( ec == std::errc{} && ptr == dayStr.data() + dayStr.size() )
-					{
-						foundComponent = true;
-					}
-					else
-					{
-						return false;
-					}
-				}
-			}
+		result = TimeSpan{ ticks };
 
-			// Parse time part after T (if present)
-			if ( tPos != std::string_view::npos )
-			{
-				auto timePart{ parseStr.substr( tPos + 1 ) };
-				auto originalTimePart{ timePart }; // Keep original for position tracking
-
-				// Must have at least one component after T (not just "PT")
-				if ( timePart.empty() )
-				{
-					return false;
-				}
-
-				// Find all component positions in the original string for order validation
-				auto hPos{ originalTimePart.find( 'H' ) };
-				auto mPos{ originalTimePart.find( 'M' ) };
-				auto sPos{ originalTimePart.find( 'S' ) };
-
-				// Detect duplicate components
-				if ( hPos != std::string_view::npos && originalTimePart.find( 'H', hPos + 1 ) != std::string_view::npos )
-				{
-					return false; // Duplicate hours
-				}
-				if ( mPos != std::string_view::npos && originalTimePart.find( 'M', mPos + 1 ) != std::string_view::npos )
-				{
-					return false; // Duplicate minutes
-				}
-				if ( sPos != std::string_view::npos && originalTimePart.find( 'S', sPos + 1 ) != std::string_view::npos )
-				{
-					return false; // Duplicate seconds
-				}
-
-				// Validate component order (H before M before S)
-				if ( hPos != std::string_view::npos && mPos != std::string_view::npos && hPos > mPos )
-				{
-					return false; // Minutes before hours
-				}
-				if ( hPos != std::string_view::npos && sPos != std::string_view::npos && hPos > sPos )
-				{
-					return false; // Seconds before hours
-				}
-				if ( mPos != std::string_view::npos && sPos != std::string_view::npos && mPos > sPos )
-				{
-					return false; // Seconds before minutes
-				}
-
-				// Parse hours
-				if ( hPos != std::string_view::npos )
-				{
-					auto hourStr{ timePart.substr( 0, hPos ) };
-					double hours{};
-					auto [ptr, ec] = std::from_chars( hourStr.data(), hourStr.data() + hourStr.size(), hours );
-					if ( ec == std::errc{} && ptr == hourStr.data() + hourStr.size() )
-					{
-						totalSeconds += hours * static_cast<double>( constants::SECONDS_PER_HOUR );
-						timePart = timePart.substr( hPos + 1 );
-						foundComponent = true;
-					}
-					else
-					{
-						return false;
-					}
-				}
-
-				// Parse minutes (recalculate position in current timePart)
-				mPos = timePart.find( 'M' );
-				if ( mPos != std::string::npos )
-				{
-					auto minuteStr{ timePart.substr( 0, mPos ) };
-					double minutes{};
-					auto [ptr, ec] = std::from_chars( minuteStr.data(), minuteStr.data() + minuteStr.size(), minutes );
-					if ( ec == std::errc{} && ptr == minuteStr.data() + minuteStr.size() )
-					{
-						totalSeconds += minutes * static_cast<double>( constants::SECONDS_PER_MINUTE );
-						timePart = timePart.substr( mPos + 1 );
-						foundComponent = true;
-					}
-					else
-					{
-						return false;
-					}
-				}
-
-				// Parse seconds (recalculate position in current timePart)
-				sPos = timePart.find( 'S' );
-				if ( sPos != std::string::npos )
-				{
-					auto secondStr{ timePart.substr( 0, sPos ) };
-					double seconds{};
-					auto [ptr, ec] = std::from_chars( secondStr.data(), secondStr.data() + secondStr.size(), seconds );
-					if ( ec == std::errc{} && ptr == secondStr.data() + secondStr.size() )
-					{
-						totalSeconds += seconds;
-						foundComponent = true;
-					}
-					else
-					{
-						return false;
-					}
-				}
-			}
-
-			// Must have parsed at least one valid component (D, H, M, or S)
-			if ( !foundComponent )
-			{
-				return false;
-			}
-
-			// Convert days to seconds
-			totalSeconds += days * static_cast<double>( constants::SECONDS_PER_DAY );
-
-			// Apply negative sign if present
-			if ( isNegative )
-			{
-				totalSeconds = -totalSeconds;
-			}
-
-			result = TimeSpan::fromSeconds( totalSeconds );
-
-			return true;
-		}
-
-		return false;
+		return true;
 	}
 
 	std::optional<TimeSpan> TimeSpan::fromString( std::string_view iso8601DurationString ) noexcept
@@ -357,20 +181,14 @@ namespace nfx::time
 
 	std::ostream& operator<<( std::ostream& os, const TimeSpan& timeSpan )
 	{
-		os << timeSpan.toString();
+		char buffer[internal::FORMAT_BUFFER_LENGTH];
+		const auto result{ timeSpan.toChars( buffer, buffer + sizeof( buffer ) ) };
 
-		return os;
+		return os << std::string_view{ buffer, static_cast<std::size_t>( result.ptr - buffer ) };
 	}
 
 	std::istream& operator>>( std::istream& is, TimeSpan& timeSpan )
 	{
-		std::string str;
-		is >> str;
-		if ( !TimeSpan::fromString( str, timeSpan ) )
-		{
-			is.setstate( std::ios::failbit );
-		}
-
-		return is;
+		return internal::extractToken( is, [&timeSpan]( std::string_view token ) { return TimeSpan::fromString( token, timeSpan ); } );
 	}
 } // namespace nfx::time
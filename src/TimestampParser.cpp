@@ -0,0 +1,352 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimestampParser.cpp
+ * @brief Implementation of the layout-learning ISO 8601 parser
+ * @details The YYYY-MM-DDTHH:MM:SS prefix is matched by the canonical SWAR fast path in
+ *          FastParse.h. What follows it is learned as a per-position template (digit or
+ *          literal byte) compiled into masks over at most two overlapping 8-byte words.
+ */
+
+#include <bit>
+#include <initializer_list>
+
+#include "nfx/datetime/TimestampParser.h"
+#include "FastParse.h"
+
+namespace nfx::time
+{
+	namespace
+	{
+		//=====================================================================
+		// Layout helpers
+		//=====================================================================
+
+		/** @brief Role of one byte position in a layout */
+		enum class Lane : std::uint8_t
+		{
+			/** @brief Checked elsewhere: the canonical prefix and the offset sign */
+			Unchecked,
+
+			/** @brief '0'-'9' */
+			Digit,
+
+			/** @brief The byte seen when the layout was learned */
+			Literal
+		};
+
+		/** @brief Digit value at a position already checked to hold a digit */
+		inline std::int32_t digitAt( const char* data, std::size_t position ) noexcept
+		{
+			return data[position] - '0';
+		}
+
+		/** @brief Two-digit value at a position */
+		inline std::int32_t twoDigitsAt( const char* data, std::size_t position ) noexcept
+		{
+			return digitAt( data, position ) * 10 + digitAt( data, position + 1 );
+		}
+	} // namespace
+
+	//=====================================================================
+	// TimestampParser class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Parsing
+	//----------------------------------------------
+
+	bool TimestampParser::parse( std::string_view iso8601String, DateTime& result ) noexcept
+	{
+		std::int64_t ticks;
+		std::int64_t offsetTicks;
+		if ( m_layout.length != 0 && parseLearned( iso8601String, ticks, offsetTicks ) )
+		{
+			++m_hits;
+			result = DateTime{ ticks };
+
+			return true;
+		}
+
+		++m_misses;
+		if ( !DateTime::fromString( iso8601String, result ) )
+		{
+			return false;
+		}
+
+		learn( iso8601String );
+
+		return true;
+	}
+
+	bool TimestampParser::parse( std::string_view iso8601String, DateTimeOffset& result ) noexcept
+	{
+		std::int64_t ticks;
+		std::int64_t offsetTicks;
+		if ( m_layout.length != 0 && parseLearned( iso8601String, ticks, offsetTicks ) )
+		{
+			++m_hits;
+			result = DateTimeOffset{ ticks, TimeSpan{ offsetTicks } };
+
+			return true;
+		}
+
+		++m_misses;
+		if ( !DateTimeOffset::fromString( iso8601String, result ) )
+		{
+			return false;
+		}
+
+		learn( iso8601String );
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Implementation
+	//----------------------------------------------
+
+	bool TimestampParser::parseLearned( std::string_view iso8601String, std::int64_t& ticks, std::int64_t& offsetTicks ) const noexcept
+	{
+		const auto& layout{ m_layout };
+		if ( iso8601String.size() != layout.length )
+		{
+			return false;
+		}
+
+		const char* data{ iso8601String.data() };
+		internal::CanonicalFields fields;
+		if ( !internal::parseCanonicalPrefix( data, fields ) )
+		{
+			return false;
+		}
+
+		for ( std::size_t w{ 0 }; w < layout.wordCount; ++w )
+		{
+			if ( !internal::matchesShape( internal::loadWord( data + layout.wordOffsets[w] ), layout.digitLanes[w], layout.checkedLanes[w], layout.literals[w] ) )
+			{
+				return false;
+			}
+		}
+
+		if ( !internal::isValidDate( fields.year, fields.month, fields.day ) || !internal::isValidTime( fields.hour, fields.minute, fields.second, 0 ) )
+		{
+			return false;
+		}
+
+		std::int32_t fractionTicks{ 0 };
+		for ( std::size_t i{ 0 }; i < layout.fractionDigits; ++i )
+		{
+			fractionTicks = fractionTicks * 10 + digitAt( data, internal::CANONICAL_PREFIX_LENGTH + 1 + i );
+		}
+		constexpr std::int32_t scales[]{ 1, 1000000, 100000, 10000, 1000, 100, 10, 1 };
+		fractionTicks *= scales[layout.fractionDigits];
+
+		std::int32_t offsetMinutes{ 0 };
+		if ( layout.offsetStyle != OffsetStyle::None && layout.offsetStyle != OffsetStyle::Utc )
+		{
+			const char sign{ data[layout.offsetPosition] };
+			if ( sign != '+' && sign != '-' )
+			{
+				return false;
+			}
+
+			const std::int32_t hours{ twoDigitsAt( data, layout.offsetPosition + 1u ) };
+			std::int32_t minutes{ 0 };
+			switch ( layout.offsetStyle )
+			{
+				case OffsetStyle::HoursColonMinutes:
+				{
+					minutes = twoDigitsAt( data, layout.offsetPosition + 4u );
+
+					break;
+				}
+				case OffsetStyle::HoursMinutes:
+				{
+					minutes = twoDigitsAt( data, layout.offsetPosition + 3u );
+
+					break;
+				}
+				default:
+				{
+					break;
+				}
+			}
+
+			if ( hours > 14 || minutes > 59 || ( hours == 14 && minutes > 0 ) )
+			{
+				return false;
+			}
+
+			const std::int32_t totalMinutes{ hours * constants::MINUTES_PER_HOUR + minutes };
+			offsetMinutes = sign == '-' ? -totalMinutes : totalMinutes;
+		}
+
+		ticks = internal::dateToTicks( fields.year, fields.month, fields.day ) + internal::timeToTicks( fields.hour, fields.minute, fields.second, 0 ) + fractionTicks;
+		offsetTicks = offsetMinutes * constants::TICKS_PER_MINUTE;
+
+		return true;
+	}
+
+	void TimestampParser::learn( std::string_view iso8601String ) noexcept
+	{
+		m_layout = Layout{};
+
+		const auto length{ iso8601String.size() };
+		if constexpr ( std::endian::native != std::endian::little )
+		{
+			return;
+		}
+		if ( length < internal::CANONICAL_PREFIX_LENGTH || length > MAX_LAYOUT_LENGTH )
+		{
+			return;
+		}
+
+		// Per-position template of everything after the YYYY-MM-DDTHH:MM:SS prefix, which
+		// parseCanonicalPrefix() checks; literal bytes are copied from the string
+		internal::CanonicalFields fields;
+		const char* data{ iso8601String.data() };
+		if ( !internal::parseCanonicalPrefix( data, fields ) )
+		{
+			return;
+		}
+		std::array<Lane, MAX_LAYOUT_LENGTH> lanes{};
+
+		// Fraction of 1-7 digits
+		std::size_t position{ internal::CANONICAL_PREFIX_LENGTH };
+		Layout layout;
+		if ( position < length && data[position] == '.' )
+		{
+			lanes[position++] = Lane::Literal;
+			while ( position < length && internal::isDigit( data[position] ) )
+			{
+				lanes[position++] = Lane::Digit;
+			}
+
+			const auto digits{ position - internal::CANONICAL_PREFIX_LENGTH - 1 };
+			if ( digits == 0 || digits > 7 )
+			{
+				return;
+			}
+			layout.fractionDigits = static_cast<std::uint8_t>( digits );
+		}
+
+		// Offset suffix
+		const std::string_view suffix{ iso8601String.substr( position ) };
+		layout.offsetPosition = static_cast<std::uint8_t>( position );
+		const auto digitsAt{ [&]( std::initializer_list<std::size_t> offsets ) {
+			for ( const auto offset : offsets )
+			{
+				if ( !internal::isDigit( suffix[offset] ) )
+				{
+					return false;
+				}
+				lanes[position + offset] = Lane::Digit;
+			}
+
+			return true;
+		} };
+
+		if ( suffix.empty() )
+		{
+			layout.offsetStyle = OffsetStyle::None;
+		}
+		else if ( suffix == "Z" )
+		{
+			layout.offsetStyle = OffsetStyle::Utc;
+			lanes[position] = Lane::Literal;
+		}
+		else if ( ( suffix[0] == '+' || suffix[0] == '-' ) && ( suffix.size() == 3 || suffix.size() == 5 || suffix.size() == 6 ) )
+		{
+			if ( !digitsAt( { 1, 2 } ) )
+			{
+				return;
+			}
+
+			if ( suffix.size() == 3 )
+			{
+				layout.offsetStyle = OffsetStyle::Hours;
+			}
+			else if ( suffix.size() == 5 )
+			{
+				layout.offsetStyle = OffsetStyle::HoursMinutes;
+				if ( !digitsAt( { 3, 4 } ) )
+				{
+					return;
+				}
+			}
+			else
+			{
+				layout.offsetStyle = OffsetStyle::HoursColonMinutes;
+				if ( suffix[3] != ':' || !digitsAt( { 4, 5 } ) )
+				{
+					return;
+				}
+				lanes[position + 3] = Lane::Literal;
+			}
+		}
+		else
+		{
+			return;
+		}
+
+		// Compile the suffix template into word masks; the last word ends with the string
+		const auto suffixLength{ length - internal::CANONICAL_PREFIX_LENGTH };
+		layout.wordCount = static_cast<std::uint8_t>( ( suffixLength + 7 ) / 8 );
+		for ( std::size_t w{ 0 }; w < layout.wordCount; ++w )
+		{
+			const std::size_t offset{ w + 1 == layout.wordCount ? length - 8 : internal::CANONICAL_PREFIX_LENGTH + w * 8 };
+			layout.wordOffsets[w] = static_cast<std::uint8_t>( offset );
+			for ( std::size_t lane{ 0 }; lane < 8; ++lane )
+			{
+				const std::uint64_t laneMask{ 0xFFULL << ( 8 * lane ) };
+				switch ( lanes[offset + lane] )
+				{
+					case Lane::Digit:
+					{
+						layout.digitLanes[w] |= laneMask;
+						layout.checkedLanes[w] |= laneMask;
+
+						break;
+					}
+					case Lane::Literal:
+					{
+						layout.checkedLanes[w] |= laneMask;
+						layout.literals[w] |= static_cast<std::uint64_t>( static_cast<unsigned char>( data[offset + lane] ) ) << ( 8 * lane );
+
+						break;
+					}
+					case Lane::Unchecked:
+					{
+						break;
+					}
+				}
+			}
+		}
+
+		layout.length = static_cast<std::uint8_t>( length );
+		m_layout = layout;
+	}
+} // namespace nfx::time
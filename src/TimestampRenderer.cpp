@@ -0,0 +1,98 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimestampRenderer.cpp
+ * @brief Implementation of the prefix-caching ISO 8601 extended renderer
+ * @details A hit is one unsigned compare against the cached period, a 19-byte copy and the
+ *          fraction writer shared with DateTime::toChars(), so both produce the same bytes.
+ */
+
+#include <cstring>
+
+#include "nfx/datetime/TimestampRenderer.h"
+#include "FastFormat.h"
+
+namespace nfx::time
+{
+	namespace
+	{
+		/** @brief Length of "YYYY-MM-DDTHH:MM:SS" */
+		constexpr std::size_t PREFIX_LENGTH{ 19 };
+
+		/** @brief Position of the seconds digits in the prefix */
+		constexpr std::size_t SECOND_POSITION{ 17 };
+	} // namespace
+
+	//=====================================================================
+	// TimestampRenderer class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Rendering
+	//----------------------------------------------
+
+	std::to_chars_result TimestampRenderer::render( const DateTime& value, char* first, char* last ) noexcept
+	{
+		const std::int64_t ticks{ value.ticks() };
+		if ( m_cached && static_cast<std::uint64_t>( ticks - m_periodStart ) < static_cast<std::uint64_t>( m_periodTicks ) )
+		{
+			++m_hits;
+		}
+		else
+		{
+			++m_misses;
+			refresh( ticks );
+		}
+
+		char staging[MAX_LENGTH];
+		char* const target{ static_cast<std::size_t>( last - first ) >= MAX_LENGTH ? first : staging };
+		const std::int64_t periodTicks{ ticks - m_periodStart };
+
+		std::memcpy( target, m_prefix, PREFIX_LENGTH );
+		if ( m_periodTicks != constants::TICKS_PER_SECOND )
+		{
+			internal::writeDigitPair( target + SECOND_POSITION, static_cast<std::int32_t>( periodTicks / constants::TICKS_PER_SECOND ) );
+		}
+		char* out{ internal::writeTrimmedFraction( target + PREFIX_LENGTH, static_cast<std::int32_t>( periodTicks % constants::TICKS_PER_SECOND ) ) };
+		*out++ = 'Z';
+
+		return internal::finishFormat( target, out, first, last );
+	}
+
+	//----------------------------------------------
+	// Implementation
+	//----------------------------------------------
+
+	void TimestampRenderer::refresh( std::int64_t ticks ) noexcept
+	{
+		m_periodStart = ticks - ticks % m_periodTicks;
+		m_cached = true;
+
+		const DateTime::Components c{ DateTime{ m_periodStart }.components() };
+		char* out{ internal::writeDate( m_prefix, c ) };
+		*out++ = 'T';
+		internal::writeTime( out, c );
+	}
+} // namespace nfx::time
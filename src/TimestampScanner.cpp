@@ -0,0 +1,393 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimestampScanner.cpp
+ * @brief Implementation of streaming CSV/NDJSON timestamp extraction
+ * @details Line boundaries and CSV delimiters are located with a single byte-search kernel
+ *          that returns the n-th occurrence of a byte: 32 bytes are compared per step and
+ *          whole blocks are skipped by population count, so a CSV column is reached without
+ *          visiting the delimiters before it one by one. JSON keys are located by comparing
+ *          two needle bytes at 32 positions per step. The scalar level relies on std::memchr
+ *          and std::string_view::find.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+#include "nfx/datetime/Batch.h"
+#include "nfx/datetime/TimestampScanner.h"
+#include "CpuFeatures.h"
+#include "FastParse.h"
+
+namespace nfx::time
+{
+	namespace
+	{
+		//=====================================================================
+		// Byte search kernels
+		//=====================================================================
+
+		/**
+		 * @brief Find the n-th occurrence (zero-based) of a byte
+		 * @return Pointer to the occurrence, or nullptr if [first, last) holds n or fewer
+		 */
+		const char* findNthScalar( const char* first, const char* last, char byte, std::size_t n ) noexcept
+		{
+			while ( first != last )
+			{
+				const auto* found{ static_cast<const char*>( std::memchr( first, byte, static_cast<std::size_t>( last - first ) ) ) };
+				if ( found == nullptr || n == 0 )
+				{
+					return found;
+				}
+
+				--n;
+				first = found + 1;
+			}
+
+			return nullptr;
+		}
+
+#if NFX_DATETIME_X86_64
+		/** @brief AVX2 variant of findNthScalar(), 32 bytes per step */
+		NFX_DATETIME_TARGET( "avx2" ) const char* findNthAvx2( const char* first, const char* last, char byte, std::size_t n ) noexcept
+		{
+			const __m256i needle{ _mm256_set1_epi8( byte ) };
+			for ( ; last - first >= 32; first += 32 )
+			{
+				const __m256i block{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( first ) ) };
+				const auto mask{ static_cast<std::uint32_t>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( block, needle ) ) ) };
+				const auto hits{ static_cast<std::size_t>( std::popcount( mask ) ) };
+				if ( n < hits )
+				{
+					auto remaining{ mask };
+					for ( ; n > 0; --n )
+					{
+						remaining &= remaining - 1;
+					}
+
+					return first + std::countr_zero( remaining );
+				}
+
+				n -= hits;
+			}
+
+			return findNthScalar( first, last, byte, n );
+		}
+#endif
+
+#if NFX_DATETIME_X86_64
+		/**
+		 * @brief AVX2 substring search comparing two needle bytes per position
+		 * @details Filters 32 candidate positions at once on the first byte and the byte before
+		 *          the last, then confirms each surviving candidate with memcmp.
+		 */
+		NFX_DATETIME_TARGET( "avx2" ) std::size_t findSubstringAvx2( std::string_view haystack, std::string_view needle, std::size_t from ) noexcept
+		{
+			const std::size_t probe{ needle.size() - 2 };
+			const __m256i first{ _mm256_set1_epi8( needle.front() ) };
+			const __m256i second{ _mm256_set1_epi8( needle[probe] ) };
+			const char* data{ haystack.data() };
+
+			std::size_t i{ from };
+			for ( ; i + probe + 32 <= haystack.size(); i += 32 )
+			{
+				const __m256i atFirst{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( data + i ) ) };
+				const __m256i atSecond{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( data + i + probe ) ) };
+				auto mask{ static_cast<std::uint32_t>( _mm256_movemask_epi8(
+					_mm256_and_si256( _mm256_cmpeq_epi8( atFirst, first ), _mm256_cmpeq_epi8( atSecond, second ) ) ) ) };
+				for ( ; mask != 0; mask &= mask - 1 )
+				{
+					const std::size_t candidate{ i + static_cast<std::size_t>( std::countr_zero( mask ) ) };
+					if ( candidate + needle.size() <= haystack.size() && std::memcmp( data + candidate, needle.data(), needle.size() ) == 0 )
+					{
+						return candidate;
+					}
+				}
+			}
+
+			return haystack.find( needle, i );
+		}
+#endif
+
+		/**
+		 * @brief Find a quoted key (at least three bytes) in a line
+		 * @return Position of the match, or std::string_view::npos
+		 */
+		inline std::size_t findSubstring( batch::SimdLevel level, std::string_view haystack, std::string_view needle, std::size_t from ) noexcept
+		{
+#if NFX_DATETIME_X86_64
+			if ( level != batch::SimdLevel::Scalar )
+			{
+				return findSubstringAvx2( haystack, needle, from );
+			}
+#endif
+			static_cast<void>( level );
+
+			return haystack.find( needle, from );
+		}
+
+		/** @brief Dispatch findNth to the kernel for the given level */
+		inline const char* findNth( batch::SimdLevel level, const char* first, const char* last, char byte, std::size_t n ) noexcept
+		{
+#if NFX_DATETIME_X86_64
+			if ( level != batch::SimdLevel::Scalar )
+			{
+				return findNthAvx2( first, last, byte, n );
+			}
+#endif
+			static_cast<void>( level );
+
+			return findNthScalar( first, last, byte, n );
+		}
+
+		//=====================================================================
+		// Field extraction
+		//=====================================================================
+
+		/** @brief Whether a byte is JSON insignificant whitespace */
+		inline bool isJsonSpace( char c ) noexcept
+		{
+			return c == ' ' || c == '\t' || c == '\r';
+		}
+
+		/** @brief Skip JSON whitespace */
+		inline const char* skipJsonSpace( const char* ptr, const char* end ) noexcept
+		{
+			while ( ptr != end && isJsonSpace( *ptr ) )
+			{
+				++ptr;
+			}
+
+			return ptr;
+		}
+
+		/**
+		 * @brief Locate the string value of the first member named by quotedKey
+		 * @return The value without quotes, or a null view if the key is absent or not a string
+		 */
+		std::string_view findJsonString( batch::SimdLevel level, std::string_view line, std::string_view quotedKey ) noexcept
+		{
+			const char* end{ line.data() + line.size() };
+			for ( auto pos{ findSubstring( level, line, quotedKey, 0 ) }; pos != std::string_view::npos; pos = findSubstring( level, line, quotedKey, pos + 1 ) )
+			{
+				// A match is a key only when a colon follows; otherwise it was a string value
+				const char* ptr{ skipJsonSpace( line.data() + pos + quotedKey.size(), end ) };
+				if ( ptr == end || *ptr != ':' )
+				{
+					continue;
+				}
+
+				ptr = skipJsonSpace( ptr + 1, end );
+				if ( ptr == end || *ptr != '"' )
+				{
+					return {};
+				}
+
+				++ptr;
+				const auto* close{ static_cast<const char*>( std::memchr( ptr, '"', static_cast<std::size_t>( end - ptr ) ) ) };
+				if ( close == nullptr )
+				{
+					return {};
+				}
+
+				return { ptr, static_cast<std::size_t>( close - ptr ) };
+			}
+
+			return {};
+		}
+	} // namespace
+
+	//=====================================================================
+	// TimestampScanner class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Factory methods
+	//----------------------------------------------
+
+	TimestampScanner TimestampScanner::csv( std::size_t column, char delimiter, bool hasHeader )
+	{
+		if ( delimiter == '\n' || delimiter == '\r' || delimiter == '"' )
+		{
+			throw std::invalid_argument{ "CSV delimiter cannot be a line terminator or quote" };
+		}
+
+		TimestampScanner scanner;
+		scanner.m_column = column;
+		scanner.m_delimiter = delimiter;
+		scanner.m_hasHeader = hasHeader;
+
+		return scanner;
+	}
+
+	TimestampScanner TimestampScanner::ndjson( std::string_view key )
+	{
+		if ( key.empty() || key.find_first_of( "\"\\\n" ) != std::string_view::npos )
+		{
+			throw std::invalid_argument{ "JSON key must be non-empty and free of quotes, backslashes and newlines" };
+		}
+
+		TimestampScanner scanner;
+		scanner.m_json = true;
+		scanner.m_quotedKey.reserve( key.size() + 2 );
+		scanner.m_quotedKey += '"';
+		scanner.m_quotedKey += key;
+		scanner.m_quotedKey += '"';
+
+		return scanner;
+	}
+
+	//----------------------------------------------
+	// Scanning
+	//----------------------------------------------
+
+	std::size_t TimestampScanner::feed( std::span<const char> chunk, std::vector<Record>& records )
+	{
+		const auto level{ batch::simdLevel() };
+		const char* const begin{ chunk.data() };
+		const char* const end{ begin + chunk.size() };
+		const char* ptr{ begin };
+		std::size_t appended{ 0 };
+
+		// Complete the line carried over from the previous chunk
+		if ( !m_carry.empty() )
+		{
+			const char* newline{ findNth( level, ptr, end, '\n', 0 ) };
+			if ( newline == nullptr )
+			{
+				m_carry.append( begin, chunk.size() );
+				m_position += chunk.size();
+
+				return 0;
+			}
+
+			m_carry.append( begin, static_cast<std::size_t>( newline - begin ) );
+			appended += processLine( m_carry, m_position - ( m_carry.size() - static_cast<std::size_t>( newline - begin ) ), records );
+			m_carry.clear();
+			ptr = newline + 1;
+		}
+
+		for ( const char* newline; ( newline = findNth( level, ptr, end, '\n', 0 ) ) != nullptr; ptr = newline + 1 )
+		{
+			appended += processLine( { ptr, static_cast<std::size_t>( newline - ptr ) }, m_position + static_cast<std::uint64_t>( ptr - begin ), records );
+		}
+
+		m_carry.assign( ptr, end );
+		m_position += chunk.size();
+
+		return appended;
+	}
+
+	std::size_t TimestampScanner::finish( std::vector<Record>& records )
+	{
+		std::size_t appended{ 0 };
+		if ( !m_carry.empty() )
+		{
+			appended = processLine( m_carry, m_position - m_carry.size(), records );
+		}
+
+		reset();
+
+		return appended;
+	}
+
+	std::size_t TimestampScanner::scan( std::span<const char> buffer, std::vector<Record>& records )
+	{
+		reset();
+		const auto appended{ feed( buffer, records ) };
+
+		return appended + finish( records );
+	}
+
+	void TimestampScanner::reset() noexcept
+	{
+		m_carry.clear();
+		m_position = 0;
+		m_line = 0;
+	}
+
+	//----------------------------------------------
+	// Implementation
+	//----------------------------------------------
+
+	std::size_t TimestampScanner::processLine( std::string_view line, std::uint64_t lineOffset, std::vector<Record>& records )
+	{
+		const auto lineNumber{ m_line++ };
+		if ( !line.empty() && line.back() == '\r' )
+		{
+			line.remove_suffix( 1 );
+		}
+		if ( line.empty() || ( m_hasHeader && lineNumber == 0 ) )
+		{
+			return 0;
+		}
+
+		const auto level{ batch::simdLevel() };
+		std::string_view field;
+		if ( m_json )
+		{
+			field = findJsonString( level, line, m_quotedKey );
+		}
+		else
+		{
+			const char* const end{ line.data() + line.size() };
+			const char* first{ line.data() };
+			if ( m_column > 0 )
+			{
+				const char* delimiter{ findNth( level, first, end, m_delimiter, m_column - 1 ) };
+				first = delimiter == nullptr ? nullptr : delimiter + 1;
+			}
+			if ( first != nullptr )
+			{
+				const char* last{ findNth( level, first, end, m_delimiter, 0 ) };
+				field = { first, static_cast<std::size_t>( ( last == nullptr ? end : last ) - first ) };
+				if ( field.size() >= 2 && field.front() == '"' && field.back() == '"' )
+				{
+					field = field.substr( 1, field.size() - 2 );
+				}
+			}
+		}
+
+		Record record{};
+		record.line = lineNumber;
+		record.offset = field.data() == nullptr ? lineOffset : lineOffset + static_cast<std::uint64_t>( field.data() - line.data() );
+		record.length = static_cast<std::uint32_t>( field.size() );
+
+		std::int64_t ticks{ 0 };
+		std::int64_t offsetTicks{ 0 };
+		record.valid = field.data() != nullptr &&
+					   ( internal::parseCanonicalDateTimeOffset( field, ticks, offsetTicks ) || internal::parseDateTimeOffset( field, ticks, offsetTicks ) );
+		if ( record.valid )
+		{
+			record.value = DateTimeOffset{ ticks, TimeSpan{ offsetTicks } };
+		}
+		records.push_back( record );
+
+		return 1;
+	}
+} // namespace nfx::time
@@ -0,0 +1,270 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TscClock.cpp
+ * @brief Implementation of the TSC-calibrated wall clock
+ * @details The hot path is one counter read, a seqlock-protected load of the anchor and a
+ *          fixed-point multiply. Calibration and re-anchoring pair counter readings with
+ *          DateTime::utcNow() (clock_gettime( CLOCK_REALTIME ) on Linux), which is also the
+ *          fallback whenever the counter is not usable.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+#include "nfx/datetime/TscClock.h"
+#include "CpuFeatures.h"
+
+namespace nfx::time
+{
+	namespace
+	{
+		/** @brief Time between the two samples of the initial calibration */
+		constexpr std::chrono::milliseconds CALIBRATION_WINDOW{ 5 };
+
+		/** @brief Counter/clock pairs taken per sample; the narrowest bracket wins */
+		constexpr int SAMPLE_ATTEMPTS{ 5 };
+
+		/** @brief Fractional bits of the ticks-per-cycle multiplier */
+		constexpr int MULTIPLIER_SHIFT{ 32 };
+
+		/**
+		 * @brief Largest accepted change of the frequency estimate at a re-anchor
+		 * @details NTP slews the system clock by at most 500 ppm; a larger disagreement means
+		 *          the clock was stepped, so the measurement baseline restarts instead.
+		 */
+		constexpr double MAX_FREQUENCY_DEVIATION{ 500e-6 };
+
+		/**
+		 * @brief Largest accepted ticks per cycle (a 10 MHz counter)
+		 * @details Keeps the multiplier below 2^32 so that scale() cannot overflow.
+		 */
+		constexpr double MAX_TICKS_PER_CYCLE{ 1.0 };
+
+		/** @brief Convert a ticks-per-cycle estimate to 32.32 fixed point */
+		std::uint64_t toMultiplier( double ticksPerCycle ) noexcept
+		{
+			return static_cast<std::uint64_t>( std::llround( std::ldexp( ticksPerCycle, MULTIPLIER_SHIFT ) ) );
+		}
+
+		/**
+		 * @brief Scale a counter delta to ticks
+		 * @details Splits the delta in 32-bit halves so that any non-negative delta times a
+		 *          multiplier below 2^32 stays within 64 bits.
+		 */
+		std::int64_t scale( std::int64_t cycles, std::uint64_t multiplier ) noexcept
+		{
+			const bool negative{ cycles < 0 };
+			const std::uint64_t magnitude{ negative ? 0 - static_cast<std::uint64_t>( cycles ) : static_cast<std::uint64_t>( cycles ) };
+			const std::uint64_t ticks{ ( magnitude >> 32 ) * multiplier + ( ( magnitude & 0xFFFFFFFFU ) * multiplier >> MULTIPLIER_SHIFT ) };
+
+			return negative ? -static_cast<std::int64_t>( ticks ) : static_cast<std::int64_t>( ticks );
+		}
+	} // namespace
+
+	//=====================================================================
+	// TscClock class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	TscClock::TscClock( TimeSpan reanchorInterval ) noexcept
+		: m_reanchorTicks{ reanchorInterval.ticks() > 0 ? reanchorInterval.ticks() : constants::TICKS_PER_SECOND }
+	{
+		if ( !isInvariantTscSupported() )
+		{
+			return;
+		}
+
+		const Sample first{ sample() };
+		std::this_thread::sleep_for( CALIBRATION_WINDOW );
+		const Sample second{ sample() };
+
+		const std::int64_t cycles{ second.tsc - first.tsc };
+		const std::int64_t ticks{ second.ticks - first.ticks };
+		if ( cycles <= 0 || ticks <= 0 )
+		{
+			return;
+		}
+
+		const double ticksPerCycle{ static_cast<double>( ticks ) / static_cast<double>( cycles ) };
+		if ( ticksPerCycle >= MAX_TICKS_PER_CYCLE )
+		{
+			return;
+		}
+
+		m_baseline = first;
+		m_ticksPerCycle = ticksPerCycle;
+		m_tscBacked = true;
+		publish( second );
+	}
+
+	TscClock& TscClock::shared() noexcept
+	{
+		static TscClock clock;
+
+		return clock;
+	}
+
+	//----------------------------------------------
+	// Reading
+	//----------------------------------------------
+
+	std::int64_t TscClock::nowTicks() noexcept
+	{
+		if ( !m_tscBacked )
+		{
+			return DateTime::utcNow().ticks();
+		}
+
+		const auto tsc{ static_cast<std::int64_t>( internal::readTsc() ) };
+
+		std::uint64_t sequence;
+		std::int64_t anchorTsc;
+		std::int64_t anchorTicks;
+		std::uint64_t multiplier;
+		std::int64_t reanchorCycles;
+		do
+		{
+			sequence = m_sequence.load( std::memory_order_acquire );
+			anchorTsc = m_anchorTsc.load( std::memory_order_relaxed );
+			anchorTicks = m_anchorTicks.load( std::memory_order_relaxed );
+			multiplier = m_multiplier.load( std::memory_order_relaxed );
+			reanchorCycles = m_reanchorCycles.load( std::memory_order_relaxed );
+			std::atomic_thread_fence( std::memory_order_acquire );
+		} while ( ( sequence & 1 ) != 0 || sequence != m_sequence.load( std::memory_order_relaxed ) );
+
+		const std::int64_t cycles{ tsc - anchorTsc };
+		if ( cycles < reanchorCycles ) [[likely]]
+		{
+			return anchorTicks + scale( cycles, multiplier );
+		}
+
+		return refresh();
+	}
+
+	void TscClock::reanchor() noexcept
+	{
+		if ( m_tscBacked )
+		{
+			static_cast<void>( refresh() );
+		}
+	}
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	double TscClock::frequency() const noexcept
+	{
+		if ( !m_tscBacked )
+		{
+			return 0.0;
+		}
+
+		const double ticksPerCycle{ std::ldexp( static_cast<double>( m_multiplier.load( std::memory_order_relaxed ) ), -MULTIPLIER_SHIFT ) };
+
+		return static_cast<double>( constants::TICKS_PER_SECOND ) / ticksPerCycle;
+	}
+
+	bool TscClock::isInvariantTscSupported() noexcept
+	{
+		static const bool supported{ internal::cpuHasInvariantTsc() };
+
+		return supported;
+	}
+
+	//----------------------------------------------
+	// Calibration
+	//----------------------------------------------
+
+	TscClock::Sample TscClock::sample() noexcept
+	{
+		Sample best{ 0, 0 };
+		std::int64_t narrowest{ std::numeric_limits<std::int64_t>::max() };
+		for ( int attempt{ 0 }; attempt < SAMPLE_ATTEMPTS; ++attempt )
+		{
+			const auto before{ static_cast<std::int64_t>( internal::readTsc() ) };
+			const std::int64_t ticks{ DateTime::utcNow().ticks() };
+			const auto after{ static_cast<std::int64_t>( internal::readTsc() ) };
+
+			if ( after - before < narrowest )
+			{
+				narrowest = after - before;
+				best = Sample{ before + narrowest / 2, ticks };
+			}
+		}
+
+		return best;
+	}
+
+	void TscClock::publish( const Sample& anchor ) noexcept
+	{
+		const std::uint64_t sequence{ m_sequence.load( std::memory_order_relaxed ) };
+		m_sequence.store( sequence + 1, std::memory_order_relaxed );
+		std::atomic_thread_fence( std::memory_order_release );
+
+		m_anchorTsc.store( anchor.tsc, std::memory_order_relaxed );
+		m_anchorTicks.store( anchor.ticks, std::memory_order_relaxed );
+		m_multiplier.store( toMultiplier( m_ticksPerCycle ), std::memory_order_relaxed );
+		m_reanchorCycles.store( static_cast<std::int64_t>( static_cast<double>( m_reanchorTicks ) / m_ticksPerCycle ), std::memory_order_relaxed );
+
+		m_sequence.store( sequence + 2, std::memory_order_release );
+	}
+
+	std::int64_t TscClock::refresh() noexcept
+	{
+		// Another thread is re-anchoring: answer from the system clock rather than wait
+		if ( m_updating.exchange( true, std::memory_order_acquire ) )
+		{
+			return DateTime::utcNow().ticks();
+		}
+
+		const Sample anchor{ sample() };
+
+		// Refine the frequency over the whole baseline unless the system clock was stepped
+		const std::int64_t cycles{ anchor.tsc - m_baseline.tsc };
+		const std::int64_t ticks{ anchor.ticks - m_baseline.ticks };
+		const double measured{ cycles > 0 && ticks > 0 ? static_cast<double>( ticks ) / static_cast<double>( cycles ) : 0.0 };
+		if ( std::abs( measured / m_ticksPerCycle - 1.0 ) <= MAX_FREQUENCY_DEVIATION )
+		{
+			m_ticksPerCycle = measured;
+		}
+		else
+		{
+			m_baseline = anchor;
+		}
+
+		publish( anchor );
+		m_updating.store( false, std::memory_order_release );
+
+		return anchor.ticks;
+	}
+} // namespace nfx::time
@@ -0,0 +1,579 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_Batch.cpp
+ * @brief Unit tests for column-oriented batch operations
+ * @details Every SIMD level supported by the host is exercised and checked against
+ *          the per-value DateTime accessors
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/datetime/Batch.h>
+
+namespace nfx::time::test
+{
+	//=====================================================================
+	// Batch operations tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	/** @brief SIMD levels available on this host, scalar first */
+	static std::vector<batch::SimdLevel> availableSimdLevels()
+	{
+		std::vector<batch::SimdLevel> levels{ batch::SimdLevel::Scalar };
+		if ( batch::supportedSimdLevel() >= batch::SimdLevel::Avx2 )
+		{
+			levels.push_back( batch::SimdLevel::Avx2 );
+		}
+		if ( batch::supportedSimdLevel() >= batch::SimdLevel::Avx512 )
+		{
+			levels.push_back( batch::SimdLevel::Avx512 );
+		}
+
+		return levels;
+	}
+
+	/** @brief Restores the default SIMD level when a test finishes */
+	struct SimdLevelGuard
+	{
+		~SimdLevelGuard()
+		{
+			batch::setSimdLevel( batch::supportedSimdLevel() );
+		}
+	};
+
+	static void expectRowMatches( const batch::DecomposedColumns& columns, std::size_t row, const DateTime& value )
+	{
+		const auto c{ value.components() };
+		ASSERT_EQ( columns.year[row], c.year ) << "row " << row << " ticks " << value.ticks();
+		ASSERT_EQ( columns.month[row], c.month ) << "row " << row << " ticks " << value.ticks();
+		ASSERT_EQ( columns.day[row], c.day ) << "row " << row << " ticks " << value.ticks();
+		ASSERT_EQ( columns.hour[row], c.hour ) << "row " << row << " ticks " << value.ticks();
+		ASSERT_EQ( columns.minute[row], c.minute ) << "row " << row << " ticks " << value.ticks();
+		ASSERT_EQ( columns.second[row], c.second ) << "row " << row << " ticks " << value.ticks();
+		ASSERT_EQ( columns.fractionTicks[row], c.fractionTicks ) << "row " << row << " ticks " << value.ticks();
+	}
+
+	//----------------------------------------------
+	// SIMD dispatch
+	//----------------------------------------------
+
+	TEST( BatchDispatch, SetSimdLevelClampsToSupported )
+	{
+		SimdLevelGuard guard;
+
+		EXPECT_EQ( batch::setSimdLevel( batch::SimdLevel::Scalar ), batch::SimdLevel::Scalar );
+		EXPECT_EQ( batch::simdLevel(), batch::SimdLevel::Scalar );
+
+		EXPECT_EQ( batch::setSimdLevel( batch::SimdLevel::Avx512 ), batch::supportedSimdLevel() );
+		EXPECT_EQ( batch::simdLevel(), batch::supportedSimdLevel() );
+	}
+
+	//----------------------------------------------
+	// Decomposition
+	//----------------------------------------------
+
+	TEST( BatchDecompose, EmptyInput )
+	{
+		batch::DecomposedColumns columns;
+		columns.resize( 3 );
+
+		batch::decompose( {}, columns );
+		EXPECT_EQ( columns.size(), 0u );
+	}
+
+	TEST( BatchDecompose, EveryDayMatchesComponents )
+	{
+		SimdLevelGuard guard;
+
+		// Every day of the supported range, with a time of day that walks through all fields
+		const auto dayCount{ DateTime::max().ticks() / constants::TICKS_PER_DAY + 1 };
+		std::vector<DateTime> values;
+		values.reserve( static_cast<std::size_t>( dayCount ) );
+		for ( std::int64_t days{ 0 }; days < dayCount; ++days )
+		{
+			const auto timeTicks{ ( days * 7919 * constants::TICKS_PER_SECOND + days ) % constants::TICKS_PER_DAY };
+			values.emplace_back( days * constants::TICKS_PER_DAY + timeTicks );
+		}
+		values.back() = DateTime::max();
+
+		for ( const auto level : availableSimdLevels() )
+		{
+			batch::setSimdLevel( level );
+
+			batch::DecomposedColumns columns;
+			batch::decompose( values, columns );
+			ASSERT_EQ( columns.size(), values.size() );
+
+			for ( std::size_t i{ 0 }; i < values.size(); ++i )
+			{
+				expectRowMatches( columns, i, values[i] );
+			}
+		}
+	}
+
+	TEST( BatchDecompose, RemainderLengths )
+	{
+		SimdLevelGuard guard;
+
+		// Lengths around the 8- and 16-lane widths exercise the scalar tails
+		std::vector<DateTime> values;
+		for ( std::int32_t i{ 0 }; i < 37; ++i )
+		{
+			values.emplace_back( 2024, 2, 28, i % 24, i, 59 - i % 60 );
+		}
+
+		for ( const auto level : availableSimdLevels() )
+		{
+			batch::setSimdLevel( level );
+
+			for ( std::size_t length{ 1 }; length <= values.size(); ++length )
+			{
+				batch::DecomposedColumns columns;
+				batch::decompose( std::span{ values }.first( length ), columns );
+				ASSERT_EQ( columns.size(), length );
+
+				for ( std::size_t i{ 0 }; i < length; ++i )
+				{
+					expectRowMatches( columns, i, values[i] );
+				}
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// ErrorBitmap
+	//----------------------------------------------
+
+	TEST( BatchErrorBitmap, SetTestCount )
+	{
+		batch::ErrorBitmap bitmap;
+		bitmap.reset( 130 );
+		EXPECT_EQ( bitmap.size(), 130u );
+		EXPECT_EQ( bitmap.words().size(), 3u );
+		EXPECT_FALSE( bitmap.any() );
+
+		bitmap.set( 0 );
+		bitmap.set( 64 );
+		bitmap.set( 129 );
+		EXPECT_TRUE( bitmap.any() );
+		EXPECT_EQ( bitmap.count(), 3u );
+		EXPECT_TRUE( bitmap.test( 64 ) );
+		EXPECT_FALSE( bitmap.test( 63 ) );
+
+		bitmap.reset( 10 );
+		EXPECT_EQ( bitmap.count(), 0u );
+	}
+
+	//----------------------------------------------
+	// Composition
+	//----------------------------------------------
+
+	TEST( BatchCompose, RoundTripsDecompose )
+	{
+		SimdLevelGuard guard;
+
+		// Every day of the supported range round-trips through decompose and compose
+		const auto dayCount{ DateTime::max().ticks() / constants::TICKS_PER_DAY + 1 };
+		std::vector<DateTime> values;
+		values.reserve( static_cast<std::size_t>( dayCount ) );
+		for ( std::int64_t days{ 0 }; days < dayCount; ++days )
+		{
+			const auto timeTicks{ ( days * 7919 * constants::TICKS_PER_SECOND + days ) % constants::TICKS_PER_DAY };
+			values.emplace_back( days * constants::TICKS_PER_DAY + timeTicks );
+		}
+
+		batch::DecomposedColumns columns;
+		batch::decompose( values, columns );
+
+		for ( const auto level : availableSimdLevels() )
+		{
+			batch::setSimdLevel( level );
+
+			std::vector<DateTime> composed( values.size() );
+			batch::ErrorBitmap invalid;
+			const auto invalidCount{ batch::compose(
+				{ columns.year, columns.month, columns.day, columns.hour, columns.minute, columns.second, columns.fractionTicks },
+				composed, invalid ) };
+
+			EXPECT_EQ( invalidCount, 0u );
+			EXPECT_FALSE( invalid.any() );
+			for ( std::size_t i{ 0 }; i < values.size(); ++i )
+			{
+				ASSERT_EQ( composed[i].ticks(), values[i].ticks() ) << "row " << i;
+			}
+		}
+	}
+
+	TEST( BatchCompose, MatchesConstructorAndFlagsInvalidRows )
+	{
+		SimdLevelGuard guard;
+
+		struct Row
+		{
+			std::int32_t year, month, day, hour, minute, second;
+			bool valid;
+		};
+
+		const std::vector<Row> rows{
+			{ 2024, 2, 29, 12, 30, 45, true },
+			{ 2023, 2, 29, 0, 0, 0, false },  // Not a leap year
+			{ 1900, 2, 29, 0, 0, 0, false },  // Century, not a leap year
+			{ 2000, 2, 29, 23, 59, 59, true }, // 400-year leap year
+			{ 2024, 4, 31, 0, 0, 0, false },  // April has 30 days
+			{ 2024, 8, 31, 0, 0, 0, true },
+			{ 2024, 13, 1, 0, 0, 0, false },
+			{ 2024, 0, 1, 0, 0, 0, false },
+			{ 0, 1, 1, 0, 0, 0, false },
+			{ 10000, 1, 1, 0, 0, 0, false },
+			{ 2024, 1, 0, 0, 0, 0, false },
+			{ 2024, 1, 1, 24, 0, 0, false },
+			{ 2024, 1, 1, 0, 60, 0, false },
+			{ 2024, 1, 1, 0, 0, 60, false },
+			{ 2024, 1, 1, -1, 0, 0, false },
+			{ 1, 1, 1, 0, 0, 0, true },
+			{ 9999, 12, 31, 23, 59, 59, true },
+			{ 1970, 1, 1, 0, 0, 0, true },
+			{ 2024, 12, 31, 0, 0, 0, true },
+		};
+
+		// Repeat to cover full vectors and tails at every lane width
+		std::vector<std::int32_t> year, month, day, hour, minute, second;
+		for ( std::size_t repeat{ 0 }; repeat < 5; ++repeat )
+		{
+			for ( const auto& row : rows )
+			{
+				year.push_back( row.year );
+				month.push_back( row.month );
+				day.push_back( row.day );
+				hour.push_back( row.hour );
+				minute.push_back( row.minute );
+				second.push_back( row.second );
+			}
+		}
+
+		for ( const auto level : availableSimdLevels() )
+		{
+			batch::setSimdLevel( level );
+
+			std::vector<DateTime> out( year.size() );
+			batch::ErrorBitmap invalid;
+			const auto invalidCount{ batch::compose( { year, month, day, hour, minute, second, {} }, out, invalid ) };
+			EXPECT_EQ( invalidCount, invalid.count() );
+
+			for ( std::size_t i{ 0 }; i < out.size(); ++i )
+			{
+				const auto& row{ rows[i % rows.size()] };
+				EXPECT_EQ( invalid.test( i ), !row.valid ) << "row " << i;
+
+				const DateTime expected{ row.year, row.month, row.day, row.hour, row.minute, row.second };
+				EXPECT_EQ( out[i].ticks(), expected.ticks() ) << "row " << i;
+			}
+		}
+	}
+
+	TEST( BatchCompose, OptionalTimeColumnsDefaultToMidnight )
+	{
+		const std::vector<std::int32_t> year{ 2024, 2025 };
+		const std::vector<std::int32_t> month{ 6, 1 };
+		const std::vector<std::int32_t> day{ 15, 31 };
+
+		std::vector<DateTime> out( 2 );
+		batch::ErrorBitmap invalid;
+		EXPECT_EQ( batch::compose( { year, month, day, {}, {}, {}, {} }, out, invalid ), 0u );
+		EXPECT_EQ( out[0], DateTime( 2024, 6, 15 ) );
+		EXPECT_EQ( out[1], DateTime( 2025, 1, 31 ) );
+	}
+
+	TEST( BatchCompose, FractionTicksValidated )
+	{
+		const std::vector<std::int32_t> year{ 2024, 2024, 2024 };
+		const std::vector<std::int32_t> one{ 1, 1, 1 };
+		const std::vector<std::int32_t> fraction{ 1234567, 10000000, -1 };
+
+		std::vector<DateTime> out( 3 );
+		batch::ErrorBitmap invalid;
+		EXPECT_EQ( batch::compose( { year, one, one, {}, {}, {}, fraction }, out, invalid ), 2u );
+		EXPECT_EQ( out[0].ticks(), DateTime( 2024, 1, 1 ).ticks() + 1234567 );
+		EXPECT_FALSE( invalid.test( 0 ) );
+		EXPECT_TRUE( invalid.test( 1 ) );
+		EXPECT_TRUE( invalid.test( 2 ) );
+	}
+
+	TEST( BatchCompose, MismatchedLengthsThrow )
+	{
+		const std::vector<std::int32_t> three{ 1, 1, 1 };
+		const std::vector<std::int32_t> two{ 1, 1 };
+
+		std::vector<DateTime> out( 3 );
+		batch::ErrorBitmap invalid;
+		EXPECT_THROW( batch::compose( { three, three, two, {}, {}, {}, {} }, out, invalid ), std::invalid_argument );
+		EXPECT_THROW( batch::compose( { three, three, three, two, {}, {}, {} }, out, invalid ), std::invalid_argument );
+	}
+
+	//----------------------------------------------
+	// Parsing
+	//----------------------------------------------
+
+	/** @brief Canonical, fractional, offset, non-canonical and invalid timestamps, repeated past several chunks */
+	static std::vector<std::string> parseCorpus()
+	{
+		const std::vector<std::string> samples{
+			"2024-06-15T13:45:30",
+			"2024-06-15T13:45:30Z",
+			"2024-06-15T13:45:30.1234567Z",
+			"2024-06-15T13:45:30.5",
+			"2024-02-29T23:59:59.999Z",
+			"0001-01-01T00:00:00",
+			"9999-12-31T23:59:59.9999999",
+			"2024-06-15T13:45:30+05:30",
+			"2024-06-15T13:45:30.25-08:00",
+			"2024-06-15T13:45:30+14:00",
+			"2024-06-15T13:45:30+1400",
+			"2024-06-15T13:45:30+05",
+			"2024-06-15",
+			"2024-06-15T13:45",
+			"2024-06-15 13:45:30",
+			"2024-06-15T13:45:30.12345678",
+			"2023-02-29T00:00:00",
+			"2024-13-01T00:00:00",
+			"2024-06-15T24:00:00",
+			"2024-06-15T13:45:60Z",
+			"2024-06-15T13:45:30.",
+			"2024-06-15T13:45:30+15:00",
+			"2024-06-15T13:45:30ZZ",
+			"2024-06-15T13:4a:30",
+			"2024/06/15T13:45:30",
+			"garbage",
+			"",
+		};
+
+		std::vector<std::string> corpus;
+		for ( std::size_t i{ 0 }; i < 1500; ++i )
+		{
+			corpus.push_back( i % 3 == 0 ? samples[( i / 3 ) % samples.size()]
+										 : DateTime{ DateTime{ 1970, 1, 1 }.ticks() + static_cast<std::int64_t>( i ) * 7919 * constants::TICKS_PER_SECOND + static_cast<std::int64_t>( i ) * 1009 }.toString() );
+		}
+
+		return corpus;
+	}
+
+	TEST( BatchParse, MatchesFromStringAndFlagsInvalidRows )
+	{
+		SimdLevelGuard guard;
+
+		const auto corpus{ parseCorpus() };
+		const std::vector<std::string_view> strings( corpus.begin(), corpus.end() );
+
+		// Offsets-plus-data layout of the same strings
+		std::vector<std::int32_t> offsets{ 0 };
+		std::string data;
+		for ( const auto& s : corpus )
+		{
+			data += s;
+			offsets.push_back( static_cast<std::int32_t>( data.size() ) );
+		}
+		const batch::StringColumn column{ offsets, data };
+
+		for ( const auto level : availableSimdLevels() )
+		{
+			batch::setSimdLevel( level );
+
+			std::vector<DateTime> out( strings.size() );
+			std::vector<DateTime> columnOut( strings.size() );
+			batch::ErrorBitmap invalid;
+			batch::ErrorBitmap columnInvalid;
+			const auto invalidCount{ batch::parse( strings, out, invalid ) };
+			EXPECT_EQ( batch::parse( column, columnOut, columnInvalid ), invalidCount );
+			EXPECT_EQ( invalid.count(), invalidCount );
+
+			std::size_t expectedInvalid{ 0 };
+			for ( std::size_t i{ 0 }; i < strings.size(); ++i )
+			{
+				const auto expected{ DateTime::fromString( strings[i] ) };
+				expectedInvalid += !expected.has_value();
+				ASSERT_EQ( invalid.test( i ), !expected.has_value() ) << "level " << static_cast<int>( level ) << " row " << i << " '" << strings[i] << "'";
+				ASSERT_EQ( out[i], expected.value_or( DateTime::min() ) ) << "level " << static_cast<int>( level ) << " row " << i << " '" << strings[i] << "'";
+				ASSERT_EQ( columnInvalid.test( i ), invalid.test( i ) ) << "row " << i;
+				ASSERT_EQ( columnOut[i], out[i] ) << "row " << i;
+			}
+			EXPECT_EQ( invalidCount, expectedInvalid );
+		}
+	}
+
+	TEST( BatchParse, DateTimeOffsetMatchesFromString )
+	{
+		SimdLevelGuard guard;
+
+		const auto corpus{ parseCorpus() };
+		const std::vector<std::string_view> strings( corpus.begin(), corpus.end() );
+
+		for ( const auto level : availableSimdLevels() )
+		{
+			batch::setSimdLevel( level );
+
+			std::vector<DateTimeOffset> out( strings.size() );
+			batch::ErrorBitmap invalid;
+			const auto invalidCount{ batch::parse( strings, out, invalid ) };
+
+			std::size_t expectedInvalid{ 0 };
+			for ( std::size_t i{ 0 }; i < strings.size(); ++i )
+			{
+				const auto expected{ DateTimeOffset::fromString( strings[i] ) };
+				expectedInvalid += !expected.has_value();
+				ASSERT_EQ( invalid.test( i ), !expected.has_value() ) << "level " << static_cast<int>( level ) << " row " << i << " '" << strings[i] << "'";
+				const auto value{ expected.value_or( DateTimeOffset{} ) };
+				ASSERT_EQ( out[i].dateTime(), value.dateTime() ) << "row " << i << " '" << strings[i] << "'";
+				ASSERT_EQ( out[i].offset(), value.offset() ) << "row " << i << " '" << strings[i] << "'";
+			}
+			EXPECT_EQ( invalidCount, expectedInvalid );
+		}
+	}
+
+	TEST( BatchParse, MalformedColumnOffsetsAreInvalidRows )
+	{
+		const std::string data{ "2024-06-15T13:45:302025-01-01T00:00:00" };
+		const std::vector<std::int32_t> offsets{ 0, 19, 10, 19, 38, 60, -1 };
+
+		std::vector<DateTime> out( 6 );
+		batch::ErrorBitmap invalid;
+		EXPECT_EQ( batch::parse( batch::StringColumn{ offsets, data }, out, invalid ), 4u );
+		EXPECT_EQ( out[0], DateTime( 2024, 6, 15, 13, 45, 30 ) );
+		EXPECT_TRUE( invalid.test( 1 ) );
+		EXPECT_TRUE( invalid.test( 2 ) );
+		EXPECT_FALSE( invalid.test( 3 ) );
+		EXPECT_EQ( out[3], DateTime( 2025, 1, 1 ) );
+		EXPECT_TRUE( invalid.test( 4 ) );
+		EXPECT_TRUE( invalid.test( 5 ) );
+	}
+
+	TEST( BatchParse, MismatchedLengthsThrow )
+	{
+		const std::vector<std::string_view> strings{ "2024-06-15T13:45:30", "2024-06-15T13:45:30" };
+		const std::vector<std::int32_t> offsets{ 0, 19 };
+		const std::string data{ "2024-06-15T13:45:30" };
+
+		std::vector<DateTime> out( 3 );
+		std::vector<DateTimeOffset> offsetOut( 3 );
+		batch::ErrorBitmap invalid;
+		EXPECT_THROW( batch::parse( strings, out, invalid ), std::invalid_argument );
+		EXPECT_THROW( batch::parse( batch::StringColumn{ offsets, data }, out, invalid ), std::invalid_argument );
+		EXPECT_THROW( batch::parse( strings, offsetOut, invalid ), std::invalid_argument );
+		EXPECT_THROW( batch::parse( batch::StringColumn{ offsets, data }, offsetOut, invalid ), std::invalid_argument );
+	}
+
+	//----------------------------------------------
+	// Formatting
+	//----------------------------------------------
+
+	TEST( BatchFormat, MatchesToStringForEveryFormat )
+	{
+		SimdLevelGuard guard;
+
+		// Spread over the whole range, with fractions that exercise trailing-zero trimming
+		std::vector<DateTime> values;
+		for ( std::int64_t i{ 0 }; i < 1500; ++i )
+		{
+			const auto ticks{ ( DateTime::max().ticks() / 1499 ) * i };
+			values.emplace_back( i % 3 == 0 ? ticks - ticks % constants::TICKS_PER_SECOND : ticks );
+		}
+		values.back() = DateTime::max();
+
+		constexpr std::array formats{
+			DateTime::Format::Iso8601Basic,
+			DateTime::Format::Iso8601Extended,
+			DateTime::Format::Iso8601WithOffset,
+			DateTime::Format::DateOnly,
+			DateTime::Format::TimeOnly,
+			DateTime::Format::UnixSeconds,
+			DateTime::Format::UnixMilliseconds };
+
+		for ( const auto level : availableSimdLevels() )
+		{
+			batch::setSimdLevel( level );
+
+			for ( const auto format : formats )
+			{
+				batch::OutputBuffer out;
+				batch::format( values, format, out );
+				ASSERT_EQ( out.size(), values.size() );
+				ASSERT_EQ( out.offsets().back(), static_cast<std::int64_t>( out.data().size() ) );
+
+				for ( std::size_t i{ 0 }; i < values.size(); ++i )
+				{
+					ASSERT_EQ( out[i], values[i].toString( format ) ) << "row " << i << " format " << static_cast<int>( format );
+				}
+			}
+		}
+	}
+
+	TEST( BatchFormat, AppendsAndClears )
+	{
+		const std::vector<DateTime> first{ DateTime{ 2024, 6, 15, 13, 45, 30 }, DateTime{ 1999, 12, 31 } };
+		const std::vector<DateTime> second{ DateTime{ 2000, 1, 1 } };
+
+		batch::OutputBuffer out;
+		EXPECT_TRUE( out.empty() );
+		batch::format( first, DateTime::Format::Iso8601Basic, out );
+		batch::format( second, DateTime::Format::DateOnly, out );
+
+		ASSERT_EQ( out.size(), 3u );
+		EXPECT_EQ( out[0], "2024-06-15T13:45:30Z" );
+		EXPECT_EQ( out[1], "1999-12-31T00:00:00Z" );
+		EXPECT_EQ( out[2], "2000-01-01" );
+		EXPECT_EQ( std::string_view( out.data().data(), out.data().size() ), "2024-06-15T13:45:30Z1999-12-31T00:00:00Z2000-01-01" );
+		EXPECT_EQ( ( std::vector<std::int64_t>{ out.offsets().begin(), out.offsets().end() } ), ( std::vector<std::int64_t>{ 0, 20, 40, 50 } ) );
+
+		out.clear();
+		EXPECT_TRUE( out.empty() );
+		EXPECT_EQ( out.offsets().size(), 1u );
+		EXPECT_TRUE( out.data().empty() );
+	}
+
+	TEST( BatchFormat, AllocatesFromMemoryResource )
+	{
+		const std::vector<DateTime> values( 1000, DateTime{ 2024, 6, 15, 13, 45, 30 } );
+
+		std::pmr::monotonic_buffer_resource arena;
+		std::pmr::set_default_resource( std::pmr::null_memory_resource() );
+		batch::OutputBuffer out{ &arena };
+		batch::format( values, DateTime::Format::Iso8601Basic, out );
+		std::pmr::set_default_resource( std::pmr::new_delete_resource() );
+
+		ASSERT_EQ( out.size(), values.size() );
+		EXPECT_EQ( out.data().size(), values.size() * 20 );
+		EXPECT_EQ( out[999], "2024-06-15T13:45:30Z" );
+	}
+} // namespace nfx::time::test
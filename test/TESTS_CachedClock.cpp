@@ -0,0 +1,189 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_CachedClock.cpp
+ * @brief Unit tests for the background-updated CachedClock
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <nfx/datetime/CachedClock.h>
+
+namespace nfx::time::test
+{
+	//=====================================================================
+	// CachedClock tests
+	//=====================================================================
+
+	/** @brief Allowance for the update thread's wake-up latency on a loaded machine */
+	static constexpr std::int64_t MAX_LATENCY_TICKS{ 50 * constants::TICKS_PER_MILLISECOND };
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	TEST( CachedClock, Period )
+	{
+		EXPECT_EQ( CachedClock{}.period(), TimeSpan{ CachedClock::DEFAULT_PERIOD_TICKS } );
+		EXPECT_EQ( CachedClock{ TimeSpan::fromMicroseconds( 100.0 ) }.period(), TimeSpan::fromMicroseconds( 100.0 ) );
+		EXPECT_EQ( CachedClock{ TimeSpan{ 0 } }.period(), TimeSpan{ CachedClock::DEFAULT_PERIOD_TICKS } );
+		EXPECT_EQ( CachedClock{ TimeSpan::fromSeconds( -1.0 ) }.period(), TimeSpan{ CachedClock::DEFAULT_PERIOD_TICKS } );
+		EXPECT_EQ( CachedClock{ TimeSpan{ 1 } }.period(), TimeSpan{ CachedClock::MIN_PERIOD_TICKS } );
+	}
+
+	TEST( CachedClock, CacheLineAligned )
+	{
+		EXPECT_GE( alignof( CachedClock ), CachedClock::CACHE_LINE_SIZE );
+		EXPECT_GE( sizeof( CachedClock ), 2 * CachedClock::CACHE_LINE_SIZE );
+	}
+
+	//----------------------------------------------
+	// Lifecycle
+	//----------------------------------------------
+
+	TEST( CachedClock, StartStop )
+	{
+		CachedClock clock;
+		EXPECT_FALSE( clock.isRunning() );
+
+		clock.start();
+		EXPECT_TRUE( clock.isRunning() );
+		clock.start();
+		EXPECT_TRUE( clock.isRunning() );
+
+		clock.stop();
+		EXPECT_FALSE( clock.isRunning() );
+		clock.stop();
+		EXPECT_FALSE( clock.isRunning() );
+
+		// Restartable
+		clock.start();
+		EXPECT_TRUE( clock.isRunning() );
+	}
+
+	TEST( CachedClock, StopIsPrompt )
+	{
+		// stop() must not wait out a long period
+		CachedClock clock{ TimeSpan::fromSeconds( 60.0 ) };
+		clock.start();
+		const auto begin{ std::chrono::steady_clock::now() };
+		clock.stop();
+		EXPECT_LT( std::chrono::steady_clock::now() - begin, std::chrono::seconds{ 5 } );
+	}
+
+	TEST( CachedClock, DestructorStops )
+	{
+		auto clock{ std::make_unique<CachedClock>( TimeSpan::fromSeconds( 60.0 ) ) };
+		clock->start();
+		clock.reset();
+		SUCCEED();
+	}
+
+	//----------------------------------------------
+	// Reading
+	//----------------------------------------------
+
+	TEST( CachedClock, StoppedFallsBackToUtcNow )
+	{
+		const CachedClock clock;
+		const DateTime before{ DateTime::utcNow() };
+		const DateTime now{ clock.now() };
+		const DateTime after{ DateTime::utcNow() };
+		EXPECT_GE( now, before );
+		EXPECT_LE( now, after );
+	}
+
+	TEST( CachedClock, FreshAfterStart )
+	{
+		CachedClock clock{ TimeSpan::fromSeconds( 60.0 ) };
+		const DateTime before{ DateTime::utcNow() };
+		clock.start();
+		const DateTime now{ clock.now() };
+		EXPECT_GE( now, before );
+		EXPECT_LE( now, DateTime::utcNow() );
+	}
+
+	TEST( CachedClock, StalenessBound )
+	{
+		CachedClock clock{ TimeSpan::fromMilliseconds( 1.0 ) };
+		clock.start();
+
+		const DateTime first{ clock.now() };
+		std::int64_t maxLag{ 0 };
+		const auto end{ std::chrono::steady_clock::now() + std::chrono::milliseconds{ 200 } };
+		while ( std::chrono::steady_clock::now() < end )
+		{
+			const std::int64_t cached{ clock.nowTicks() };
+			const std::int64_t reference{ DateTime::utcNow().ticks() };
+			EXPECT_LE( cached, reference );
+			maxLag = std::max( maxLag, reference - cached );
+		}
+
+		EXPECT_GT( clock.now(), first );
+		EXPECT_LE( maxLag, clock.period().ticks() + MAX_LATENCY_TICKS );
+	}
+
+	TEST( CachedClock, ConcurrentReaders )
+	{
+		CachedClock clock{ TimeSpan::fromMicroseconds( 100.0 ) };
+		clock.start();
+
+		std::array<bool, 4> monotonic{ true, true, true, true };
+		std::vector<std::thread> readers;
+		for ( std::size_t t{ 0 }; t < monotonic.size(); ++t )
+		{
+			readers.emplace_back( [&clock, &monotonic, t] {
+				std::int64_t previous{ 0 };
+				for ( int i{ 0 }; i < 200000; ++i )
+				{
+					const std::int64_t ticks{ clock.nowTicks() };
+					if ( ticks < previous )
+					{
+						monotonic[t] = false;
+					}
+					previous = ticks;
+				}
+			} );
+		}
+		for ( auto& reader : readers )
+		{
+			reader.join();
+		}
+
+		// One writer and coherent loads: no reader sees time go backwards unless the system clock did
+		for ( const bool value : monotonic )
+		{
+			EXPECT_TRUE( value );
+		}
+	}
+} // namespace nfx::time::test
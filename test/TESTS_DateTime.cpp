@@ -31,7 +31,15 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <locale>
 #include <sstream>
+#include <string>
+#include <string_view>
 
 #include <nfx/datetime/DateTime.h>
 
@@ -297,6 +305,148 @@ namespace nfx::time::test
 		EXPECT_EQ( dt.dayOfYear(), 15 ); // 15th day of year
 	}
 
+	TEST( DateTimeAccessors, Components )
+	{
+		DateTime dt{ DateTime{ 2024, 3, 15, 14, 30, 45, 123 } + TimeSpan{ 4567 } };
+		const auto c{ dt.components() };
+
+		EXPECT_EQ( c.year, 2024 );
+		EXPECT_EQ( c.month, 3 );
+		EXPECT_EQ( c.day, 15 );
+		EXPECT_EQ( c.hour, 14 );
+		EXPECT_EQ( c.minute, 30 );
+		EXPECT_EQ( c.second, 45 );
+		EXPECT_EQ( c.fractionTicks, 1234567 );
+		EXPECT_EQ( c.dayOfWeek, dt.dayOfWeek() );
+		EXPECT_EQ( c.dayOfYear, dt.dayOfYear() );
+	}
+
+	TEST( DateTimeAccessors, ComponentsMatchAccessors )
+	{
+		for ( const auto& dt : { DateTime::min(), DateTime::max(), DateTime::epoch(), DateTime{ 2000, 2, 29, 23, 59, 59 } } )
+		{
+			const auto c{ dt.components() };
+			EXPECT_EQ( c.year, dt.year() );
+			EXPECT_EQ( c.month, dt.month() );
+			EXPECT_EQ( c.day, dt.day() );
+			EXPECT_EQ( c.hour, dt.hour() );
+			EXPECT_EQ( c.minute, dt.minute() );
+			EXPECT_EQ( c.second, dt.second() );
+			EXPECT_EQ( c.fractionTicks, dt.ticks() % constants::TICKS_PER_SECOND );
+			EXPECT_EQ( c.dayOfWeek, dt.dayOfWeek() );
+			EXPECT_EQ( c.dayOfYear, dt.dayOfYear() );
+		}
+	}
+
+	//----------------------------------------------
+	// Calendar decomposition
+	//----------------------------------------------
+
+	/** @brief Reference 400/100/4/1-year cascade with month walk, used to cross-check the calendar math */
+	static void referenceDateFromDays( std::int64_t totalDays, std::int32_t& year, std::int32_t& month, std::int32_t& day, std::int32_t& dayOfYear )
+	{
+		const std::int64_t num400Years{ totalDays / constants::DAYS_PER_400_YEARS };
+		totalDays %= constants::DAYS_PER_400_YEARS;
+
+		const std::int64_t num100Years{ std::min<std::int64_t>( totalDays / constants::DAYS_PER_100_YEARS, 3 ) };
+		totalDays -= num100Years * constants::DAYS_PER_100_YEARS;
+
+		const std::int64_t num4Years{ totalDays / constants::DAYS_PER_4_YEARS };
+		totalDays %= constants::DAYS_PER_4_YEARS;
+
+		const std::int64_t numYears{ std::min<std::int64_t>( totalDays / constants::DAYS_PER_YEAR, 3 ) };
+		totalDays -= numYears * constants::DAYS_PER_YEAR;
+
+		year = static_cast<std::int32_t>( 1 + num400Years * 400 + num100Years * 100 + num4Years * 4 + numYears );
+		dayOfYear = static_cast<std::int32_t>( totalDays ) + 1;
+
+		month = 1;
+		while ( totalDays >= DateTime::daysInMonth( year, month ) )
+		{
+			totalDays -= DateTime::daysInMonth( year, month );
+			++month;
+		}
+		day = static_cast<std::int32_t>( totalDays ) + 1;
+	}
+
+	TEST( DateTimeCalendar, ExhaustiveDecompositionMatchesReference )
+	{
+		const std::int64_t maxDays{ constants::MAX_DATETIME_TICKS / constants::TICKS_PER_DAY };
+		std::int64_t mismatches{ 0 };
+
+		for ( std::int64_t days{ 0 }; days <= maxDays; ++days )
+		{
+			std::int32_t year, month, day, dayOfYear;
+			referenceDateFromDays( days, year, month, day, dayOfYear );
+
+			// Mid-day ticks also exercise the time-of-day truncation
+			const DateTime dt{ days * constants::TICKS_PER_DAY + constants::TICKS_PER_DAY / 2 };
+			if ( dt.year() != year || dt.month() != month || dt.day() != day || dt.dayOfYear() != dayOfYear )
+			{
+				ADD_FAILURE() << "Decomposition mismatch at day " << days << ": expected "
+							  << year << "-" << month << "-" << day << " (doy " << dayOfYear << "), got "
+							  << dt.year() << "-" << dt.month() << "-" << dt.day() << " (doy " << dt.dayOfYear() << ")";
+				if ( ++mismatches > 10 )
+				{
+					return;
+				}
+			}
+
+			const DateTime composed{ year, month, day };
+			if ( composed.ticks() != days * constants::TICKS_PER_DAY )
+			{
+				ADD_FAILURE() << "Composition mismatch for " << year << "-" << month << "-" << day
+							  << ": expected day " << days << ", got " << composed.ticks() / constants::TICKS_PER_DAY;
+				if ( ++mismatches > 10 )
+				{
+					return;
+				}
+			}
+		}
+
+		EXPECT_EQ( mismatches, 0 );
+	}
+
+	TEST( DateTimeCalendar, CalendarBoundaries )
+	{
+		// Leap day of a 400-year leap century and the day after a non-leap century February
+		EXPECT_EQ( DateTime( 2000, 2, 29 ).dayOfYear(), 60 );
+		EXPECT_EQ( DateTime( 1900, 3, 1 ).dayOfYear(), 60 );
+		EXPECT_EQ( DateTime( 2000, 12, 31 ).dayOfYear(), 366 );
+		EXPECT_EQ( DateTime( 1900, 12, 31 ).dayOfYear(), 365 );
+
+		const DateTime lastDay{ DateTime::max() };
+		EXPECT_EQ( lastDay.dayOfYear(), 365 );
+		EXPECT_EQ( DateTime( 9999, 12, 31 ).ticks(), lastDay.date().ticks() );
+	}
+
+	TEST( DateTimeCalendar, DayTableWindowEdges )
+	{
+		// Dates straddling both edges of the default day table window (1970-2199)
+		// must agree whether they are served by the table or by arithmetic
+		const std::array<std::array<std::int32_t, 5>, 4> edges{ {
+			{ 1969, 12, 31, 365, 3 },
+			{ 1970, 1, 1, 1, 4 },
+			{ 2199, 12, 31, 365, 2 },
+			{ 2200, 1, 1, 1, 3 },
+		} };
+
+		for ( const auto& [year, month, day, dayOfYear, dayOfWeek] : edges )
+		{
+			const DateTime dt{ year, month, day, 23, 59, 59 };
+			const auto c{ dt.components() };
+			EXPECT_EQ( c.year, year );
+			EXPECT_EQ( c.month, month );
+			EXPECT_EQ( c.day, day );
+			EXPECT_EQ( c.dayOfYear, dayOfYear );
+			EXPECT_EQ( c.dayOfWeek, dayOfWeek );
+			EXPECT_EQ( dt.dayOfYear(), dayOfYear );
+			EXPECT_EQ( dt.dayOfWeek(), dayOfWeek );
+		}
+
+		EXPECT_DOUBLE_EQ( ( DateTime{ 2200, 1, 1 } - DateTime{ 1970, 1, 1 } ).days(), 84006.0 );
+	}
+
 	//----------------------------------------------
 	// Conversion methods
 	//----------------------------------------------
@@ -410,6 +560,57 @@ namespace nfx::time::test
 		EXPECT_EQ( str.find( "2024" ), std::string::npos ); // No date component
 	}
 
+	TEST( DateTimeStringFormatting, ToCharsMatchesToString )
+	{
+		const DateTime::Format formats[]{ DateTime::Format::Iso8601Basic, DateTime::Format::Iso8601Extended, DateTime::Format::Iso8601WithOffset,
+			DateTime::Format::DateOnly, DateTime::Format::TimeOnly, DateTime::Format::UnixSeconds, DateTime::Format::UnixMilliseconds };
+		const DateTime values[]{ DateTime::min(), DateTime::max(), DateTime::epoch(), DateTime{ 999, 1, 2, 3, 4, 5 } + TimeSpan{ 1200 }, DateTime{ 2024, 2, 29, 23, 59, 59, 100 } };
+
+		for ( const DateTime& value : values )
+		{
+			for ( DateTime::Format format : formats )
+			{
+				char buffer[constants::MAX_ISO8601_LENGTH];
+				const auto result{ value.toChars( buffer, buffer + sizeof( buffer ), format ) };
+				ASSERT_EQ( result.ec, std::errc{} );
+				EXPECT_EQ( std::string( buffer, result.ptr ), value.toString( format ) );
+			}
+		}
+
+		EXPECT_EQ( DateTime::min().toString( DateTime::Format::UnixMilliseconds ), "-62135596800000" );
+		EXPECT_EQ( ( DateTime{ 2024, 1, 1 } + TimeSpan{ 1200 } ).toIso8601Extended(), "2024-01-01T00:00:00.00012Z" );
+		EXPECT_EQ( ( DateTime{ 2024, 1, 1 }.toIso8601Extended() ), "2024-01-01T00:00:00.0Z" );
+
+		// Exact fit succeeds, one byte less reports value_too_large
+		const DateTime dt{ 2024, 6, 15, 13, 45, 30 };
+		char small[20];
+		auto exact{ dt.toChars( small, small + 20 ) };
+		EXPECT_EQ( exact.ec, std::errc{} );
+		EXPECT_EQ( std::string( small, exact.ptr ), "2024-06-15T13:45:30Z" );
+		auto tooSmall{ dt.toChars( small, small + 19 ) };
+		EXPECT_EQ( tooSmall.ec, std::errc::value_too_large );
+		EXPECT_EQ( tooSmall.ptr, small + 19 );
+	}
+
+	TEST( DateTimeStringFormatting, ToFixedStringMatchesToString )
+	{
+		const DateTime::Format formats[]{ DateTime::Format::Iso8601Basic, DateTime::Format::Iso8601Extended, DateTime::Format::Iso8601WithOffset,
+			DateTime::Format::DateOnly, DateTime::Format::TimeOnly, DateTime::Format::UnixSeconds, DateTime::Format::UnixMilliseconds };
+		const DateTime values[]{ DateTime::min(), DateTime::max(), DateTime::epoch(), DateTime{ 2024, 2, 29, 23, 59, 59, 100 } + TimeSpan{ 1234 } };
+
+		for ( const DateTime& value : values )
+		{
+			for ( DateTime::Format format : formats )
+			{
+				const auto text{ value.toFixedString( format ) };
+				EXPECT_EQ( std::string_view{ text }, value.toString( format ) );
+				EXPECT_EQ( std::strlen( text.c_str() ), text.size() );
+			}
+		}
+
+		EXPECT_EQ( DateTime( 2024, 6, 15, 13, 45, 30 ).toFixedString(), "2024-06-15T13:45:30Z" );
+	}
+
 	//----------------------------------------------
 	// Validation methods
 	//----------------------------------------------
@@ -471,6 +672,20 @@ namespace nfx::time::test
 		EXPECT_GE( now.year(), 2024 );
 	}
 
+	TEST( DateTimeFactory, UtcNowCoarse )
+	{
+		const TimeSpan resolution{ DateTime::coarseClockResolution() };
+		EXPECT_GT( resolution.ticks(), 0 );
+		EXPECT_LE( resolution, TimeSpan::fromSeconds( 1.0 ) );
+
+		// Never ahead of the precise clock, and behind it by at most about one coarse tick
+		const DateTime before{ DateTime::utcNow() };
+		const DateTime coarse{ DateTime::utcNowCoarse() };
+		const DateTime after{ DateTime::utcNow() };
+		EXPECT_LE( coarse, after );
+		EXPECT_GE( coarse, before - resolution - TimeSpan::fromMilliseconds( 10.0 ) );
+	}
+
 	TEST( DateTimeFactory, Today )
 	{
 		DateTime today{ DateTime::today() };
@@ -600,6 +815,110 @@ namespace nfx::time::test
 		EXPECT_THROW( [[maybe_unused]] auto _ = DateTime{ "not-a-date" }, std::invalid_argument );
 	}
 
+	TEST( DateTimeStringParsing, CanonicalLayoutMatchesGeneralParser )
+	{
+		// fromString() takes a fast path for YYYY-MM-DDTHH:MM:SS[.fffffff][Z]; it must agree
+		// with the general parser on every input of that shape, valid or not
+		const auto expectSameResult{ []( std::string_view input ) {
+			std::int64_t expectedTicks{ 0 };
+			const bool expected{ internal::parseDateTime( input, expectedTicks ) };
+
+			DateTime parsed;
+			ASSERT_EQ( DateTime::fromString( input, parsed ), expected ) << input;
+			if ( expected )
+			{
+				EXPECT_EQ( parsed.ticks(), expectedTicks ) << input;
+			}
+		} };
+
+		const std::array<const char*, 6> suffixes{ "", "Z", ".1", ".1234567Z", ".12345678Z", "." };
+		std::uint32_t state{ 12345 };
+		for ( std::int32_t year{ 1 }; year <= 9999; year += 7 )
+		{
+			for ( std::int32_t month{ 0 }; month <= 13; ++month )
+			{
+				state = state * 1664525U + 1013904223U;
+				const std::int32_t day{ static_cast<std::int32_t>( state >> 27 ) + 1 };
+				const std::int32_t hour{ static_cast<std::int32_t>( ( state >> 8 ) % 25 ) };
+				const std::int32_t minute{ static_cast<std::int32_t>( ( state >> 13 ) % 61 ) };
+				const std::int32_t second{ static_cast<std::int32_t>( ( state >> 19 ) % 61 ) };
+
+				char buffer[48];
+				std::snprintf( buffer, sizeof( buffer ), "%04d-%02d-%02dT%02d:%02d:%02d%s",
+					year, month, day, hour, minute, second, suffixes[state % suffixes.size()] );
+				expectSameResult( buffer );
+			}
+		}
+
+		// Near misses of the canonical shape
+		for ( const auto* input : { "2024-01-15T12:30:45", "2024-01-15 12:30:45", "2024/01/15T12:30:45",
+				  "2024-01-15T12-30-45", "2024-01-15T12:30:4x", "2024-01-1xT12:30:45", "2O24-01-15T12:30:45",
+				  "2024-01-15T12:30:45+02:00", "2024-01-15T12:30:45.Z", "0000-01-01T00:00:00",
+				  "2024-01-15T12:30:45ZZ", "2024-01-15T12:30:45/", "2024-01-15t12:30:45" } )
+		{
+			expectSameResult( input );
+		}
+	}
+
+	TEST( DateTimeStringParsing, CompileTimeLiteral )
+	{
+		using namespace nfx::time::literals;
+
+		// Evaluated entirely at compile time
+		static_assert( "1970-01-01T00:00:00Z"_dt == DateTime::epoch() );
+		static_assert( "0001-01-01"_dt == DateTime::min() );
+		static_assert( "9999-12-31T23:59:59.9999999Z"_dt == DateTime::max() );
+		static_assert( "1970-01-01T00:00:01.5"_dt.ticks() - DateTime::epoch().ticks() == 15000000 );
+
+		constexpr auto boundary{ "2025-01-01T09:30:00+02:00"_dt };
+		EXPECT_EQ( boundary, DateTime::fromString( "2025-01-01T09:30:00+02:00" ) );
+		EXPECT_EQ( "2024-02-29T12:34:56.789Z"_dt, ( DateTime{ 2024, 2, 29, 12, 34, 56, 789 } ) );
+		EXPECT_EQ( "2024-1-5T7:08:09"_dt, ( DateTime{ 2024, 1, 5, 7, 8, 9 } ) );
+
+		// The shared parser rejects what fromString() rejects, so bad literals fail to compile
+		static_assert( []() {
+			std::int64_t ticks{ 0 };
+			return !internal::parseDateTime( "2024-02-30", ticks ) &&
+				   !internal::parseDateTime( "2024-13-01T00:00:00Z", ticks ) &&
+				   !internal::parseDateTime( "2024-01-15T24:00:00", ticks ) &&
+				   !internal::parseDateTime( "not-a-date", ticks );
+		}() );
+	}
+
+	TEST( DateTimeStringParsing, ParseWithPattern )
+	{
+		// Fixed layouts agree with the ISO 8601 parser
+		EXPECT_EQ( DateTime::parse<"%Y-%m-%dT%H:%M:%S">( "2024-06-15T13:45:30" ), DateTime::fromString( "2024-06-15T13:45:30" ) );
+		EXPECT_EQ( DateTime::parse<"%F %T.%f">( "2024-06-15 13:45:30.1234567" ), DateTime::fromString( "2024-06-15T13:45:30.1234567" ) );
+		EXPECT_EQ( DateTime::parse<"%d/%b/%Y:%H:%M:%S">( "10/Oct/2000:13:55:36" ), ( DateTime{ 2000, 10, 10, 13, 55, 36 } ) );
+		EXPECT_EQ( DateTime::parse<"%d/%b/%Y">( "01/DEC/1999" ), ( DateTime{ 1999, 12, 1 } ) );
+		EXPECT_EQ( DateTime::parse<"%Y%m%d%H%M%S">( "20240615134530" ), ( DateTime{ 2024, 6, 15, 13, 45, 30 } ) );
+		EXPECT_EQ( DateTime::parse<"%Y.%j">( "2024.366" ), ( DateTime{ 2024, 12, 31 } ) );
+		EXPECT_EQ( DateTime::parse<"%Y.%j">( "2023.060" ), ( DateTime{ 2023, 3, 1 } ) );
+		EXPECT_EQ( DateTime::parse<"%Y%%%m%%%d">( "2024%06%15" ), ( DateTime{ 2024, 6, 15 } ) );
+
+		// Fraction digits beyond tick precision are dropped; the offset is not applied
+		EXPECT_EQ( DateTime::parse<"%T.%f %F">( "13:45:30.123456789 2024-06-15" )->ticks(), ( DateTime{ 2024, 6, 15, 13, 45, 30 }.ticks() + 1234567 ) );
+		EXPECT_EQ( DateTime::parse<"%FT%T%z">( "2024-06-15T13:45:30-07:00" ), ( DateTime{ 2024, 6, 15, 13, 45, 30 } ) );
+
+		// Input must match the whole pattern and hold a real date and time
+		DateTime result;
+		EXPECT_FALSE( DateTime::parse<"%F">( "2024-06-15T", result ) );
+		EXPECT_FALSE( DateTime::parse<"%F">( "2024-6-15", result ) );
+		EXPECT_FALSE( DateTime::parse<"%F">( "2024/06/15", result ) );
+		EXPECT_FALSE( DateTime::parse<"%F">( "2023-02-29", result ) );
+		EXPECT_FALSE( DateTime::parse<"%F %T">( "2024-06-15 24:00:00", result ) );
+		EXPECT_FALSE( DateTime::parse<"%Y.%j">( "2023.366", result ) );
+		EXPECT_FALSE( DateTime::parse<"%Y.%j">( "2024.000", result ) );
+		EXPECT_FALSE( DateTime::parse<"%d/%b/%Y">( "10/Okt/2000", result ) );
+		EXPECT_FALSE( DateTime::parse<"%T.%f %F">( "13:45:30. 2024-06-15", result ) );
+		EXPECT_FALSE( DateTime::parse<"%FT%T%z">( "2024-06-15T13:45:30+14:30", result ) );
+
+		// Patterns are compiled and can run at compile time
+		static_assert( DateTime::parse<"%Y-%m-%d">( "1970-01-01" ) == DateTime::epoch() );
+		static_assert( !DateTime::parse<"%Y-%m-%d">( "1970-01-32" ).has_value() );
+	}
+
 	//----------------------------------------------
 	// std::chrono interoperability
 	//----------------------------------------------
@@ -665,6 +984,166 @@ namespace nfx::time::test
 		EXPECT_EQ( dt.hour(), 12 );
 	}
 
+	TEST( DateTimeStreamOperators, OutputHonoursWidth )
+	{
+		const DateTime dt{ 2024, 1, 15, 12, 30, 45 };
+		std::ostringstream oss;
+		oss << std::setw( 22 ) << std::setfill( '*' ) << dt << '|' << std::left << std::setw( 21 ) << dt << '|' << dt;
+
+		EXPECT_EQ( oss.str(), "**2024-01-15T12:30:45Z|2024-01-15T12:30:45Z*|2024-01-15T12:30:45Z" );
+	}
+
+	TEST( DateTimeStreamOperators, InputReadsTokensLikeString )
+	{
+		// Same stream states and positions as extracting into std::string
+		const std::string input{ "  2024-01-15T12:30:45Z\t2024-01-15T12:30:46.5Z\nbogus 2024-01-15T12:30:47Z" };
+		std::istringstream iss{ input };
+		DateTime dt;
+
+		iss >> dt;
+		EXPECT_EQ( dt, DateTime( 2024, 1, 15, 12, 30, 45 ) );
+		EXPECT_TRUE( iss.good() );
+		EXPECT_EQ( iss.tellg(), 22 );
+
+		iss >> dt;
+		EXPECT_EQ( dt, DateTime( 2024, 1, 15, 12, 30, 46, 500 ) );
+
+		iss >> dt;
+		EXPECT_TRUE( iss.fail() );
+		EXPECT_EQ( dt, DateTime( 2024, 1, 15, 12, 30, 46, 500 ) );
+
+		iss.clear();
+		iss >> dt;
+		EXPECT_EQ( dt, DateTime( 2024, 1, 15, 12, 30, 47 ) );
+		EXPECT_TRUE( iss.eof() );
+		EXPECT_FALSE( iss.fail() );
+
+		iss >> dt;
+		EXPECT_TRUE( iss.fail() );
+	}
+
+	TEST( DateTimeStreamOperators, InputUsesStreamLocale )
+	{
+		// ctype treating ',' as whitespace, the usual way to read CSV with iostreams
+		struct CommaSpace : std::ctype<char>
+		{
+			CommaSpace()
+				: std::ctype<char>{ table() }
+			{
+			}
+
+			static const mask* table()
+			{
+				static std::array<mask, table_size> commaTable{ [] {
+					std::array<mask, table_size> t{};
+					std::copy( classic_table(), classic_table() + table_size, t.begin() );
+					t[static_cast<unsigned char>( ',' )] |= space;
+
+					return t;
+				}() };
+
+				return commaTable.data();
+			}
+		};
+
+		std::istringstream iss{ "2024-01-15T12:30:45Z,2024-01-15T12:30:46Z,2024-01-15T12:30:47Z" };
+		DateTime dt;
+		std::string token;
+		iss >> token;
+		EXPECT_TRUE( iss.eof() ); // One token with the classic locale
+
+		iss.clear();
+		iss.seekg( 0 );
+		iss.imbue( std::locale{ iss.getloc(), new CommaSpace } );
+		iss >> dt;
+		EXPECT_EQ( dt, DateTime( 2024, 1, 15, 12, 30, 45 ) );
+		iss >> dt;
+		EXPECT_EQ( dt, DateTime( 2024, 1, 15, 12, 30, 46 ) );
+
+		// Back to the classic locale: the comma is part of the next token
+		iss.imbue( std::locale::classic() );
+		iss >> dt;
+		EXPECT_TRUE( iss.fail() );
+	}
+
+	TEST( DateTimeStreamOperators, InputHonoursWidthAndLongTokens )
+	{
+		// width() limits the token and is reset afterwards
+		std::istringstream iss{ "2024-01-15T12:30:45Zjunk 2024-01-15" };
+		DateTime dt;
+		iss >> std::setw( 20 ) >> dt;
+		EXPECT_EQ( dt, DateTime( 2024, 1, 15, 12, 30, 45 ) );
+		EXPECT_EQ( iss.width(), 0 );
+		iss >> dt;
+		EXPECT_TRUE( iss.fail() );
+
+		// A token longer than any formatted value is consumed whole and parsed as fromString() would
+		const std::string longToken{ "2024-01-15T12:30:45." + std::string( 100, '1' ) + "Z" };
+		std::istringstream longStream{ longToken + " next" };
+		DateTime parsed;
+		const bool expectedValid{ DateTime::fromString( longToken, dt ) };
+		longStream >> parsed;
+		EXPECT_EQ( !longStream.fail(), expectedValid );
+		if ( expectedValid )
+		{
+			EXPECT_EQ( parsed, dt );
+		}
+		longStream.clear();
+		std::string rest;
+		longStream >> rest;
+		EXPECT_EQ( rest, "next" );
+	}
+
+	TEST( DateTimeStreamOperators, InputFromUnbufferedStreambuf )
+	{
+		// Conforming stream buffer without a get area: underflow() peeks, uflow() consumes
+		class UnbufferedBuf : public std::streambuf
+		{
+		public:
+			explicit UnbufferedBuf( std::string_view text )
+				: m_text{ text }
+			{
+			}
+
+		protected:
+			int_type underflow() override
+			{
+				return m_position < m_text.size() ? traits_type::to_int_type( m_text[m_position] ) : traits_type::eof();
+			}
+
+			int_type uflow() override
+			{
+				const int_type c{ underflow() };
+				if ( !traits_type::eq_int_type( c, traits_type::eof() ) )
+				{
+					++m_position;
+				}
+
+				return c;
+			}
+
+		private:
+			std::string_view m_text;
+			std::size_t m_position{ 0 };
+		};
+
+		UnbufferedBuf buf{ " 2024-06-15T13:45:30Z\t2024-06-15T13:45:31.5Z" };
+		std::istream is{ &buf };
+		DateTime dt;
+
+		is >> dt;
+		EXPECT_EQ( dt, DateTime( 2024, 6, 15, 13, 45, 30 ) );
+		EXPECT_TRUE( is.good() );
+
+		is >> dt;
+		EXPECT_EQ( dt, DateTime( 2024, 6, 15, 13, 45, 31, 500 ) );
+		EXPECT_TRUE( is.eof() );
+		EXPECT_FALSE( is.fail() );
+
+		is >> dt;
+		EXPECT_TRUE( is.fail() );
+	}
+
 	//----------------------------------------------
 	// std::formatter support
 	//----------------------------------------------
@@ -710,6 +1189,38 @@ namespace nfx::time::test
 		EXPECT_NE( mixed.find( "2024-11-16" ), std::string::npos );
 	}
 
+	TEST( DateTimeFormatter, NamedSpecs )
+	{
+		const DateTime dt{ DateTime{ 2024, 6, 15, 13, 45, 30, 123 } + TimeSpan{ 4567 } };
+
+		EXPECT_EQ( std::format( "{:iso}", dt ), "2024-06-15T13:45:30Z" );
+		EXPECT_EQ( std::format( "{:ext}", dt ), "2024-06-15T13:45:30.1234567Z" );
+		EXPECT_EQ( std::format( "{:offset}", dt ), "2024-06-15T13:45:30+00:00" );
+		EXPECT_EQ( std::format( "{:date}", dt ), "2024-06-15" );
+		EXPECT_EQ( std::format( "{:time}", dt ), "13:45:30" );
+		EXPECT_EQ( std::format( "{:unix}", dt ), std::to_string( dt.toEpochSeconds() ) );
+		EXPECT_EQ( std::format( "{:ms}", dt ), std::to_string( dt.toEpochMilliseconds() ) );
+
+	}
+
+	TEST( DateTimeFormatter, PatternSpec )
+	{
+		const DateTime dt{ 2024, 6, 15, 13, 45, 30, 123 };
+
+		EXPECT_EQ( std::format( "{:%Y-%m-%d %H:%M}", dt ), "2024-06-15 13:45" );
+		EXPECT_EQ( std::format( "[{:%d/%b/%Y:%T %z}] GET", dt ), "[15/Jun/2024:13:45:30 +00:00] GET" );
+		EXPECT_EQ( std::format( "{:%a %j %f}", dt ), "Sat 167 1230000" );
+	}
+
+	TEST( DateTimeFormatter, InvalidSpecThrows )
+	{
+		const DateTime dt{ 2024, 6, 15 };
+
+		EXPECT_THROW( (void)std::vformat( "{:nope}", std::make_format_args( dt ) ), std::format_error );
+		EXPECT_THROW( (void)std::vformat( "{:%Q}", std::make_format_args( dt ) ), std::format_error );
+		EXPECT_THROW( (void)std::vformat( "{:%Y%}", std::make_format_args( dt ) ), std::format_error );
+	}
+
 	//----------------------------------------------
 	// Integration
 	//----------------------------------------------
@@ -336,6 +336,23 @@ namespace nfx::time::test
 		EXPECT_EQ( dto.dayOfYear(), 15 ); // 15th day of year
 	}
 
+	TEST( DateTimeOffsetAccessors, Components )
+	{
+		DateTimeOffset dto{ 2024, 12, 31, 23, 45, 10, 250, TimeSpan::fromHours( -5.0 ) };
+		const auto c{ dto.components() };
+
+		// Local fields, offset is not applied
+		EXPECT_EQ( c.year, dto.year() );
+		EXPECT_EQ( c.month, dto.month() );
+		EXPECT_EQ( c.day, dto.day() );
+		EXPECT_EQ( c.hour, 23 );
+		EXPECT_EQ( c.minute, 45 );
+		EXPECT_EQ( c.second, 10 );
+		EXPECT_EQ( c.fractionTicks, 2500000 );
+		EXPECT_EQ( c.dayOfWeek, dto.dayOfWeek() );
+		EXPECT_EQ( c.dayOfYear, 366 );
+	}
+
 	//----------------------------------------------
 	// Conversion methods
 	//----------------------------------------------
@@ -467,6 +484,54 @@ namespace nfx::time::test
 		EXPECT_NE( str.find( "+01:00" ), std::string::npos );
 	}
 
+	TEST( DateTimeOffsetStringFormatting, ToCharsMatchesToString )
+	{
+		const DateTimeOffset value{ DateTime{ 2024, 3, 10, 9, 15, 22 } + TimeSpan{ 1234560 }, TimeSpan::fromMinutes( -570 ) };
+
+		// Fractions are written in millisecond, microsecond or tick groups; offsets as Z or ±HH:MM
+		EXPECT_EQ( value.toString( DateTime::Format::Iso8601Extended ), "2024-03-10T09:15:22.123456-09:30" );
+		EXPECT_EQ( DateTimeOffset( DateTime{ 2024, 3, 10 } + TimeSpan{ 1200000 }, TimeSpan{ 0 } ).toIso8601Extended(), "2024-03-10T00:00:00.120Z" );
+		EXPECT_EQ( DateTimeOffset( DateTime{ 2024, 3, 10 } + TimeSpan{ 1 }, TimeSpan{ 0 } ).toIso8601Extended(), "2024-03-10T00:00:00.0000001Z" );
+		EXPECT_EQ( DateTimeOffset( DateTime{ 2024, 3, 10 }, TimeSpan{ 0 } ).toIso8601Extended(), "2024-03-10T00:00:00Z" );
+		EXPECT_EQ( value.toString( DateTime::Format::TimeOnly ), "09:15:22-09:30" );
+
+		// Worst case fits in MAX_ISO8601_LENGTH
+		const DateTimeOffset widest{ DateTime::max(), TimeSpan::fromHours( -14 ) };
+		char buffer[constants::MAX_ISO8601_LENGTH];
+		const auto result{ widest.toChars( buffer, buffer + sizeof( buffer ), DateTime::Format::Iso8601Extended ) };
+		ASSERT_EQ( result.ec, std::errc{} );
+		EXPECT_EQ( std::string( buffer, result.ptr ), "9999-12-31T23:59:59.9999999-14:00" );
+
+		const DateTime::Format formats[]{ DateTime::Format::Iso8601Basic, DateTime::Format::Iso8601Extended, DateTime::Format::Iso8601WithOffset,
+			DateTime::Format::DateOnly, DateTime::Format::TimeOnly, DateTime::Format::UnixSeconds, DateTime::Format::UnixMilliseconds };
+		for ( DateTime::Format format : formats )
+		{
+			const auto written{ value.toChars( buffer, buffer + sizeof( buffer ), format ) };
+			ASSERT_EQ( written.ec, std::errc{} );
+			EXPECT_EQ( std::string( buffer, written.ptr ), value.toString( format ) );
+		}
+		EXPECT_EQ( value.toChars( buffer, buffer + 5 ).ec, std::errc::value_too_large );
+	}
+
+	TEST( DateTimeOffsetStringFormatting, ToFixedStringMatchesToString )
+	{
+		const DateTime::Format formats[]{ DateTime::Format::Iso8601Basic, DateTime::Format::Iso8601Extended, DateTime::Format::Iso8601WithOffset,
+			DateTime::Format::DateOnly, DateTime::Format::TimeOnly, DateTime::Format::UnixSeconds, DateTime::Format::UnixMilliseconds };
+		const DateTimeOffset values[]{ DateTimeOffset{ DateTime::max(), TimeSpan::fromHours( -14 ) }, DateTimeOffset{ DateTime::min(), TimeSpan::fromHours( 14 ) },
+			DateTimeOffset{ DateTime{ 2024, 3, 10, 9, 15, 22 } + TimeSpan{ 1234560 }, TimeSpan::fromMinutes( -570 ) } };
+
+		for ( const DateTimeOffset& value : values )
+		{
+			for ( DateTime::Format format : formats )
+			{
+				EXPECT_EQ( std::string_view{ value.toFixedString( format ) }, value.toString( format ) );
+			}
+		}
+
+		// Widest value of any format
+		EXPECT_EQ( values[0].toFixedString( DateTime::Format::Iso8601Extended ), "9999-12-31T23:59:59.9999999-14:00" );
+	}
+
 	//----------------------------------------------
 	// Comparison methods
 	//----------------------------------------------
@@ -504,6 +569,16 @@ namespace nfx::time::test
 	// Static factory methods
 	//----------------------------------------------
 
+	TEST( DateTimeOffsetFactory, UtcNowCoarse )
+	{
+		const DateTimeOffset coarse{ DateTimeOffset::utcNowCoarse() };
+		const DateTimeOffset after{ DateTimeOffset::utcNow() };
+
+		EXPECT_EQ( coarse.offset(), TimeSpan{ 0 } );
+		EXPECT_LE( coarse, after );
+		EXPECT_GE( coarse.dateTime(), after.dateTime() - DateTime::coarseClockResolution() - TimeSpan::fromMilliseconds( 10.0 ) );
+	}
+
 	TEST( DateTimeOffsetFactory, MinMaxValues )
 	{
 		DateTimeOffset minVal{ DateTimeOffset::min() };
@@ -690,6 +765,91 @@ namespace nfx::time::test
 		EXPECT_TRUE( DateTimeOffset::fromString( "2024-01-15T12:00:00+14" ).has_value() );
 	}
 
+	TEST( DateTimeOffsetStringParsing, CompileTimeLiteral )
+	{
+		using namespace nfx::time::literals;
+
+		// Evaluated entirely at compile time
+		constexpr auto opening{ "2025-01-01T09:30:00+02:00"_dto };
+		static_assert( opening.offset() == TimeSpan::fromHours( 2 ) );
+		static_assert( opening.utcTicks() == ( "2025-01-01T07:30:00Z"_dt ).ticks() );
+		static_assert( ( "2025-01-01T09:30:00-0530"_dto ).offset() == TimeSpan::fromMinutes( -330 ) );
+		static_assert( ( "2025-01-01T09:30:00Z"_dto ).offset() == TimeSpan{ 0 } );
+
+		EXPECT_TRUE( opening.equalsExact( *DateTimeOffset::fromString( "2025-01-01T09:30:00+02:00" ) ) );
+		EXPECT_TRUE( ( "2024-01-15T12:00:00-14"_dto ).equalsExact( *DateTimeOffset::fromString( "2024-01-15T12:00:00-14:00" ) ) );
+
+		// The shared parser rejects what fromString() rejects, so bad literals fail to compile
+		static_assert( []() {
+			std::int64_t ticks{ 0 };
+			std::int64_t offsetTicks{ 0 };
+			return !internal::parseDateTimeOffset( "2024-01-15T12:00:00+14:01", ticks, offsetTicks ) &&
+				   !internal::parseDateTimeOffset( "2024-01-15T12:00:00+-05:00", ticks, offsetTicks ) &&
+				   !internal::parseDateTimeOffset( "2024-01-15T12:00:00+123", ticks, offsetTicks );
+		}() );
+	}
+
+	TEST( DateTimeOffsetStringParsing, OffsetFormsShareDateTimePass )
+	{
+		// Every offset style yields the same local clock time as DateTime::fromString()
+		const char* inputs[]{
+			"2024-06-15T13:45:30.1234567+05:30",
+			"2024-06-15T13:45:30.25-0800",
+			"2024-06-15T13:45:30+02",
+			"2024-06-15 13:45:30Z",
+			"2024-6-5T3:04:05.5-01:00",
+			"2024-06-15",
+		};
+
+		for ( const char* input : inputs )
+		{
+			auto dto{ DateTimeOffset::fromString( input ) };
+			auto dt{ DateTime::fromString( input ) };
+			ASSERT_TRUE( dto.has_value() ) << input;
+			ASSERT_TRUE( dt.has_value() ) << input;
+			EXPECT_EQ( dto->ticks(), dt->ticks() ) << input;
+		}
+
+		EXPECT_EQ( DateTimeOffset::fromString( "2024-06-15T13:45:30.1234567+05:30" )->offset(), TimeSpan::fromMinutes( 330 ) );
+		EXPECT_EQ( DateTimeOffset::fromString( "2024-06-15T13:45:30.25-0800" )->offset(), TimeSpan::fromHours( -8 ) );
+		EXPECT_EQ( DateTimeOffset::fromString( "2024-6-5T3:04:05.5-01:00" )->offset(), TimeSpan::fromHours( -1 ) );
+		EXPECT_EQ( DateTimeOffset::fromString( "2024-06-15" )->offset(), TimeSpan{ 0 } );
+
+		// Out-of-range components are caught by the shared pass before the offset is looked at
+		EXPECT_FALSE( DateTimeOffset::fromString( "2024-02-30T13:45:30+05:30" ).has_value() );
+		EXPECT_FALSE( DateTimeOffset::fromString( "2024-06-15T24:45:30-0800" ).has_value() );
+	}
+
+	TEST( DateTimeOffsetStringParsing, ParseWithPattern )
+	{
+		// Apache common log timestamp
+		auto logged{ DateTimeOffset::parse<"%d/%b/%Y:%H:%M:%S %z">( "10/Oct/2000:13:55:36 -0700" ) };
+		ASSERT_TRUE( logged.has_value() );
+		EXPECT_EQ( logged->dateTime(), ( DateTime{ 2000, 10, 10, 13, 55, 36 } ) );
+		EXPECT_EQ( logged->offset(), TimeSpan::fromHours( -7 ) );
+
+		// Every %z form, matching fromString() on the same text
+		const char* inputs[]{
+			"2024-06-15T13:45:30.1234567+05:30",
+			"2024-06-15T13:45:30.25-0800",
+			"2024-06-15T13:45:30.5+02",
+			"2024-06-15T13:45:30.0Z",
+		};
+		for ( const char* input : inputs )
+		{
+			EXPECT_EQ( DateTimeOffset::parse<"%FT%T.%f%z">( input ), DateTimeOffset::fromString( input ) ) << input;
+		}
+
+		// No %z means a zero offset
+		EXPECT_EQ( DateTimeOffset::parse<"%F %T">( "2024-06-15 13:45:30" )->offset(), TimeSpan{ 0 } );
+
+		DateTimeOffset result;
+		EXPECT_FALSE( DateTimeOffset::parse<"%F %T%z">( "2024-06-15 13:45:30", result ) );
+		EXPECT_FALSE( DateTimeOffset::parse<"%F %T%z">( "2024-06-15 13:45:30+5", result ) );
+		EXPECT_FALSE( DateTimeOffset::parse<"%F %T%z">( "2024-06-15 13:45:30+05:60", result ) );
+		EXPECT_FALSE( DateTimeOffset::parse<"%F %T%z">( "2024-06-15 13:45:30+15", result ) );
+	}
+
 	//----------------------------------------------
 	// Stream operators
 	//----------------------------------------------
@@ -716,6 +876,31 @@ namespace nfx::time::test
 		EXPECT_EQ( dto.offset().hours(), 2.0 );
 	}
 
+	TEST( DateTimeOffsetStreamOperators, RoundTrip )
+	{
+		const DateTimeOffset values[]{ DateTimeOffset{ 2024, 1, 15, 12, 30, 45, TimeSpan::fromHours( 2.0 ) },
+			DateTimeOffset{ DateTime::max(), TimeSpan::fromHours( -14 ) }, DateTimeOffset{ DateTime::min(), TimeSpan{ 0 } } };
+		std::stringstream stream;
+		for ( const auto& value : values )
+		{
+			stream << value << '\n';
+		}
+		EXPECT_EQ( stream.str(), values[0].toString() + "\n" + values[1].toString() + "\n" + values[2].toString() + "\n" );
+
+		for ( const auto& value : values )
+		{
+			DateTimeOffset parsed;
+			stream >> parsed;
+			ASSERT_FALSE( stream.fail() );
+			EXPECT_TRUE( parsed.equalsExact( DateTimeOffset{ value.dateTime() - TimeSpan{ value.dateTime().ticks() % constants::TICKS_PER_SECOND }, value.offset() } ) );
+		}
+
+		DateTimeOffset parsed;
+		stream >> parsed;
+		EXPECT_TRUE( stream.fail() );
+		EXPECT_TRUE( stream.eof() );
+	}
+
 	//----------------------------------------------
 	// std::formatter support
 	//----------------------------------------------
@@ -784,6 +969,24 @@ namespace nfx::time::test
 		// Should show +00:00 or Z for UTC
 	}
 
+	TEST( DateTimeOffsetFormatter, NamedSpecs )
+	{
+		const DateTimeOffset dto{ 2024, 6, 15, 13, 45, 30, 123, TimeSpan::fromHours( -5.0 ) };
+
+		EXPECT_EQ( std::format( "{:iso}", dto ), dto.toString() );
+		EXPECT_EQ( std::format( "{:ext}", dto ), dto.toString( DateTime::Format::Iso8601Extended ) );
+		EXPECT_EQ( std::format( "{:date}", dto ), "2024-06-15" );
+		EXPECT_EQ( std::format( "{:ms}", dto ), dto.toString( DateTime::Format::UnixMilliseconds ) );
+	}
+
+	TEST( DateTimeOffsetFormatter, PatternSpec )
+	{
+		const DateTimeOffset dto{ 2024, 6, 15, 13, 45, 30, TimeSpan::fromHours( 5.5 ) };
+
+		EXPECT_EQ( std::format( "{:%Y-%m-%d %H:%M %z}", dto ), "2024-06-15 13:45 +05:30" );
+		EXPECT_THROW( (void)std::vformat( "{:week}", std::make_format_args( dto ) ), std::format_error );
+	}
+
 	//----------------------------------------------
 	// Edge cases and validation
 	//----------------------------------------------
@@ -0,0 +1,94 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_FixedString.cpp
+ * @brief Unit tests for the inline FixedString result type
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <format>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include <nfx/datetime/FixedString.h>
+
+namespace nfx::time::test
+{
+	//=====================================================================
+	// FixedString tests
+	//=====================================================================
+
+	TEST( FixedString, ConstructionAndAccessors )
+	{
+		constexpr FixedString<8> empty;
+		static_assert( empty.empty() );
+		static_assert( FixedString<8>::capacity() == 8 );
+		EXPECT_STREQ( empty.c_str(), "" );
+
+		constexpr FixedString<8> text{ std::string_view{ "P1D" } };
+		static_assert( text.size() == 3 );
+		static_assert( text == "P1D" );
+		EXPECT_STREQ( text.c_str(), "P1D" );
+		EXPECT_EQ( std::string( text.begin(), text.end() ), "P1D" );
+		EXPECT_EQ( text.str(), "P1D" );
+
+		// Longer input is cut at the capacity
+		const FixedString<4> cut{ std::string_view{ "2024-06-15" } };
+		EXPECT_EQ( cut.view(), "2024" );
+		EXPECT_STREQ( cut.c_str(), "2024" );
+	}
+
+	TEST( FixedString, ResizeAfterWriting )
+	{
+		FixedString<8> text;
+		std::memcpy( text.data(), "12:30:45", 8 );
+		text.resize( 5 );
+		EXPECT_EQ( text, "12:30" );
+		EXPECT_STREQ( text.c_str(), "12:30" );
+
+		// Lengths past the capacity are clamped
+		std::memcpy( text.data(), "12:30:45", 8 );
+		text.resize( 100 );
+		EXPECT_EQ( text.size(), 8u );
+		EXPECT_STREQ( text.c_str(), "12:30:45" );
+	}
+
+	TEST( FixedString, ConvertsToStringView )
+	{
+		const FixedString<16> text{ std::string_view{ "2024-06-15" } };
+		const auto takesView{ []( std::string_view view ) { return view.size(); } };
+		EXPECT_EQ( takesView( text ), 10u );
+
+		std::ostringstream os;
+		os << text;
+		EXPECT_EQ( os.str(), "2024-06-15" );
+
+		EXPECT_EQ( std::format( "[{}]", text ), "[2024-06-15]" );
+		EXPECT_EQ( std::format( "[{:>12}]", text ), "[  2024-06-15]" );
+	}
+} // namespace nfx::time::test
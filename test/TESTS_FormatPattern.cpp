@@ -0,0 +1,174 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_FormatPattern.cpp
+ * @brief Unit tests for compiled FormatPattern output patterns
+ */
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <nfx/datetime/FormatPattern.h>
+#include <nfx/datetime/ParsePattern.h>
+
+namespace nfx::time::test
+{
+	//=====================================================================
+	// FormatPattern tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	/** @brief Format into a string through the output iterator overload */
+	template <typename T>
+	static std::string formatted( const FormatPattern& pattern, const T& value )
+	{
+		std::string result;
+		pattern.format( value, std::back_inserter( result ) );
+
+		return result;
+	}
+
+	//----------------------------------------------
+	// DateTime and DateTimeOffset
+	//----------------------------------------------
+
+	TEST( FormatPatternTest, MatchesToString )
+	{
+		static constexpr FormatPattern basic{ "%FT%TZ" };
+		static constexpr FormatPattern dateOnly{ "%F" };
+		static constexpr FormatPattern timeOnly{ "%T" };
+
+		const DateTime values[]{ DateTime::min(), DateTime::max(), DateTime::epoch(), DateTime{ 2024, 2, 29, 23, 59, 59, 999 }, DateTime{ 999, 1, 9, 1, 2, 3 } };
+		for ( const DateTime& value : values )
+		{
+			EXPECT_EQ( formatted( basic, value ), value.toString() );
+			EXPECT_EQ( formatted( dateOnly, value ), value.toString( DateTime::Format::DateOnly ) );
+			EXPECT_EQ( formatted( timeOnly, value ), value.toString( DateTime::Format::TimeOnly ) );
+		}
+
+		const DateTimeOffset offsetValue{ 2024, 6, 15, 13, 45, 30, TimeSpan::fromMinutes( -330 ) };
+		EXPECT_EQ( formatted( FormatPattern{ "%FT%T%z" }, offsetValue ), offsetValue.toString() );
+	}
+
+	TEST( FormatPatternTest, EverySpecifier )
+	{
+		const DateTime value{ DateTime{ 2024, 6, 15, 13, 5, 9 } + TimeSpan{ 1234567 } };
+		const FormatPattern pattern{ "%a %d %b %Y|%m|%j|%H:%M:%S.%f|%z|%%" };
+
+		EXPECT_EQ( formatted( pattern, value ), "Sat 15 Jun 2024|06|167|13:05:09.1234567|+00:00|%" );
+		EXPECT_EQ( formatted( pattern, DateTimeOffset{ value, TimeSpan::fromHours( 14 ) } ), "Sat 15 Jun 2024|06|167|13:05:09.1234567|+14:00|%" );
+		EXPECT_EQ( formatted( FormatPattern{ "%a %b %j" }, DateTime{ 2023, 1, 1 } ), "Sun Jan 001" );
+		EXPECT_EQ( formatted( FormatPattern{ "%a %b %j" }, DateTime{ 2024, 12, 31 } ), "Tue Dec 366" );
+		EXPECT_EQ( formatted( FormatPattern{ "" }, value ), "" );
+		EXPECT_EQ( formatted( FormatPattern{ "no fields" }, value ), "no fields" );
+	}
+
+	TEST( FormatPatternTest, RoundTripsThroughParsePattern )
+	{
+		const char* patterns[]{ "%FT%T.%f%z", "%d/%b/%Y:%H:%M:%S.%f %z", "%Y.%j %H%M%S.%f%z" };
+		const DateTimeOffset values[]{
+			DateTimeOffset{ DateTime{ 2024, 2, 29, 23, 59, 59 } + TimeSpan{ 9999999 }, TimeSpan::fromMinutes( 345 ) },
+			DateTimeOffset{ DateTime{ 1, 1, 1 }, TimeSpan::fromHours( -14 ) },
+			DateTimeOffset{ DateTime{ 9999, 12, 31, 12, 0, 0 }, TimeSpan{ 0 } } };
+
+		for ( const char* text : patterns )
+		{
+			const FormatPattern output{ text };
+			const ParsePattern input{ text };
+			for ( const DateTimeOffset& value : values )
+			{
+				auto parsed{ input.parseDateTimeOffset( formatted( output, value ) ) };
+				ASSERT_TRUE( parsed.has_value() ) << text;
+				EXPECT_TRUE( parsed->equalsExact( value ) ) << text;
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// TimeSpan
+	//----------------------------------------------
+
+	TEST( FormatPatternTest, TimeSpanFields )
+	{
+		const FormatPattern pattern{ "%d.%H:%M:%S.%f" };
+
+		EXPECT_EQ( formatted( pattern, TimeSpan{ 0 } ), "0.00:00:00.0000000" );
+		EXPECT_EQ( formatted( pattern, TimeSpan::fromHours( 49 ) + TimeSpan{ 1 } ), "2.01:00:00.0000001" );
+		EXPECT_EQ( formatted( pattern, TimeSpan::fromMinutes( -90 ) ), "-0.01:30:00.0000000" );
+		EXPECT_EQ( formatted( pattern, TimeSpan{ std::numeric_limits<std::int64_t>::min() } ), "-10675199.02:48:05.4775808" );
+
+		char buffer[64];
+		EXPECT_THROW( formatted( FormatPattern{ "%Y %H" }, TimeSpan{ 0 } ), std::invalid_argument );
+		EXPECT_EQ( FormatPattern{ "%H %z" }.format( TimeSpan{ 0 }, buffer, buffer + sizeof( buffer ) ).ec, std::errc::invalid_argument );
+	}
+
+	//----------------------------------------------
+	// Buffers and patterns
+	//----------------------------------------------
+
+	TEST( FormatPatternTest, BoundedBuffer )
+	{
+		static constexpr FormatPattern pattern{ "%FT%T.%f%z" };
+		const DateTimeOffset value{ 2024, 6, 15, 13, 45, 30, TimeSpan::fromHours( 2 ) };
+		const std::string expected{ "2024-06-15T13:45:30.0000000+02:00" };
+		EXPECT_GE( pattern.maxLength(), expected.size() );
+
+		// Exact fit below maxLength() is staged and copied; one byte less is too small
+		char buffer[FormatPattern::MAX_OUTPUT_LENGTH];
+		auto exact{ pattern.format( value, buffer, buffer + expected.size() ) };
+		EXPECT_EQ( exact.ec, std::errc{} );
+		EXPECT_EQ( std::string( buffer, exact.ptr ), expected );
+
+		auto small{ pattern.format( value, buffer, buffer + expected.size() - 1 ) };
+		EXPECT_EQ( small.ec, std::errc::value_too_large );
+		EXPECT_EQ( small.ptr, buffer + expected.size() - 1 );
+
+		auto roomy{ pattern.format( value, buffer, buffer + sizeof( buffer ) ) };
+		EXPECT_EQ( std::string( buffer, roomy.ptr ), expected );
+	}
+
+	TEST( FormatPatternTest, RejectsMalformedPatterns )
+	{
+		EXPECT_THROW( FormatPattern{ "%Y %q" }, std::invalid_argument );
+		EXPECT_THROW( FormatPattern{ "%Y %" }, std::invalid_argument );
+		EXPECT_THROW( FormatPattern{ std::string( FormatPattern::MAX_LITERALS + 1, 'x' ) }, std::invalid_argument );
+		EXPECT_NO_THROW( FormatPattern{ std::string( FormatPattern::MAX_LITERALS, 'x' ) } );
+
+		std::string fields;
+		for ( std::size_t i{ 0 }; i < FormatPattern::MAX_STEPS; ++i )
+		{
+			fields += "%H";
+		}
+		EXPECT_NO_THROW( FormatPattern{ fields } );
+		EXPECT_THROW( FormatPattern{ fields + "%M" }, std::invalid_argument );
+	}
+} // namespace nfx::time::test
@@ -0,0 +1,162 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_IncrementalTimestampParser.cpp
+ * @brief Unit tests for the prefix-reusing IncrementalTimestampParser
+ * @details Every result is checked against DateTime::fromString() and
+ *          DateTimeOffset::fromString()
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <nfx/datetime/IncrementalTimestampParser.h>
+
+namespace nfx::time::test
+{
+	//=====================================================================
+	// IncrementalTimestampParser tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	/** @brief Sorted lines crossing minute, hour, day, month and year boundaries, with strays mixed in */
+	static std::vector<std::string> sortedCorpus()
+	{
+		const std::vector<std::string> suffixes{ "", "Z", ".5Z", ".1234567+05:30", ".12345678-0800", "+14:01", "x", ".Z" };
+		const std::vector<std::string> prefixes{
+			"2023-12-31T23:58:59", "2023-12-31T23:59:00", "2023-12-31T23:59:59", "2024-01-01T00:00:00",
+			"2024-01-01T00:00:01", "2024-01-01T00:01:00", "2024-01-01T01:01:00", "2024-01-31T23:59:59",
+			"2024-02-01T00:00:00", "2024-02-29T12:00:00", "2024-02-29T12:00:60", "2024-02-29T12:00:5",
+			"2024-02-29T12:00:059", "2024-02-29T24:00:00", "2024-02-29T12:60:00", "2024-02-29T1:00:00",
+			"2024-02-29T12:00:00", "2024-02-29T12:0a:00", "2024-02-29 12:00:00", "2024-02-30T12:00:00",
+			"2024-02-29T12:00:01" };
+
+		std::vector<std::string> corpus;
+		for ( const auto& prefix : prefixes )
+		{
+			for ( const auto& suffix : suffixes )
+			{
+				corpus.push_back( prefix + suffix );
+			}
+		}
+		corpus.push_back( "2024-02-29" );
+		corpus.push_back( "2024-02-29T12:00" );
+		corpus.push_back( "" );
+
+		return corpus;
+	}
+
+	//----------------------------------------------
+	// Equivalence with fromString()
+	//----------------------------------------------
+
+	TEST( IncrementalTimestampParser, DateTimeMatchesFromString )
+	{
+		IncrementalTimestampParser parser;
+		for ( const auto& text : sortedCorpus() )
+		{
+			const auto expected{ DateTime::fromString( text ) };
+			DateTime actual;
+			ASSERT_EQ( parser.parse( text, actual ), expected.has_value() ) << "'" << text << "'";
+			if ( expected )
+			{
+				ASSERT_EQ( actual, *expected ) << "'" << text << "'";
+			}
+		}
+		EXPECT_GT( parser.minuteHits(), 0u );
+		EXPECT_GT( parser.dayHits(), 0u );
+	}
+
+	TEST( IncrementalTimestampParser, DateTimeOffsetMatchesFromString )
+	{
+		IncrementalTimestampParser parser;
+		for ( const auto& text : sortedCorpus() )
+		{
+			const auto expected{ DateTimeOffset::fromString( text ) };
+			DateTimeOffset actual;
+			ASSERT_EQ( parser.parse( text, actual ), expected.has_value() ) << "'" << text << "'";
+			if ( expected )
+			{
+				ASSERT_EQ( actual.dateTime(), expected->dateTime() ) << "'" << text << "'";
+				ASSERT_EQ( actual.offset(), expected->offset() ) << "'" << text << "'";
+			}
+		}
+		EXPECT_GT( parser.minuteHits(), 0u );
+		EXPECT_GT( parser.dayHits(), 0u );
+	}
+
+	//----------------------------------------------
+	// Reuse levels and statistics
+	//----------------------------------------------
+
+	TEST( IncrementalTimestampParser, CountsReuseLevels )
+	{
+		IncrementalTimestampParser parser;
+		DateTimeOffset value;
+
+		EXPECT_TRUE( parser.parse( "2024-06-15T13:45:30.120Z", value ) );
+		EXPECT_TRUE( parser.parse( "2024-06-15T13:45:31.004Z", value ) );
+		EXPECT_EQ( value.dateTime(), DateTime( 2024, 6, 15, 13, 45, 31, 4 ) );
+		EXPECT_TRUE( parser.parse( "2024-06-15T13:46:02.917+02:00", value ) );
+		EXPECT_EQ( value.dateTime(), DateTime( 2024, 6, 15, 13, 46, 2, 917 ) );
+		EXPECT_EQ( value.offset(), TimeSpan::fromHours( 2 ) );
+		EXPECT_TRUE( parser.parse( "2024-06-15T13:46:03Z", value ) );
+		EXPECT_TRUE( parser.parse( "2024-06-16T00:00:00.001Z", value ) );
+		EXPECT_EQ( value.dateTime(), DateTime( 2024, 6, 16, 0, 0, 0, 1 ) );
+
+		EXPECT_EQ( parser.minuteHits(), 2u );
+		EXPECT_EQ( parser.dayHits(), 1u );
+		EXPECT_EQ( parser.misses(), 2u );
+
+		parser.resetStatistics();
+		EXPECT_TRUE( parser.parse( "2024-06-16T00:00:59Z", value ) );
+		EXPECT_EQ( parser.minuteHits(), 1u );
+		EXPECT_EQ( parser.misses(), 0u );
+
+		parser.reset();
+		EXPECT_TRUE( parser.parse( "2024-06-16T00:00:59Z", value ) );
+		EXPECT_EQ( parser.minuteHits(), 0u );
+		EXPECT_EQ( parser.misses(), 1u );
+	}
+
+	TEST( IncrementalTimestampParser, InvalidInputKeepsCache )
+	{
+		IncrementalTimestampParser parser;
+		DateTime value;
+
+		EXPECT_TRUE( parser.parse( "2024-06-15T13:45:30Z", value ) );
+		EXPECT_FALSE( parser.parse( "2024-06-15T13:45:60Z", value ) );
+		EXPECT_FALSE( parser.parse( "2024-02-30T13:45:30Z", value ) );
+		EXPECT_FALSE( parser.parse( "garbage", value ) );
+		EXPECT_TRUE( parser.parse( "2024-06-15T13:45:31Z", value ) );
+		EXPECT_EQ( value, DateTime( 2024, 6, 15, 13, 45, 31 ) );
+		EXPECT_EQ( parser.minuteHits(), 1u );
+	}
+} // namespace nfx::time::test
@@ -0,0 +1,155 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_ParsePattern.cpp
+ * @brief Unit tests for run-time compiled ParsePattern formats
+ * @details Results are checked against DateTime::parse<"...">() with the same pattern
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nfx/datetime/ParsePattern.h>
+
+namespace nfx::time::test
+{
+	//=====================================================================
+	// ParsePattern tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	/** @brief Inputs exercising each specifier, valid and invalid */
+	static const std::vector<std::string> INPUTS{
+		"2024-06-15T13:45:30", "2024-06-15T13:45:30.1234567+05:30", "2024-06-15 13:45:30", "2024-02-30T13:45:30",
+		"2024-06-15T24:45:30", "10/Oct/2000:13:55:36 -0700", "10/oct/2000:13:55:36 +14:00", "10/Oct/2000:13:55:36 +1401",
+		"31/Dec/1999:23:59:59 Z", "2024.366 12:00", "2023.366 12:00", "2024.000 12:00", "20240615134530",
+		"20240615134530.5Z", "2024-06-15T13:45:30.", "2024-06-15T13:45:30.123456789-08", "" };
+
+	/** @brief Expect ParsePattern to agree with the compile-time pattern on every input */
+	template <internal::PatternLiteral Pattern>
+	static void expectSameAsCompileTime()
+	{
+		const ParsePattern runtime{ Pattern.view() };
+		for ( const std::string& input : INPUTS )
+		{
+			EXPECT_EQ( runtime.parseDateTime( input ), DateTime::parse<Pattern>( input ) ) << Pattern.view() << " " << input;
+
+			auto expected{ DateTimeOffset::parse<Pattern>( input ) };
+			auto actual{ runtime.parseDateTimeOffset( input ) };
+			ASSERT_EQ( actual.has_value(), expected.has_value() ) << Pattern.view() << " " << input;
+			if ( expected )
+			{
+				EXPECT_TRUE( actual->equalsExact( *expected ) ) << Pattern.view() << " " << input;
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Parsing
+	//----------------------------------------------
+
+	TEST( ParsePatternTest, MatchesCompileTimePatterns )
+	{
+		expectSameAsCompileTime<"%Y-%m-%dT%H:%M:%S">();
+		expectSameAsCompileTime<"%FT%T.%f%z">();
+		expectSameAsCompileTime<"%F %T">();
+		expectSameAsCompileTime<"%d/%b/%Y:%H:%M:%S %z">();
+		expectSameAsCompileTime<"%Y.%j %H:%M">();
+		expectSameAsCompileTime<"%Y%m%d%H%M%S">();
+		expectSameAsCompileTime<"%Y%m%d%H%M%S.%f%z">();
+	}
+
+	TEST( ParsePatternTest, ValidatesDateAndTime )
+	{
+		const ParsePattern pattern{ "%d/%b/%Y:%H:%M:%S %z" };
+		EXPECT_EQ( pattern.pattern(), "%d/%b/%Y:%H:%M:%S %z" );
+
+		DateTimeOffset result;
+		ASSERT_TRUE( pattern.parse( "29/Feb/2024:23:59:59 +05:30", result ) );
+		EXPECT_EQ( result.dateTime(), ( DateTime{ 2024, 2, 29, 23, 59, 59 } ) );
+		EXPECT_EQ( result.offset(), TimeSpan::fromMinutes( 330 ) );
+
+		EXPECT_FALSE( pattern.parse( "29/Feb/2023:23:59:59 +05:30", result ) );
+		EXPECT_FALSE( pattern.parse( "31/Apr/2024:23:59:59 +05:30", result ) );
+		EXPECT_FALSE( pattern.parse( "15/Jun/2024:23:60:00 +05:30", result ) );
+		EXPECT_FALSE( pattern.parse( "15/Jun/2024:23:59:60 +05:30", result ) );
+		EXPECT_FALSE( pattern.parse( "15/Jun/0000:12:00:00 +05:30", result ) );
+		EXPECT_FALSE( pattern.parse( "15/Jun/2024:12:00:00 +05:30 ", result ) );
+		EXPECT_FALSE( pattern.parse( "15/Jun/2024:12:00:00", result ) );
+	}
+
+	TEST( ParsePatternTest, RejectsMalformedPatterns )
+	{
+		EXPECT_THROW( ParsePattern{ "%Y-%m-%d %q" }, std::invalid_argument );
+		EXPECT_THROW( ParsePattern{ "%Y-%m-%d %" }, std::invalid_argument );
+		EXPECT_THROW( ParsePattern{ "%H:%M:%S" }, std::invalid_argument );
+		EXPECT_THROW( ParsePattern{ "%Y-%m" }, std::invalid_argument );
+		EXPECT_THROW( ParsePattern{ "%Y-%m-%d-%d" }, std::invalid_argument );
+		EXPECT_THROW( ParsePattern{ "%Y-%b-%m-%d" }, std::invalid_argument );
+		EXPECT_THROW( ParsePattern{ "%Y-%m-%d %T.%f%H" }, std::invalid_argument );
+		EXPECT_THROW( ParsePattern{ std::string( 70000, 'x' ) + "%F" }, std::invalid_argument );
+
+		EXPECT_NO_THROW( ParsePattern{ "%%%F%%" } );
+	}
+
+	TEST( ParsePatternTest, SharedAcrossThreads )
+	{
+		const ParsePattern pattern{ "%FT%T.%f%z" };
+		const auto expected{ DateTimeOffset::parse<"%FT%T.%f%z">( "2024-06-15T13:45:30.1234567+05:30" ) };
+		ASSERT_TRUE( expected.has_value() );
+
+		std::vector<std::thread> threads;
+		std::vector<int> mismatches( 4, 0 );
+		for ( std::size_t t{ 0 }; t < mismatches.size(); ++t )
+		{
+			threads.emplace_back( [&, t]() {
+				for ( int i{ 0 }; i < 10000; ++i )
+				{
+					DateTimeOffset value;
+					if ( !pattern.parse( "2024-06-15T13:45:30.1234567+05:30", value ) || !value.equalsExact( *expected ) )
+					{
+						++mismatches[t];
+					}
+				}
+			} );
+		}
+		for ( auto& thread : threads )
+		{
+			thread.join();
+		}
+
+		for ( int count : mismatches )
+		{
+			EXPECT_EQ( count, 0 );
+		}
+	}
+} // namespace nfx::time::test
@@ -31,6 +31,8 @@
 
 #include <gtest/gtest.h>
 
+#include <iomanip>
+#include <limits>
 #include <sstream>
 
 #include <nfx/datetime/TimeSpan.h>
@@ -733,6 +735,49 @@ namespace nfx::time::test
 		EXPECT_THROW( { [[maybe_unused]] auto _ = TimeSpan{ "PT" }; }, std::invalid_argument );
 	}
 
+	TEST( TimeSpanStringParsing, ExactTickPrecision )
+	{
+		// Components are accumulated in integer ticks, never rounded through double
+		EXPECT_EQ( TimeSpan::fromString( "PT0.0000001S" )->ticks(), 1 );
+		EXPECT_EQ( TimeSpan::fromString( "PT0.57S" )->ticks(), 5700000 );
+		EXPECT_EQ( TimeSpan::fromString( ".57" )->ticks(), 5700000 );
+		EXPECT_EQ( TimeSpan::fromString( "-PT0.0000001S" )->ticks(), -1 );
+		EXPECT_EQ( TimeSpan::fromString( "P1.5D" )->ticks(), TimeSpan::fromHours( 36 ).ticks() );
+		EXPECT_EQ( TimeSpan::fromString( "PT0.0000001H" )->ticks(), 3600 );
+		EXPECT_EQ( TimeSpan::fromString( "P9999999DT23H59M59.9999999S" )->ticks(), 8639999999999999999LL );
+
+		// Digits below tick precision are truncated toward zero
+		EXPECT_EQ( TimeSpan::fromString( "PT0.00000019S" )->ticks(), 1 );
+		EXPECT_EQ( TimeSpan::fromString( "-PT0.00000019S" )->ticks(), -1 );
+
+		// The full TimeSpan range is reachable from both ends
+		EXPECT_EQ( TimeSpan::fromString( "P10675199DT2H48M5.4775807S" )->ticks(), std::numeric_limits<std::int64_t>::max() );
+		EXPECT_EQ( TimeSpan::fromString( "-P10675199DT2H48M5.4775808S" )->ticks(), std::numeric_limits<std::int64_t>::min() );
+		EXPECT_EQ( TimeSpan::fromString( "922337203685.4775807" )->ticks(), std::numeric_limits<std::int64_t>::max() );
+	}
+
+	TEST( TimeSpanStringParsing, RejectOverflowAndMalformedInput )
+	{
+		// Totals outside the TimeSpan range
+		EXPECT_FALSE( TimeSpan::fromString( "P10675199DT2H48M5.4775808S" ).has_value() );
+		EXPECT_FALSE( TimeSpan::fromString( "P10675200D" ).has_value() );
+		EXPECT_FALSE( TimeSpan::fromString( "PT99999999999999999999H" ).has_value() );
+		EXPECT_FALSE( TimeSpan::fromString( "922337203685.4775808" ).has_value() );
+
+		// Anything but digits and designators, in order, with nothing after the last one
+		EXPECT_FALSE( TimeSpan::fromString( "PT5Sx" ).has_value() );
+		EXPECT_FALSE( TimeSpan::fromString( "P1DT" ).has_value() );
+		EXPECT_FALSE( TimeSpan::fromString( "P1D2D" ).has_value() );
+		EXPECT_FALSE( TimeSpan::fromString( "P1YT1H" ).has_value() );
+		EXPECT_FALSE( TimeSpan::fromString( "PT1HT2M" ).has_value() );
+		EXPECT_FALSE( TimeSpan::fromString( "PT-1H" ).has_value() );
+		EXPECT_FALSE( TimeSpan::fromString( "PT1e3S" ).has_value() );
+		EXPECT_FALSE( TimeSpan::fromString( "P1H" ).has_value() );
+		EXPECT_FALSE( TimeSpan::fromString( "PT.S" ).has_value() );
+		EXPECT_FALSE( TimeSpan::fromString( "-" ).has_value() );
+		EXPECT_FALSE( TimeSpan::fromString( "." ).has_value() );
+	}
+
 	//----------------------------------------------
 	// std::chrono interoperability
 	//----------------------------------------------
@@ -819,6 +864,28 @@ namespace nfx::time::test
 		EXPECT_TRUE( iss2.fail() );
 	}
 
+	TEST( TimeSpanStreamOperators, RoundTrip )
+	{
+		const TimeSpan values[]{ TimeSpan{ 0 }, TimeSpan::fromHours( 25.5 ), TimeSpan{ -9000000001 }, TimeSpan{ std::numeric_limits<std::int64_t>::min() } };
+		std::stringstream stream;
+		for ( const auto& value : values )
+		{
+			stream << value << ' ';
+		}
+
+		for ( const auto& value : values )
+		{
+			TimeSpan parsed;
+			stream >> parsed;
+			ASSERT_FALSE( stream.fail() );
+			EXPECT_EQ( parsed, value );
+		}
+
+		std::ostringstream padded;
+		padded << std::setw( 8 ) << TimeSpan::fromHours( 1.0 );
+		EXPECT_EQ( padded.str(), "    PT1H" );
+	}
+
 	//----------------------------------------------
 	// std::formatter support
 	//----------------------------------------------
@@ -880,6 +947,56 @@ namespace nfx::time::test
 		EXPECT_NE( formatted.find( "PT0S" ), std::string::npos );
 	}
 
+	TEST( TimeSpanFormatter, Specs )
+	{
+		const TimeSpan duration{ TimeSpan::fromDays( 2.0 ) + TimeSpan::fromHours( 3.0 ) + TimeSpan::fromMilliseconds( 1500.0 ) };
+
+		EXPECT_EQ( std::format( "{:iso}", duration ), duration.toString() );
+		EXPECT_EQ( std::format( "{:ms}", duration ), "183601500" );
+		EXPECT_EQ( std::format( "{:ms}", -duration ), "-183601500" );
+		EXPECT_EQ( std::format( "{:%dd %H:%M:%S.%f}", duration ), "2d 03:00:01.5000000" );
+		EXPECT_EQ( std::format( "{:%H:%M:%S}", -TimeSpan::fromMinutes( 90.0 ) ), "-01:30:00" );
+	}
+
+	TEST( TimeSpanFormatter, InvalidSpecThrows )
+	{
+		const TimeSpan duration{ TimeSpan::fromHours( 1.0 ) };
+
+		EXPECT_THROW( (void)std::vformat( "{:date}", std::make_format_args( duration ) ), std::format_error );
+		EXPECT_THROW( (void)std::vformat( "{:%Y %H}", std::make_format_args( duration ) ), std::format_error );
+	}
+
+	TEST( TimeSpanStringFormatting, ToCharsMatchesToString )
+	{
+		for ( const std::int64_t ticks : std::initializer_list<std::int64_t>{ 0, 1, -1, 10000000, 864000000000, -9000000001, std::numeric_limits<std::int64_t>::max() } )
+		{
+			const TimeSpan duration{ ticks };
+			const std::string expected{ duration.toString() };
+
+			char buffer[32];
+			const auto result{ duration.toChars( buffer, buffer + sizeof( buffer ) ) };
+			ASSERT_EQ( result.ec, std::errc{} );
+			EXPECT_EQ( std::string( buffer, result.ptr ), expected );
+
+			const auto tooShort{ duration.toChars( buffer, buffer + expected.size() - 1 ) };
+			EXPECT_EQ( tooShort.ec, std::errc::value_too_large );
+		}
+		EXPECT_EQ( TimeSpan{ std::numeric_limits<std::int64_t>::min() }.toString(), "-P10675199DT2H48M5.4775808S" );
+	}
+
+	TEST( TimeSpanStringFormatting, ToFixedStringMatchesToString )
+	{
+		for ( const std::int64_t ticks : std::initializer_list<std::int64_t>{ 0, 1, -1, 10000000, 864000000000, -9000000001, std::numeric_limits<std::int64_t>::max(),
+				  std::numeric_limits<std::int64_t>::min() } )
+		{
+			const TimeSpan duration{ ticks };
+			EXPECT_EQ( std::string_view{ duration.toFixedString() }, duration.toString() );
+		}
+
+		// The most negative span is the longest string
+		EXPECT_EQ( TimeSpan{ std::numeric_limits<std::int64_t>::min() }.toFixedString().size(), constants::MAX_DURATION_LENGTH );
+	}
+
 	//----------------------------------------------
 	// Literals
 	//----------------------------------------------
@@ -1180,6 +1297,30 @@ namespace nfx::time::test
 		EXPECT_DOUBLE_EQ( sleepDuration.minutes(), 495.0 );
 	}
 
+	TEST( TimeSpanLiterals, Iso8601DurationLiteral )
+	{
+		using namespace nfx::time::literals;
+
+		// Evaluated entirely at compile time
+		static_assert( "PT1H30M"_ts == 1_h + 30_min );
+		static_assert( "P1DT12H"_ts == 36_h );
+		static_assert( "-PT45S"_ts == -45_s );
+		static_assert( "PT0.5S"_ts == 500_ms );
+		static_assert( "60.5"_ts == 60.5_s );
+
+		EXPECT_EQ( "PT2H30M45S"_ts, TimeSpan::fromString( "PT2H30M45S" ) );
+		EXPECT_EQ( "P2DT1.5H"_ts, TimeSpan::fromString( "P2DT1.5H" ) );
+
+		// The shared parser rejects what fromString() rejects, so bad literals fail to compile
+		static_assert( []() {
+			std::int64_t ticks{ 0 };
+			return !internal::parseTimeSpan( "PT", ticks ) &&
+				   !internal::parseTimeSpan( "PT30M2H", ticks ) &&
+				   !internal::parseTimeSpan( "PT1H2H", ticks ) &&
+				   !internal::parseTimeSpan( "invalid", ticks );
+		}() );
+	}
+
 	//----------------------------------------------
 	// Edge cases
 	//----------------------------------------------
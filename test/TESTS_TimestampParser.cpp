@@ -0,0 +1,176 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_TimestampParser.cpp
+ * @brief Unit tests for the layout-learning TimestampParser
+ * @details Every result is checked against DateTime::fromString() and
+ *          DateTimeOffset::fromString()
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <nfx/datetime/TimestampParser.h>
+
+namespace nfx::time::test
+{
+	//=====================================================================
+	// TimestampParser tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	/** @brief Runs of strings in several layouts, with near misses and invalid values mixed in */
+	static std::vector<std::string> layoutCorpus()
+	{
+		const std::vector<std::string> suffixes{ "", "Z", "+05:30", "-08:00", "+0530", "-0800", "+05", "-11", "+14:00", "+14:01", "+15:00", "+05:60" };
+		const std::vector<std::string> fractions{ "", ".1", ".123", ".1234567", ".12345678" };
+
+		std::vector<std::string> corpus;
+		for ( const auto& suffix : suffixes )
+		{
+			for ( const auto& fraction : fractions )
+			{
+				for ( const auto* prefix : { "2024-06-15T13:45:30", "1999-12-31T23:59:59", "2024-02-29T00:00:00", "2023-02-29T00:00:00",
+						  "2024-06-15T24:00:00", "2024-06-15T13:45:3x", "2024-6-15T13:45:30", "0001-01-01T00:00:00" } )
+				{
+					corpus.push_back( prefix + fraction + suffix );
+				}
+			}
+		}
+		corpus.push_back( "2024-06-15" );
+		corpus.push_back( "2024-06-15T13:45:30" );
+		corpus.push_back( "2024-06-15T13:45:30ZZ" );
+		corpus.push_back( "2024-06-15T13:45:30.Z" );
+		corpus.push_back( "" );
+
+		return corpus;
+	}
+
+	//----------------------------------------------
+	// Equivalence with fromString()
+	//----------------------------------------------
+
+	TEST( TimestampParser, DateTimeMatchesFromString )
+	{
+		TimestampParser parser;
+		for ( const auto& text : layoutCorpus() )
+		{
+			const auto expected{ DateTime::fromString( text ) };
+			DateTime actual;
+			ASSERT_EQ( parser.parse( text, actual ), expected.has_value() ) << "'" << text << "'";
+			if ( expected )
+			{
+				ASSERT_EQ( actual, *expected ) << "'" << text << "'";
+			}
+		}
+		EXPECT_GT( parser.hits(), 0u );
+	}
+
+	TEST( TimestampParser, DateTimeOffsetMatchesFromString )
+	{
+		TimestampParser parser;
+		for ( const auto& text : layoutCorpus() )
+		{
+			const auto expected{ DateTimeOffset::fromString( text ) };
+			DateTimeOffset actual;
+			ASSERT_EQ( parser.parse( text, actual ), expected.has_value() ) << "'" << text << "'";
+			if ( expected )
+			{
+				ASSERT_EQ( actual.dateTime(), expected->dateTime() ) << "'" << text << "'";
+				ASSERT_EQ( actual.offset(), expected->offset() ) << "'" << text << "'";
+			}
+		}
+		EXPECT_GT( parser.hits(), 0u );
+	}
+
+	//----------------------------------------------
+	// Learning and statistics
+	//----------------------------------------------
+
+	TEST( TimestampParser, LearnsFirstLayoutAndCountsHits )
+	{
+		TimestampParser parser;
+		EXPECT_FALSE( parser.hasLayout() );
+
+		DateTimeOffset value;
+		EXPECT_TRUE( parser.parse( "2024-06-15T13:45:30.123+05:30", value ) );
+		EXPECT_TRUE( parser.hasLayout() );
+		EXPECT_TRUE( parser.parse( "2024-06-15T13:45:31.456-08:00", value ) );
+		EXPECT_TRUE( parser.parse( "2024-06-15T13:45:32.789+00:00", value ) );
+		EXPECT_EQ( value.dateTime(), DateTime( 2024, 6, 15, 13, 45, 32 ) + TimeSpan{ 7890000 } );
+		EXPECT_EQ( parser.misses(), 1u );
+		EXPECT_EQ( parser.hits(), 2u );
+
+		parser.resetStatistics();
+		EXPECT_EQ( parser.hits(), 0u );
+		EXPECT_EQ( parser.misses(), 0u );
+		EXPECT_TRUE( parser.hasLayout() );
+	}
+
+	TEST( TimestampParser, RelearnsWhenLayoutChanges )
+	{
+		TimestampParser parser;
+		DateTime value;
+		EXPECT_TRUE( parser.parse( "2024-06-15T13:45:30Z", value ) );
+		EXPECT_TRUE( parser.parse( "2024-06-15T13:45:31Z", value ) );
+		EXPECT_TRUE( parser.parse( "2024-06-15T13:45:32.5+0100", value ) );
+		EXPECT_TRUE( parser.parse( "2024-06-15T13:45:33.5+0100", value ) );
+		EXPECT_EQ( value, DateTime( 2024, 6, 15, 13, 45, 33 ) + TimeSpan{ 5000000 } );
+		EXPECT_EQ( parser.misses(), 2u );
+		EXPECT_EQ( parser.hits(), 2u );
+	}
+
+	TEST( TimestampParser, InvalidInputKeepsLayout )
+	{
+		TimestampParser parser;
+		DateTime value;
+		EXPECT_TRUE( parser.parse( "2024-06-15T13:45:30Z", value ) );
+		EXPECT_FALSE( parser.parse( "2023-02-29T13:45:30Z", value ) );
+		EXPECT_FALSE( parser.parse( "not a timestamp", value ) );
+		EXPECT_TRUE( parser.hasLayout() );
+		EXPECT_TRUE( parser.parse( "2024-06-15T13:45:31Z", value ) );
+		EXPECT_EQ( parser.hits(), 1u );
+		EXPECT_EQ( parser.misses(), 3u );
+	}
+
+	TEST( TimestampParser, UnlearnableLayoutUsesGeneralParser )
+	{
+		TimestampParser parser;
+		DateTime value;
+		EXPECT_TRUE( parser.parse( "2024-06-15", value ) );
+		EXPECT_FALSE( parser.hasLayout() );
+		EXPECT_TRUE( parser.parse( "2024-06-16", value ) );
+		EXPECT_EQ( value, DateTime( 2024, 6, 16 ) );
+		EXPECT_EQ( parser.hits(), 0u );
+
+		parser.reset();
+		EXPECT_EQ( parser.misses(), 0u );
+	}
+} // namespace nfx::time::test
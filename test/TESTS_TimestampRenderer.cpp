@@ -0,0 +1,185 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_TimestampRenderer.cpp
+ * @brief Unit tests for the prefix-caching TimestampRenderer
+ * @details Every result is checked against DateTime::toString( DateTime::Format::Iso8601Extended )
+ */
+
+#include <gtest/gtest.h>
+
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/datetime/TimestampRenderer.h>
+
+namespace nfx::time::test
+{
+	//=====================================================================
+	// TimestampRenderer tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	/** @brief Render into a MAX_LENGTH buffer and return the text */
+	static std::string render( TimestampRenderer& renderer, const DateTime& value )
+	{
+		char buffer[TimestampRenderer::MAX_LENGTH];
+		const auto result{ renderer.render( value, buffer, buffer + sizeof( buffer ) ) };
+		EXPECT_EQ( result.ec, std::errc{} );
+
+		return std::string( buffer, result.ptr );
+	}
+
+	/** @brief Values crossing second, minute, day and year boundaries, including range ends and trailing zeros */
+	static std::vector<DateTime> boundaryValues()
+	{
+		std::vector<DateTime> values{ DateTime::min(), DateTime{ 1 }, DateTime::max() };
+		const auto start{ DateTime{ 2023, 12, 31, 23, 58, 58 } };
+		std::int64_t offset{ 0 };
+		std::uint32_t state{ 12345 };
+		for ( int i{ 0 }; i < 4000; ++i )
+		{
+			state = state * 1664525u + 1013904223u;
+			// Mostly sub-second steps, some whole milliseconds and seconds, a few full minutes
+			const std::uint32_t roll{ state >> 24 };
+			offset += roll < 200 ? ( state >> 8 ) % 300000 : roll < 250 ? constants::TICKS_PER_MILLISECOND * 250 : constants::TICKS_PER_MINUTE;
+			values.push_back( start + TimeSpan{ offset } );
+		}
+		values.push_back( start );
+		values.push_back( DateTime{ 2024, 2, 29, 12, 0, 0 } );
+
+		return values;
+	}
+
+	//----------------------------------------------
+	// Equivalence with toString()
+	//----------------------------------------------
+
+	TEST( TimestampRenderer, MatchesToStringForEveryGranularity )
+	{
+		const auto values{ boundaryValues() };
+		for ( const auto granularity : { TimestampRenderer::Granularity::Second, TimestampRenderer::Granularity::Minute } )
+		{
+			TimestampRenderer renderer{ granularity };
+			EXPECT_EQ( renderer.granularity(), granularity );
+			for ( const auto& value : values )
+			{
+				ASSERT_EQ( render( renderer, value ), value.toString( DateTime::Format::Iso8601Extended ) ) << value.ticks();
+			}
+			EXPECT_GT( renderer.hits(), 0u );
+			EXPECT_EQ( renderer.hits() + renderer.misses(), values.size() );
+		}
+	}
+
+	TEST( TimestampRenderer, MinuteGranularityHitsMore )
+	{
+		const auto values{ boundaryValues() };
+		TimestampRenderer second{ TimestampRenderer::Granularity::Second };
+		TimestampRenderer minute{ TimestampRenderer::Granularity::Minute };
+		for ( const auto& value : values )
+		{
+			static_cast<void>( render( second, value ) );
+			static_cast<void>( render( minute, value ) );
+		}
+
+		EXPECT_GT( minute.hits(), second.hits() );
+	}
+
+	//----------------------------------------------
+	// Cache behaviour
+	//----------------------------------------------
+
+	TEST( TimestampRenderer, CountsHitsAndMisses )
+	{
+		TimestampRenderer renderer;
+		const auto base{ DateTime{ 2024, 6, 15, 13, 45, 30 } };
+
+		EXPECT_EQ( render( renderer, base ), "2024-06-15T13:45:30.0Z" );
+		EXPECT_EQ( render( renderer, base + TimeSpan{ 1234500 } ), "2024-06-15T13:45:30.12345Z" );
+		EXPECT_EQ( render( renderer, base + TimeSpan{ constants::TICKS_PER_SECOND - 1 } ), "2024-06-15T13:45:30.9999999Z" );
+		EXPECT_EQ( renderer.hits(), 2u );
+		EXPECT_EQ( renderer.misses(), 1u );
+
+		// Going back in time misses as well
+		EXPECT_EQ( render( renderer, base - TimeSpan{ 1 } ), "2024-06-15T13:45:29.9999999Z" );
+		EXPECT_EQ( render( renderer, base + TimeSpan{ constants::TICKS_PER_SECOND } ), "2024-06-15T13:45:31.0Z" );
+		EXPECT_EQ( renderer.misses(), 3u );
+
+		renderer.resetStatistics();
+		EXPECT_EQ( renderer.hits(), 0u );
+		EXPECT_EQ( renderer.misses(), 0u );
+		static_cast<void>( render( renderer, base + TimeSpan{ constants::TICKS_PER_SECOND + 5 } ) );
+		EXPECT_EQ( renderer.hits(), 1u );
+
+		renderer.reset();
+		static_cast<void>( render( renderer, base + TimeSpan{ constants::TICKS_PER_SECOND + 5 } ) );
+		EXPECT_EQ( renderer.hits(), 0u );
+		EXPECT_EQ( renderer.misses(), 1u );
+	}
+
+	//----------------------------------------------
+	// Buffer handling
+	//----------------------------------------------
+
+	TEST( TimestampRenderer, ShortBufferMatchesToChars )
+	{
+		const auto value{ DateTime{ 2024, 6, 15, 13, 45, 30 } + TimeSpan{ 1234567 } };
+		TimestampRenderer renderer;
+		for ( std::size_t size{ 0 }; size <= TimestampRenderer::MAX_LENGTH; ++size )
+		{
+			char rendered[TimestampRenderer::MAX_LENGTH];
+			char expected[TimestampRenderer::MAX_LENGTH];
+			const auto result{ renderer.render( value, rendered, rendered + size ) };
+			const auto reference{ value.toChars( expected, expected + size, DateTime::Format::Iso8601Extended ) };
+
+			ASSERT_EQ( result.ec, reference.ec ) << size;
+			ASSERT_EQ( result.ptr - rendered, reference.ptr - expected ) << size;
+			if ( result.ec == std::errc{} )
+			{
+				EXPECT_EQ( ( std::string_view{ rendered, result.ptr } ), ( std::string_view{ expected, reference.ptr } ) );
+			}
+		}
+	}
+
+	TEST( TimestampRenderer, RenderNowIsCurrentTime )
+	{
+		TimestampRenderer renderer;
+		char buffer[TimestampRenderer::MAX_LENGTH];
+		const auto before{ DateTime::utcNow() };
+		const auto result{ renderer.renderNow( buffer, buffer + sizeof( buffer ) ) };
+		const auto after{ DateTime::utcNow() };
+
+		ASSERT_EQ( result.ec, std::errc{} );
+		const DateTime rendered{ std::string_view{ buffer, result.ptr } };
+		EXPECT_GE( rendered, before );
+		EXPECT_LE( rendered, after );
+	}
+} // namespace nfx::time::test
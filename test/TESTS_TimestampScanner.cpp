@@ -0,0 +1,257 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_TimestampScanner.cpp
+ * @brief Unit tests for streaming CSV/NDJSON timestamp extraction
+ * @details Chunked input is checked against single-buffer scanning at every split point,
+ *          and every SIMD level supported by the host is exercised
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/datetime/Batch.h>
+#include <nfx/datetime/TimestampScanner.h>
+
+namespace nfx::time::test
+{
+	//=====================================================================
+	// TimestampScanner tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	/** @brief Restores the default SIMD level when a test finishes */
+	struct ScannerSimdLevelGuard
+	{
+		~ScannerSimdLevelGuard()
+		{
+			batch::setSimdLevel( batch::supportedSimdLevel() );
+		}
+	};
+
+	/** @brief SIMD levels available on this host, scalar first */
+	static std::vector<batch::SimdLevel> scannerSimdLevels()
+	{
+		std::vector<batch::SimdLevel> levels{ batch::SimdLevel::Scalar };
+		if ( batch::supportedSimdLevel() >= batch::SimdLevel::Avx2 )
+		{
+			levels.push_back( batch::SimdLevel::Avx2 );
+		}
+
+		return levels;
+	}
+
+	static void expectSameRecords( const std::vector<TimestampScanner::Record>& actual, const std::vector<TimestampScanner::Record>& expected )
+	{
+		ASSERT_EQ( actual.size(), expected.size() );
+		for ( std::size_t i{ 0 }; i < actual.size(); ++i )
+		{
+			EXPECT_EQ( actual[i].valid, expected[i].valid ) << "record " << i;
+			EXPECT_EQ( actual[i].value, expected[i].value ) << "record " << i;
+			EXPECT_EQ( actual[i].offset, expected[i].offset ) << "record " << i;
+			EXPECT_EQ( actual[i].length, expected[i].length ) << "record " << i;
+			EXPECT_EQ( actual[i].line, expected[i].line ) << "record " << i;
+		}
+	}
+
+	//----------------------------------------------
+	// CSV
+	//----------------------------------------------
+
+	TEST( TimestampScannerCsv, ExtractsColumnWithOffsets )
+	{
+		const std::string_view input{
+			"id,time,message\n"
+			"1,2024-06-15T13:45:30Z,hello\r\n"
+			"\n"
+			"2,\"2024-06-15T13:45:31.5+02:00\",quoted\n"
+			"3,not a date,bad\n"
+			"4\n"
+			"5,2024-06-15T13:45:32" };
+
+		auto scanner{ TimestampScanner::csv( 1, ',', true ) };
+		std::vector<TimestampScanner::Record> records;
+		ASSERT_EQ( scanner.scan( input, records ), 5u );
+
+		EXPECT_TRUE( records[0].valid );
+		EXPECT_EQ( records[0].line, 1u );
+		EXPECT_EQ( input.substr( records[0].offset, records[0].length ), "2024-06-15T13:45:30Z" );
+		EXPECT_EQ( records[0].dateTime(), DateTime( 2024, 6, 15, 13, 45, 30 ) );
+
+		EXPECT_TRUE( records[1].valid );
+		EXPECT_EQ( records[1].line, 3u );
+		EXPECT_EQ( input.substr( records[1].offset, records[1].length ), "2024-06-15T13:45:31.5+02:00" );
+		EXPECT_EQ( records[1].value, DateTimeOffset::fromString( "2024-06-15T13:45:31.5+02:00" ).value() );
+
+		EXPECT_FALSE( records[2].valid );
+		EXPECT_EQ( input.substr( records[2].offset, records[2].length ), "not a date" );
+
+		// Missing column: reported at the start of the line
+		EXPECT_FALSE( records[3].valid );
+		EXPECT_EQ( records[3].length, 0u );
+		EXPECT_EQ( input.substr( records[3].offset, 1 ), "4" );
+
+		// Final line without a newline
+		EXPECT_TRUE( records[4].valid );
+		EXPECT_EQ( records[4].line, 6u );
+		EXPECT_EQ( records[4].dateTime(), DateTime( 2024, 6, 15, 13, 45, 32 ) );
+	}
+
+	TEST( TimestampScannerCsv, FarColumnAcrossSimdBlocks )
+	{
+		ScannerSimdLevelGuard guard;
+
+		std::string input;
+		for ( int row{ 0 }; row < 50; ++row )
+		{
+			for ( int column{ 0 }; column < 40; ++column )
+			{
+				input += std::to_string( row * column );
+				input += '\t';
+			}
+			input += ( DateTime{ 2020, 1, 1 } + TimeSpan::fromSeconds( row * 977.0 ) ).toString();
+			input += "\ttrailing\n";
+		}
+
+		for ( const auto level : scannerSimdLevels() )
+		{
+			batch::setSimdLevel( level );
+
+			auto scanner{ TimestampScanner::csv( 40, '\t' ) };
+			std::vector<TimestampScanner::Record> records;
+			ASSERT_EQ( scanner.scan( input, records ), 50u );
+			for ( std::size_t row{ 0 }; row < records.size(); ++row )
+			{
+				ASSERT_TRUE( records[row].valid ) << "row " << row;
+				EXPECT_EQ( records[row].dateTime(), DateTime( 2020, 1, 1 ) + TimeSpan::fromSeconds( static_cast<double>( row ) * 977.0 ) );
+			}
+		}
+	}
+
+	TEST( TimestampScannerCsv, InvalidDelimiterThrows )
+	{
+		EXPECT_THROW( static_cast<void>( TimestampScanner::csv( 0, '\n' ) ), std::invalid_argument );
+		EXPECT_THROW( static_cast<void>( TimestampScanner::csv( 0, '"' ) ), std::invalid_argument );
+	}
+
+	//----------------------------------------------
+	// NDJSON
+	//----------------------------------------------
+
+	TEST( TimestampScannerNdjson, ExtractsKeyValue )
+	{
+		const std::string_view input{
+			R"({"msg":"ts","ts" : "2024-06-15T13:45:30Z","n":1})"
+			"\n"
+			R"({"meta":{"ts":"2024-06-15T13:45:31+05:30"}})"
+			"\n"
+			R"({"ts":12345})"
+			"\n"
+			R"({"other":"2024-06-15T13:45:32Z"})"
+			"\n" };
+
+		auto scanner{ TimestampScanner::ndjson( "ts" ) };
+		std::vector<TimestampScanner::Record> records;
+		ASSERT_EQ( scanner.scan( input, records ), 4u );
+
+		// "ts" as a string value is skipped; the member key is found
+		EXPECT_TRUE( records[0].valid );
+		EXPECT_EQ( input.substr( records[0].offset, records[0].length ), "2024-06-15T13:45:30Z" );
+
+		EXPECT_TRUE( records[1].valid );
+		EXPECT_EQ( records[1].value.offset(), TimeSpan::fromMinutes( 330 ) );
+
+		EXPECT_FALSE( records[2].valid );
+		EXPECT_FALSE( records[3].valid );
+		EXPECT_EQ( records[3].line, 3u );
+	}
+
+	TEST( TimestampScannerNdjson, InvalidKeyThrows )
+	{
+		EXPECT_THROW( static_cast<void>( TimestampScanner::ndjson( "" ) ), std::invalid_argument );
+		EXPECT_THROW( static_cast<void>( TimestampScanner::ndjson( "a\"b" ) ), std::invalid_argument );
+	}
+
+	//----------------------------------------------
+	// Chunked input
+	//----------------------------------------------
+
+	TEST( TimestampScannerChunks, EverySplitMatchesSingleBuffer )
+	{
+		ScannerSimdLevelGuard guard;
+
+		std::string input;
+		for ( int row{ 0 }; row < 8; ++row )
+		{
+			input += R"({"level":"info","time":")";
+			input += ( DateTime{ 2024, 3, 10 } + TimeSpan::fromMinutes( row * 61.0 ) ).toString( DateTime::Format::Iso8601Extended );
+			input += R"(","msg":"request served"})";
+			input += row % 3 == 0 ? "\r\n" : "\n";
+		}
+		input += R"({"time":"2024-03-11T00:00:00Z"})";
+
+		for ( const auto level : scannerSimdLevels() )
+		{
+			batch::setSimdLevel( level );
+
+			auto scanner{ TimestampScanner::ndjson( "time" ) };
+			std::vector<TimestampScanner::Record> expected;
+			ASSERT_EQ( scanner.scan( input, expected ), 9u );
+
+			for ( std::size_t split{ 0 }; split <= input.size(); ++split )
+			{
+				for ( std::size_t second{ split }; second <= input.size(); second += 7 )
+				{
+					std::vector<TimestampScanner::Record> records;
+					scanner.feed( std::string_view{ input }.substr( 0, split ), records );
+					scanner.feed( std::string_view{ input }.substr( split, second - split ), records );
+					scanner.feed( std::string_view{ input }.substr( second ), records );
+					scanner.finish( records );
+					expectSameRecords( records, expected );
+				}
+			}
+		}
+	}
+
+	TEST( TimestampScannerChunks, ResetDiscardsPartialLine )
+	{
+		auto scanner{ TimestampScanner::csv( 0 ) };
+		std::vector<TimestampScanner::Record> records;
+		EXPECT_EQ( scanner.feed( std::string_view{ "2024-06-15T13:4" }, records ), 0u );
+
+		scanner.reset();
+		EXPECT_EQ( scanner.feed( std::string_view{ "2024-06-15T13:45:30\n" }, records ), 1u );
+		ASSERT_EQ( records.size(), 1u );
+		EXPECT_TRUE( records[0].valid );
+		EXPECT_EQ( records[0].offset, 0u );
+		EXPECT_EQ( records[0].line, 0u );
+	}
+} // namespace nfx::time::test
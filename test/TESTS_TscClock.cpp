@@ -0,0 +1,178 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_TscClock.cpp
+ * @brief Unit tests for the TSC-calibrated wall clock
+ * @details Readings are checked against DateTime::utcNow() taken just before and after them;
+ *          on processors without an invariant counter the clock is the system clock itself.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <nfx/datetime/TscClock.h>
+
+namespace nfx::time::test
+{
+	//=====================================================================
+	// TscClock tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	/** @brief Distance in ticks from a clock reading to the utcNow() readings bracketing it */
+	static std::int64_t bracketError( TscClock& clock )
+	{
+		const std::int64_t before{ DateTime::utcNow().ticks() };
+		const std::int64_t reading{ clock.nowTicks() };
+		const std::int64_t after{ DateTime::utcNow().ticks() };
+
+		return std::max( { before - reading, reading - after, std::int64_t{ 0 } } );
+	}
+
+	/** @brief Drift budget: generous for virtual machines, far below a coarse clock tick */
+	static constexpr std::int64_t MAX_ERROR_TICKS{ constants::TICKS_PER_MILLISECOND };
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	TEST( TscClock, ReportsItsSource )
+	{
+		TscClock clock;
+		if ( !TscClock::isInvariantTscSupported() )
+		{
+			EXPECT_FALSE( clock.isTscBacked() );
+		}
+
+		if ( clock.isTscBacked() )
+		{
+			EXPECT_GT( clock.frequency(), 10e6 );
+			EXPECT_LT( clock.frequency(), 20e9 );
+		}
+		else
+		{
+			EXPECT_EQ( clock.frequency(), 0.0 );
+		}
+	}
+
+	TEST( TscClock, ReanchorInterval )
+	{
+		EXPECT_EQ( TscClock{}.reanchorInterval(), TimeSpan::fromSeconds( 1.0 ) );
+		EXPECT_EQ( TscClock{ TimeSpan::fromMilliseconds( 250.0 ) }.reanchorInterval(), TimeSpan::fromMilliseconds( 250.0 ) );
+		EXPECT_EQ( TscClock{ TimeSpan{ 0 } }.reanchorInterval(), TimeSpan::fromSeconds( 1.0 ) );
+		EXPECT_EQ( TscClock{ TimeSpan::fromSeconds( -1.0 ) }.reanchorInterval(), TimeSpan::fromSeconds( 1.0 ) );
+	}
+
+	TEST( TscClock, SharedInstance )
+	{
+		EXPECT_EQ( &TscClock::shared(), &TscClock::shared() );
+		EXPECT_EQ( TscClock::shared().reanchorInterval(), TimeSpan::fromSeconds( 1.0 ) );
+	}
+
+	//----------------------------------------------
+	// Reading
+	//----------------------------------------------
+
+	TEST( TscClock, MatchesUtcNow )
+	{
+		TscClock clock;
+		for ( int i{ 0 }; i < 1000; ++i )
+		{
+			EXPECT_LE( bracketError( clock ), MAX_ERROR_TICKS );
+		}
+
+		const DateTime before{ DateTime::utcNow() };
+		const DateTime now{ clock.now() };
+		EXPECT_LE( ( before - now ).ticks(), MAX_ERROR_TICKS );
+		EXPECT_LE( ( now - DateTime::utcNow() ).ticks(), MAX_ERROR_TICKS );
+	}
+
+	TEST( TscClock, DriftStaysBoundedOverLongRun )
+	{
+		// Several re-anchors plus a stretch longer than the interval between two of them
+		TscClock clock{ TimeSpan::fromMilliseconds( 400.0 ) };
+		const double frequency{ clock.frequency() };
+
+		std::int64_t maxError{ 0 };
+		const auto end{ std::chrono::steady_clock::now() + std::chrono::milliseconds{ 2000 } };
+		while ( std::chrono::steady_clock::now() < end )
+		{
+			maxError = std::max( maxError, bracketError( clock ) );
+			std::this_thread::sleep_for( std::chrono::milliseconds{ 1 } );
+		}
+		EXPECT_LE( maxError, MAX_ERROR_TICKS );
+
+		// Refinement tracks the same counter, well within the accepted deviation
+		if ( clock.isTscBacked() )
+		{
+			EXPECT_NEAR( clock.frequency() / frequency, 1.0, 500e-6 );
+		}
+	}
+
+	TEST( TscClock, ExplicitReanchor )
+	{
+		TscClock clock{ TimeSpan::fromSeconds( 3600.0 ) };
+		std::this_thread::sleep_for( std::chrono::milliseconds{ 50 } );
+		clock.reanchor();
+		for ( int i{ 0 }; i < 1000; ++i )
+		{
+			EXPECT_LE( bracketError( clock ), MAX_ERROR_TICKS );
+		}
+	}
+
+	TEST( TscClock, ConcurrentReaders )
+	{
+		// A short interval makes the readers race on re-anchoring
+		TscClock clock{ TimeSpan::fromMilliseconds( 1.0 ) };
+		std::vector<std::int64_t> maxErrors( 4, 0 );
+		std::vector<std::thread> readers;
+		for ( std::size_t t{ 0 }; t < maxErrors.size(); ++t )
+		{
+			readers.emplace_back( [&clock, &maxErrors, t] {
+				for ( int i{ 0 }; i < 20000; ++i )
+				{
+					maxErrors[t] = std::max( maxErrors[t], bracketError( clock ) );
+				}
+			} );
+		}
+		for ( auto& reader : readers )
+		{
+			reader.join();
+		}
+
+		for ( const std::int64_t maxError : maxErrors )
+		{
+			EXPECT_LE( maxError, MAX_ERROR_TICKS );
+		}
+	}
+} // namespace nfx::time::test